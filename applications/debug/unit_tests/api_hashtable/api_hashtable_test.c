@@ -0,0 +1,83 @@
+#include <furi.h>
+#include <flipper_application/api_hashtable/api_hashtable.h>
+
+#include "../minunit.h"
+
+#define TEST_BENCHMARK_ROUNDS 20
+
+/* Defined in api_hashtable_test_tables.cpp */
+extern const ElfApiInterface* const api_hashtable_test_sorted_interface;
+extern const ElfApiInterface* const api_hashtable_test_perfect_hash_interface;
+extern const struct sym_entry* const api_hashtable_test_entries;
+extern const size_t api_hashtable_test_entries_count;
+
+MU_TEST(api_hashtable_test_resolve_all) {
+    const ElfApiInterface* sorted = api_hashtable_test_sorted_interface;
+    const ElfApiInterface* perfect = api_hashtable_test_perfect_hash_interface;
+
+    for(size_t i = 0; i < api_hashtable_test_entries_count; i++) {
+        const struct sym_entry* entry = &api_hashtable_test_entries[i];
+        Elf32_Addr sorted_address = 0;
+        Elf32_Addr perfect_address = 0;
+        mu_assert(
+            sorted->resolver_callback(sorted, entry->hash, &sorted_address),
+            "Sorted table lookup failed");
+        mu_assert(
+            perfect->resolver_callback(perfect, entry->hash, &perfect_address),
+            "Perfect hash lookup failed");
+        mu_assert_int_eq(entry->address, sorted_address);
+        mu_assert_int_eq(entry->address, perfect_address);
+    }
+}
+
+MU_TEST(api_hashtable_test_absent) {
+    const ElfApiInterface* perfect = api_hashtable_test_perfect_hash_interface;
+
+    // Entries are sorted by hash, gaps between them are absent symbols
+    size_t absent = 0;
+    for(size_t i = 0; i + 1 < api_hashtable_test_entries_count && absent < 8; i++) {
+        const uint32_t hash = api_hashtable_test_entries[i].hash + 1;
+        if(hash == api_hashtable_test_entries[i + 1].hash) continue;
+        Elf32_Addr address = 0;
+        mu_assert(
+            !perfect->resolver_callback(perfect, hash, &address), "Absent symbol resolved");
+        absent++;
+    }
+    mu_check(absent > 0);
+}
+
+static uint32_t api_hashtable_test_benchmark_run(const ElfApiInterface* interface) {
+    uint32_t start = furi_get_tick();
+    for(size_t round = 0; round < TEST_BENCHMARK_ROUNDS; round++) {
+        for(size_t i = 0; i < api_hashtable_test_entries_count; i++) {
+            Elf32_Addr address;
+            interface->resolver_callback(interface, api_hashtable_test_entries[i].hash, &address);
+        }
+    }
+    return MAX(furi_get_tick() - start, 1UL);
+}
+
+/* Timings depend on scheduling, they are printed and not checked */
+MU_TEST(api_hashtable_test_benchmark) {
+    const uint32_t sorted_time =
+        api_hashtable_test_benchmark_run(api_hashtable_test_sorted_interface);
+    const uint32_t perfect_time =
+        api_hashtable_test_benchmark_run(api_hashtable_test_perfect_hash_interface);
+    const size_t lookups = api_hashtable_test_entries_count * TEST_BENCHMARK_ROUNDS;
+    printf(
+        "API table %u symbols: sorted %lu, perfect hash %lu lookups per ms\r\n",
+        api_hashtable_test_entries_count,
+        lookups / sorted_time,
+        lookups / perfect_time);
+}
+
+MU_TEST_SUITE(api_hashtable_suite) {
+    MU_RUN_TEST(api_hashtable_test_resolve_all);
+    MU_RUN_TEST(api_hashtable_test_absent);
+    MU_RUN_TEST(api_hashtable_test_benchmark);
+}
+
+int run_minunit_test_api_hashtable() {
+    MU_RUN_SUITE(api_hashtable_suite);
+    return MU_EXIT_CODE;
+}
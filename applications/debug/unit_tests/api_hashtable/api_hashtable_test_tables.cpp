@@ -0,0 +1,55 @@
+#include <flipper_application/api_hashtable/api_hashtable.h>
+#include <flipper_application/api_hashtable/compilesort.hpp>
+#include <flipper_application/api_hashtable/compilehash.hpp>
+
+/* Close to firmware API size, firmware table itself is kept out of unit tests image */
+#define API_HASHTABLE_TEST_ENTRIES 1024
+
+/* Mix is a bijection for fixed seed: hashes are spread like symbol hashes and never collide.
+ * Addresses are fake, they are only compared. */
+template <std::size_t N>
+constexpr std::array<sym_entry, N> api_hashtable_test_table() {
+    std::array<sym_entry, N> table{};
+    for(std::size_t i = 0; i < N; i++) {
+        table[i] = sym_entry{
+            .hash = api_perfect_hash_mix(i, 1),
+            .address = static_cast<uint32_t>(0x08000001 + i * 8),
+        };
+    }
+    return sort(table);
+}
+
+static constexpr auto test_api_table = api_hashtable_test_table<API_HASHTABLE_TEST_ENTRIES>();
+static constexpr auto test_api_perfect_hash = perfect_hash(test_api_table);
+
+static_assert(!has_hash_collisions(test_api_table), "Detected test table hash collision!");
+static_assert(test_api_perfect_hash.is_valid, "Failed to build test perfect hash table!");
+
+constexpr HashtableApiInterface sorted_api_interface{
+    {
+        .api_version_major = 0,
+        .api_version_minor = 0,
+        .resolver_callback = &elf_resolve_from_hashtable,
+    },
+    .table_cbegin = test_api_table.cbegin(),
+    .table_cend = test_api_table.cend(),
+};
+
+constexpr PerfectHashApiInterface perfect_hash_api_interface{
+    {
+        .api_version_major = 0,
+        .api_version_minor = 0,
+        .resolver_callback = &elf_resolve_from_perfect_hash,
+    },
+    .table = test_api_perfect_hash.table.data(),
+    .displacements = test_api_perfect_hash.displacements.data(),
+    .table_size = test_api_perfect_hash.table.size(),
+    .displacements_size = test_api_perfect_hash.displacements.size(),
+};
+
+extern "C" const ElfApiInterface* const api_hashtable_test_sorted_interface =
+    &sorted_api_interface;
+extern "C" const ElfApiInterface* const api_hashtable_test_perfect_hash_interface =
+    &perfect_hash_api_interface;
+extern "C" const struct sym_entry* const api_hashtable_test_entries = test_api_table.data();
+extern "C" const size_t api_hashtable_test_entries_count = test_api_table.size();
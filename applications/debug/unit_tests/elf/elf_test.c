@@ -0,0 +1,255 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <flipper_application/elf/elf.h>
+#include <flipper_application/elf/elf_file.h>
+#include <flipper_application/elf/elf_file_i.h>
+#include "../minunit.h"
+
+#define ELF_TEST_DIR EXT_PATH("unit_tests_tmp")
+#define ELF_TEST_FILE EXT_PATH("unit_tests_tmp/elf_test.elf")
+#define ELF_TEST_SNAPSHOT EXT_PATH("unit_tests_tmp/.elf_test.elf.reloc")
+
+enum {
+    ElfTestSectionNull,
+    ElfTestSectionText,
+    ElfTestSectionSymtab,
+    ElfTestSectionStrtab,
+    ElfTestSectionRel,
+    ElfTestSectionShstrtab,
+    ElfTestSectionNum,
+};
+
+/* Smallest file with everything relocation snapshot depends on */
+typedef struct {
+    Elf32_Ehdr header;
+    uint8_t text[4];
+    Elf32_Sym symtab[3];
+    char strtab[13];
+    Elf32_Rel rel[2];
+    char shstrtab[44];
+    Elf32_Shdr sections[ElfTestSectionNum];
+} FURI_PACKED ElfTestFile;
+
+static const char elf_test_strtab[] = "\0foo_1\0bar_2";
+static const char elf_test_shstrtab[] = "\0.text\0.symtab\0.strtab\0.rel.text\0.shstrtab";
+
+static void elf_test_section(
+    ElfTestFile* file,
+    size_t index,
+    const char* name,
+    uint32_t type,
+    const void* data,
+    size_t size,
+    uint32_t entry_size) {
+    Elf32_Shdr* section = &file->sections[index];
+    for(size_t offset = 1; offset < sizeof(elf_test_shstrtab);
+        offset += strlen(&elf_test_shstrtab[offset]) + 1) {
+        if(strcmp(&elf_test_shstrtab[offset], name) == 0) section->sh_name = offset;
+    }
+    section->sh_type = type;
+    section->sh_offset = (uint32_t)((const uint8_t*)data - (const uint8_t*)file);
+    section->sh_size = size;
+    section->sh_entsize = entry_size;
+}
+
+static void elf_test_file_init(ElfTestFile* file) {
+    memset(file, 0, sizeof(ElfTestFile));
+
+    memcpy(file->header.e_ident, ELFMAG, SELFMAG);
+    file->header.e_ident[EI_CLASS] = ELFCLASS32;
+    file->header.e_ident[EI_DATA] = ELFDATA2LSB;
+    file->header.e_type = ET_REL;
+    file->header.e_machine = EM_ARM;
+    file->header.e_ehsize = sizeof(Elf32_Ehdr);
+    file->header.e_shentsize = sizeof(Elf32_Shdr);
+    file->header.e_shoff = offsetof(ElfTestFile, sections);
+    file->header.e_shnum = ElfTestSectionNum;
+    file->header.e_shstrndx = ElfTestSectionShstrtab;
+
+    file->symtab[1].st_name = 1;
+    file->symtab[1].st_info = ELF32_ST_INFO(STB_GLOBAL, STT_FUNC);
+    file->symtab[1].st_shndx = ElfTestSectionText;
+    file->symtab[2].st_name = 7;
+    file->symtab[2].st_info = ELF32_ST_INFO(STB_GLOBAL, STT_NOTYPE);
+    memcpy(file->strtab, elf_test_strtab, sizeof(elf_test_strtab));
+    file->rel[0].r_info = ELF32_R_INFO(1, R_ARM_ABS32);
+    file->rel[1].r_info = ELF32_R_INFO(2, R_ARM_ABS32);
+    memcpy(file->shstrtab, elf_test_shstrtab, sizeof(elf_test_shstrtab));
+
+    elf_test_section(file, ElfTestSectionText, ".text", SHT_PROGBITS, file->text, 4, 0);
+    file->sections[ElfTestSectionText].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+    elf_test_section(
+        file,
+        ElfTestSectionSymtab,
+        ".symtab",
+        SHT_SYMTAB,
+        file->symtab,
+        sizeof(file->symtab),
+        sizeof(Elf32_Sym));
+    file->sections[ElfTestSectionSymtab].sh_link = ElfTestSectionStrtab;
+    file->sections[ElfTestSectionSymtab].sh_info = 1;
+    elf_test_section(
+        file, ElfTestSectionStrtab, ".strtab", SHT_STRTAB, file->strtab, sizeof(file->strtab), 0);
+    elf_test_section(
+        file, ElfTestSectionRel, ".rel.text", SHT_REL, file->rel, sizeof(file->rel), 8);
+    file->sections[ElfTestSectionRel].sh_link = ElfTestSectionSymtab;
+    file->sections[ElfTestSectionRel].sh_info = ElfTestSectionText;
+    elf_test_section(
+        file,
+        ElfTestSectionShstrtab,
+        ".shstrtab",
+        SHT_STRTAB,
+        file->shstrtab,
+        sizeof(file->shstrtab),
+        0);
+}
+
+/* Checksum snapshot is saved and validated with, snapshot with other one is rejected */
+static bool elf_test_snapshot_checksum(
+    Storage* storage,
+    const ElfTestFile* file,
+    uint32_t* checksum) {
+    File* fd = storage_file_alloc(storage);
+    bool result = storage_file_open(fd, ELF_TEST_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  storage_file_write(fd, file, sizeof(ElfTestFile)) == sizeof(ElfTestFile);
+    storage_file_free(fd);
+
+    ELFFile* elf = elf_file_alloc(storage, NULL);
+    if(result && elf_file_open(elf, ELF_TEST_FILE)) {
+        elf_file_set_relocation_snapshot(elf, ELF_TEST_SNAPSHOT, 0);
+        result = elf->snapshot_path != NULL;
+        *checksum = elf->snapshot_checksum;
+    } else {
+        result = false;
+    }
+    elf_file_free(elf);
+
+    return result;
+}
+
+MU_TEST(elf_test_snapshot_checksum_rebuild) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_mkdir(storage, ELF_TEST_DIR);
+
+    ElfTestFile* file = malloc(sizeof(ElfTestFile));
+    elf_test_file_init(file);
+    uint32_t checksum = 0;
+    uint32_t rebuilt = 0;
+    mu_check(elf_test_snapshot_checksum(storage, file, &checksum));
+
+    // Same file, snapshot stays valid
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_assert_int_eq(checksum, rebuilt);
+
+    // Code is relocated on every load and doesn't invalidate snapshot
+    file->text[0] = 0xAA;
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_assert_int_eq(checksum, rebuilt);
+
+    // Symbol renamed, every size and offset is the same
+    file->strtab[5] = '3';
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_check(checksum != rebuilt);
+    file->strtab[5] = '1';
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_assert_int_eq(checksum, rebuilt);
+
+    // Symbol table reordered, relocations point to other symbols
+    const Elf32_Sym symbol = file->symtab[1];
+    file->symtab[1] = file->symtab[2];
+    file->symtab[2] = symbol;
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_check(checksum != rebuilt);
+    file->symtab[2] = file->symtab[1];
+    file->symtab[1] = symbol;
+
+    // Relocation retargeted
+    file->rel[0].r_info = ELF32_R_INFO(2, R_ARM_ABS32);
+    mu_check(elf_test_snapshot_checksum(storage, file, &rebuilt));
+    mu_check(checksum != rebuilt);
+
+    free(file);
+    storage_simply_remove(storage, ELF_TEST_FILE);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static bool
+    elf_test_resolver(const ElfApiInterface* interface, uint32_t hash, Elf32_Addr* address) {
+    UNUSED(interface);
+    UNUSED(hash);
+    UNUSED(address);
+    return false;
+}
+
+static const ElfApiInterface elf_test_api_interface = {
+    .resolver_callback = elf_test_resolver,
+};
+
+/* Load with relocation snapshot, relocated word of .text is returned in value */
+static bool elf_test_snapshot_load(
+    Storage* storage,
+    const ElfTestFile* file,
+    bool* is_snapshot_loaded,
+    uint32_t* value) {
+    File* fd = storage_file_alloc(storage);
+    bool result = storage_file_open(fd, ELF_TEST_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  storage_file_write(fd, file, sizeof(ElfTestFile)) == sizeof(ElfTestFile);
+    storage_file_free(fd);
+
+    ELFFile* elf = elf_file_alloc(storage, &elf_test_api_interface);
+    if(result && elf_file_open(elf, ELF_TEST_FILE)) {
+        elf_file_set_relocation_snapshot(elf, ELF_TEST_SNAPSHOT, 0);
+        result = elf_file_load_section_table(elf) &&
+                 elf_file_load_sections(elf) == ELFFileLoadStatusSuccess;
+        ELFSection* text = ELFSectionDict_get(elf->sections, ".text");
+        if(result && text) {
+            *is_snapshot_loaded = elf->snapshot_is_loaded;
+            *value = *(uint32_t*)text->data - (uint32_t)text->data;
+        } else {
+            result = false;
+        }
+    } else {
+        result = false;
+    }
+    elf_file_free(elf);
+
+    return result;
+}
+
+MU_TEST(elf_test_snapshot_absolute_symbol) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_mkdir(storage, ELF_TEST_DIR);
+    storage_simply_remove(storage, ELF_TEST_SNAPSHOT);
+
+    // Both relocations patch the same word: .text address plus absolute value
+    ElfTestFile* file = malloc(sizeof(ElfTestFile));
+    elf_test_file_init(file);
+    file->symtab[2].st_shndx = SHN_ABS;
+    file->symtab[2].st_value = 0x1234;
+
+    bool is_snapshot_loaded = true;
+    uint32_t value = 0;
+    mu_check(elf_test_snapshot_load(storage, file, &is_snapshot_loaded, &value));
+    mu_check(!is_snapshot_loaded);
+    mu_assert_int_eq(0x1234, value);
+
+    // Recorded snapshot is applied, not recorded again
+    mu_check(elf_test_snapshot_load(storage, file, &is_snapshot_loaded, &value));
+    mu_check(is_snapshot_loaded);
+    mu_assert_int_eq(0x1234, value);
+
+    free(file);
+    storage_simply_remove(storage, ELF_TEST_SNAPSHOT);
+    storage_simply_remove(storage, ELF_TEST_FILE);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(elf_suite) {
+    MU_RUN_TEST(elf_test_snapshot_checksum_rebuild);
+    MU_RUN_TEST(elf_test_snapshot_absolute_symbol);
+}
+
+int run_minunit_test_elf() {
+    MU_RUN_SUITE(elf_suite);
+    return MU_EXIT_CODE;
+}
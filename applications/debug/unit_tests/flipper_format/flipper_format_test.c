@@ -75,6 +75,20 @@ static const char* test_data_odd = "Filetype: Flipper File test\n"
                                    // Mixed trailing whitespace
                                    "Hex data: DE AD BE\t    ";
 
+#define READ_TEST_IDX "ff_index.test"
+static const char* test_data_idx = "Filetype: Index test\n"
+                                   "# Comment: name\n"
+                                   "name: first\n"
+                                   "type: raw\n"
+                                   "data: 1 2 3\n"
+                                   "name: second\r\n"
+                                   "type: parsed\n"
+                                   "note: value: with colon\n"
+                                   "name: third\n";
+
+// Biggest of the stock universal remotes, if installed
+#define TEST_KEY_INDEX_BENCHMARK_FILE EXT_PATH("infrared/assets/audio.ir")
+
 // data created by user on linux machine
 static const char* test_file_linux = TEST_DIR READ_TEST_NIX;
 // data created by user on windows machine
@@ -83,6 +97,8 @@ static const char* test_file_windows = TEST_DIR READ_TEST_WIN;
 static const char* test_file_flipper = TEST_DIR READ_TEST_FLP;
 // data containing odd user input
 static const char* test_file_oddities = TEST_DIR READ_TEST_ODD;
+// data with repeated keys
+static const char* test_file_index = TEST_DIR READ_TEST_IDX;
 
 static bool storage_write_string(const char* path, const char* data) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -456,6 +472,70 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+static bool test_read_key_index(const char* file_name, bool key_index) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(file, key_index);
+    FuriString* value = furi_string_alloc();
+    bool result = false;
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+
+        // Duplicate keys are found in file order from the current position
+        if(!flipper_format_read_string(file, "name", value)) break;
+        if(furi_string_cmp_str(value, "first")) break;
+        if(!flipper_format_read_string(file, "name", value)) break;
+        if(furi_string_cmp_str(value, "second")) break;
+        if(!flipper_format_read_string(file, "note", value)) break;
+        if(furi_string_cmp_str(value, "value: with colon")) break;
+        if(flipper_format_read_string(file, "type", value)) break;
+
+        // Comments and values are not keys
+        if(flipper_format_key_exist(file, "# Comment")) break;
+        if(flipper_format_key_exist(file, "value")) break;
+        if(!flipper_format_key_exist(file, "note")) break;
+
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_string(file, "type", value)) break;
+        if(furi_string_cmp_str(value, "raw")) break;
+
+        // Update shifts everything after the first "type"
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_update_string_cstr(file, "type", "changed after update")) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_string(file, "type", value)) break;
+        if(furi_string_cmp_str(value, "changed after update")) break;
+        if(!flipper_format_read_string(file, "name", value)) break;
+        if(furi_string_cmp_str(value, "second")) break;
+        if(!flipper_format_read_string(file, "name", value)) break;
+        if(furi_string_cmp_str(value, "third")) break;
+
+        // Inserted key is found after the index is rebuilt
+        if(!flipper_format_insert_or_update_string_cstr(file, "added", "new")) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_string(file, "added", value)) break;
+        if(furi_string_cmp_str(value, "new")) break;
+
+        // Strict mode still fails on any other key in between
+        flipper_format_set_strict_mode(file, true);
+        if(!flipper_format_rewind(file)) break;
+        if(flipper_format_read_string(file, "name", value)) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_string(file, "Filetype", value)) break;
+        if(!flipper_format_read_string(file, "name", value)) break;
+        if(furi_string_cmp_str(value, "first")) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(value);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -528,6 +608,60 @@ MU_TEST(flipper_format_oddities_test) {
     mu_assert(test_read(test_file_linux), "Read test error [Oddities]");
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    mu_assert(storage_write_string(test_file_index, test_data_idx), "Write test error [Index]");
+    mu_assert(test_read_key_index(test_file_index, false), "Read test error [Index off]");
+    mu_assert(storage_write_string(test_file_index, test_data_idx), "Write test error [Index]");
+    mu_assert(test_read_key_index(test_file_index, true), "Read test error [Index on]");
+}
+
+static size_t test_key_index_benchmark_run(const char* file_name, bool key_index) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(file, key_index);
+    FuriString* value = furi_string_alloc();
+
+    uint32_t start = furi_get_tick();
+    size_t names = 0;
+    if(flipper_format_buffered_file_open_existing(file, file_name)) {
+        // Walk over all signals, then look up keys that are not there
+        while(flipper_format_read_string(file, "name", value)) {
+            names++;
+        }
+        for(size_t i = 0; i < 10; i++) {
+            if(flipper_format_key_exist(file, "missing")) names = 0;
+        }
+    }
+    uint32_t time = furi_get_tick() - start;
+
+    printf(
+        "Flipper format %s index: %u names, %lu ms\r\n",
+        key_index ? "with" : "without",
+        names,
+        time);
+
+    furi_string_free(value);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return names;
+}
+
+MU_TEST(flipper_format_key_index_benchmark) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool exists = storage_file_exists(storage, TEST_KEY_INDEX_BENCHMARK_FILE);
+    furi_record_close(RECORD_STORAGE);
+
+    if(!exists) {
+        printf("Flipper format benchmark skipped, no " TEST_KEY_INDEX_BENCHMARK_FILE "\r\n");
+        return;
+    }
+
+    size_t names = test_key_index_benchmark_run(TEST_KEY_INDEX_BENCHMARK_FILE, false);
+    mu_check(names > 0);
+    mu_assert_int_eq(names, test_key_index_benchmark_run(TEST_KEY_INDEX_BENCHMARK_FILE, true));
+}
+
 MU_TEST_SUITE(flipper_format) {
     tests_setup();
     MU_RUN_TEST(flipper_format_write_test);
@@ -542,6 +676,8 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
     MU_RUN_TEST(flipper_format_oddities_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
+    MU_RUN_TEST(flipper_format_key_index_benchmark);
     tests_teardown();
 }
 
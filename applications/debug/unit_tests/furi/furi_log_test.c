@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include "../minunit.h"
+
+#define TAG "LogTest"
+
+#define FURI_LOG_TEST_OUTPUT_SIZE 1024
+#define FURI_LOG_TEST_DROP_COUNT 256
+
+typedef struct {
+    uint8_t data[FURI_LOG_TEST_OUTPUT_SIZE];
+    size_t size;
+} FuriLogTestOutput;
+
+static void furi_log_test_callback(const uint8_t* data, size_t size, void* context) {
+    FuriLogTestOutput* output = context;
+    size = MIN(size, FURI_LOG_TEST_OUTPUT_SIZE - output->size - 1);
+    memcpy(&output->data[output->size], data, size);
+    output->size += size;
+    output->data[output->size] = '\0';
+}
+
+static FuriLogHandler furi_log_test_start(FuriLogTestOutput* output, FuriLogMode mode) {
+    memset(output, 0, sizeof(FuriLogTestOutput));
+    FuriLogHandler handler = {.callback = furi_log_test_callback, .context = output};
+    furi_log_add_handler(handler);
+    furi_log_set_mode(mode);
+    return handler;
+}
+
+static void furi_log_test_stop(FuriLogHandler handler) {
+    furi_log_set_mode(FuriLogModeSync);
+    furi_log_remove_handler(handler);
+}
+
+void test_furi_log_deferred() {
+    FuriLogTestOutput* output = malloc(sizeof(FuriLogTestOutput));
+    FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+
+    FuriLogHandler handler = furi_log_test_start(output, FuriLogModeDeferred);
+    char text[] = "text";
+    FURI_LOG_I(TAG, "%d %s %ld %02x %.2f %*d%%", 42, text, -5L, 0xf, (double)0.5f, 3, 7);
+    // Strings are copied into the record
+    strcpy(text, "lost");
+    // Precision bounds the copy, buffer has no terminator
+    const char raw[4] = {'a', 'b', 'c', 'd'};
+    FURI_LOG_I(TAG, "%.*s %.2s", 3, raw, raw);
+    furi_log_flush();
+    furi_log_test_stop(handler);
+
+    const char* expected = "[I][" TAG "] " _FURI_LOG_CLR_RESET "42 text -5 0f 0.50   7%\r\n";
+    mu_assert(strstr((char*)output->data, expected), "Deferred record is not formatted as sync one");
+    expected = "[I][" TAG "] " _FURI_LOG_CLR_RESET "abc ab\r\n";
+    mu_assert(strstr((char*)output->data, expected), "String precision is not applied");
+
+    furi_log_set_level(level);
+    free(output);
+}
+
+void test_furi_log_binary() {
+    FuriLogTestOutput* output = malloc(sizeof(FuriLogTestOutput));
+    FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+
+    // Pointers are transmitted, not strings
+    const char* tag = TAG;
+    const char* format = "%lu %s";
+    FuriLogHandler handler = furi_log_test_start(output, FuriLogModeBinary);
+    FURI_LOG_I(tag, format, 0x12345678UL, "abc");
+    furi_log_flush();
+    furi_log_test_stop(handler);
+
+    // Magic, size, tick, tag, format, level, flags, args size, 8 bytes value, "abc"
+    const uint8_t* record = NULL;
+    for(size_t i = 0; i + 2 + 40 <= output->size; i++) {
+        const char* record_tag;
+        memcpy(&record_tag, &output->data[i + 2 + 8], sizeof(record_tag));
+        if(output->data[i] == 0xF1 && output->data[i + 1] == 0x06 && record_tag == tag) {
+            record = &output->data[i + 2];
+            break;
+        }
+    }
+    mu_assert(record, "Binary record is not found");
+
+    uint32_t size;
+    memcpy(&size, record, sizeof(size));
+    mu_assert_int_eq(20 + 8 + 4, size);
+    const char* record_format;
+    memcpy(&record_format, &record[12], sizeof(record_format));
+    mu_assert(record_format == format, "Format pointer expected");
+    mu_assert_int_eq(FuriLogLevelInfo, record[16]);
+    uint64_t value;
+    memcpy(&value, &record[20], sizeof(value));
+    mu_assert_int_eq(0x12345678, value);
+    mu_assert_string_eq("abc", (const char*)&record[28]);
+
+    furi_log_set_level(level);
+    free(output);
+}
+
+void test_furi_log_dropped() {
+    FuriLogTestOutput* output = malloc(sizeof(FuriLogTestOutput));
+    FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+
+    FuriLogHandler handler = furi_log_test_start(output, FuriLogModeDeferred);
+    const uint32_t dropped = furi_log_get_dropped_count();
+    // Log thread has low priority, nothing is transmitted till flush
+    for(size_t i = 0; i < FURI_LOG_TEST_DROP_COUNT; i++) {
+        FURI_LOG_RAW_I(".");
+    }
+    furi_log_flush();
+    furi_log_test_stop(handler);
+
+    mu_assert(furi_log_get_dropped_count() > dropped, "Records are expected to be dropped");
+    mu_assert(strstr((char*)output->data, "records dropped"), "Drops are not reported");
+
+    furi_log_set_level(level);
+    free(output);
+}
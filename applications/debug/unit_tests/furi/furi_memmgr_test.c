@@ -1,7 +1,39 @@
 #include "../minunit.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <core/memmgr_slab.h>
+#include <furi_hal_cortex.h>
+
+/* Replayed workload runs over a first fit heap model of the same size, with and without slab */
+#define MEMMGR_TEST_HEAP_SIZE (32 * 1024)
+#define MEMMGR_TEST_HEAP_UNIT (8)
+#define MEMMGR_TEST_SLAB_PAGES (8)
+#define MEMMGR_TEST_OBJECTS (96)
+#define MEMMGR_TEST_STEPS (8192)
+#define MEMMGR_TEST_SAMPLE_STEPS (64)
+
+typedef struct {
+    uint8_t used[MEMMGR_TEST_HEAP_SIZE / MEMMGR_TEST_HEAP_UNIT];
+    size_t unit_count;
+} MemmgrTestHeap;
+
+typedef struct {
+    uint8_t* slot;
+    uint16_t offset;
+    uint16_t units;
+} MemmgrTestObject;
+
+typedef struct {
+    size_t free_blocks; /* Average over samples */
+    size_t fragmentation; /* Free heap share outside the biggest block, average percent */
+    size_t failures;
+    uint32_t alloc_cycles;
+} MemmgrTestResult;
+
+static uint8_t memmgr_test_slab_region[MEMMGR_TEST_SLAB_PAGES * MEMMGR_SLAB_PAGE_SIZE]
+    __attribute__((aligned(8)));
 
 void test_furi_memmgr() {
     void* ptr;
@@ -36,3 +68,177 @@ void test_furi_memmgr() {
     }
     free(ptr);
 }
+
+void test_furi_memmgr_slab() {
+    MemmgrSlab* slab = malloc(sizeof(MemmgrSlab));
+    memmgr_slab_init(slab, memmgr_test_slab_region, 2 * MEMMGR_SLAB_PAGE_SIZE + 100);
+    mu_assert_int_eq(2, memmgr_slab_get_free_pages(slab));
+    mu_assert_int_eq(2 * MEMMGR_SLAB_PAGE_SIZE, memmgr_slab_get_free(slab));
+
+    // Empty or too big for slab
+    mu_check(memmgr_slab_alloc(slab, 0) == NULL);
+    mu_check(memmgr_slab_alloc(slab, MEMMGR_SLAB_SIZE_MAX + 1) == NULL);
+
+    // Smallest class that fits, one page per class
+    uint8_t* small = memmgr_slab_alloc(slab, 10);
+    uint8_t* big = memmgr_slab_alloc(slab, 100);
+    mu_check(memmgr_slab_contains(slab, small));
+    mu_check(memmgr_slab_contains(slab, big));
+    mu_check(!memmgr_slab_contains(slab, memmgr_test_slab_region + 2 * MEMMGR_SLAB_PAGE_SIZE));
+    mu_assert_int_eq(16, memmgr_slab_get_size(slab, small));
+    mu_assert_int_eq(128, memmgr_slab_get_size(slab, big));
+    mu_assert_int_eq(0, memmgr_slab_get_free_pages(slab));
+    mu_assert_int_eq(2 * MEMMGR_SLAB_PAGE_SIZE - 16 - 128, memmgr_slab_get_free(slab));
+
+    // Class without page falls back to heap
+    mu_check(memmgr_slab_alloc(slab, 40) == NULL);
+    MemmgrSlabStats stats;
+    memmgr_slab_get_stats(slab, 2, &stats);
+    mu_assert_int_eq(64, stats.slot_size);
+    mu_assert_int_eq(0, stats.pages);
+    mu_assert_int_eq(1, stats.fallbacks);
+
+    // Page is filled slot by slot
+    uint8_t* slots[MEMMGR_SLAB_PAGE_SIZE / 16] = {small};
+    for(size_t i = 1; i < COUNT_OF(slots); i++) {
+        slots[i] = memmgr_slab_alloc(slab, 16);
+        mu_check(slots[i] == small + i * 16);
+    }
+    mu_check(memmgr_slab_alloc(slab, 16) == NULL);
+    memmgr_slab_get_stats(slab, 0, &stats);
+    mu_assert_int_eq(1, stats.pages);
+    mu_assert_int_eq(COUNT_OF(slots), stats.slots_used);
+    mu_assert_int_eq(COUNT_OF(slots), stats.slots_total);
+
+    // Freed slot is reused, empty page serves other classes
+    memmgr_slab_free(slab, slots[5]);
+    mu_assert_int_eq(0, memmgr_slab_get_size(slab, slots[5]));
+    mu_check(memmgr_slab_alloc(slab, 1) == slots[5]);
+    for(size_t i = 0; i < COUNT_OF(slots); i++) {
+        memmgr_slab_free(slab, slots[i]);
+    }
+    mu_assert_int_eq(1, memmgr_slab_get_free_pages(slab));
+    mu_check(memmgr_slab_alloc(slab, 64) == small);
+
+    free(slab);
+}
+
+static uint32_t memmgr_test_random(uint32_t* state) {
+    *state = *state * 1103515245 + 12345;
+    return *state >> 16;
+}
+
+/* Size distribution of small strings and nodes, medium structures and buffers */
+static size_t memmgr_test_size(uint32_t* state) {
+    const uint32_t kind = memmgr_test_random(state) % 100;
+    if(kind < 60) return 8 + memmgr_test_random(state) % 57;
+    if(kind < 85) return 65 + memmgr_test_random(state) % 64;
+    return 256 + memmgr_test_random(state) % 1793;
+}
+
+/* First fit over address ordered units, every block has a header unit as in heap */
+static bool memmgr_test_heap_alloc(MemmgrTestHeap* heap, size_t size, MemmgrTestObject* object) {
+    const size_t units = (size + MEMMGR_TEST_HEAP_UNIT - 1) / MEMMGR_TEST_HEAP_UNIT + 1;
+    size_t run = 0;
+    for(size_t i = 0; i < heap->unit_count; i++) {
+        run = heap->used[i] ? 0 : run + 1;
+        if(run == units) {
+            object->offset = i + 1 - units;
+            object->units = units;
+            memset(&heap->used[object->offset], 1, units);
+            return true;
+        }
+    }
+    return false;
+}
+
+static void memmgr_test_heap_free(MemmgrTestHeap* heap, MemmgrTestObject* object) {
+    memset(&heap->used[object->offset], 0, object->units);
+    object->units = 0;
+}
+
+static void memmgr_test_heap_measure(MemmgrTestHeap* heap, MemmgrTestResult* result) {
+    size_t free_size = 0;
+    size_t max_free_size = 0;
+    for(size_t i = 0; i < heap->unit_count; i++) {
+        if(heap->used[i]) continue;
+        const size_t start = i;
+        while(i < heap->unit_count && !heap->used[i]) i++;
+        result->free_blocks++;
+        free_size += i - start;
+        max_free_size = MAX(max_free_size, i - start);
+    }
+    result->fragmentation += free_size ? 100 - max_free_size * 100 / free_size : 0;
+}
+
+static void memmgr_test_replay(bool use_slab, MemmgrTestResult* result) {
+    MemmgrTestHeap* heap = malloc(sizeof(MemmgrTestHeap));
+    MemmgrSlab* slab = malloc(sizeof(MemmgrSlab));
+    MemmgrTestObject* objects = malloc(sizeof(MemmgrTestObject) * MEMMGR_TEST_OBJECTS);
+    memset(heap, 0, sizeof(MemmgrTestHeap));
+    memset(objects, 0, sizeof(MemmgrTestObject) * MEMMGR_TEST_OBJECTS);
+    memset(result, 0, sizeof(MemmgrTestResult));
+
+    // Slab pages are taken from the same budget
+    const size_t slab_size = use_slab ? sizeof(memmgr_test_slab_region) : 0;
+    memmgr_slab_init(slab, memmgr_test_slab_region, slab_size);
+    heap->unit_count = (MEMMGR_TEST_HEAP_SIZE - slab_size) / MEMMGR_TEST_HEAP_UNIT;
+
+    uint32_t state = 0x4D454D;
+    for(size_t step = 0; step < MEMMGR_TEST_STEPS; step++) {
+        MemmgrTestObject* object = &objects[memmgr_test_random(&state) % MEMMGR_TEST_OBJECTS];
+        const size_t size = memmgr_test_size(&state);
+
+        if(object->slot) {
+            // Slot still holds pattern written on allocation
+            mu_assert_int_eq((uint8_t)(object - objects), object->slot[0]);
+            memmgr_slab_free(slab, object->slot);
+            object->slot = NULL;
+        } else if(object->units) {
+            memmgr_test_heap_free(heap, object);
+        } else {
+            const uint32_t start = furi_hal_cortex_get_cycle_count();
+            object->slot = memmgr_slab_alloc(slab, size);
+            const bool is_allocated = object->slot ||
+                                      memmgr_test_heap_alloc(heap, size, object);
+            result->alloc_cycles += furi_hal_cortex_get_cycle_count() - start;
+
+            if(object->slot) object->slot[0] = object - objects;
+            if(!is_allocated) result->failures++;
+        }
+
+        if(step % MEMMGR_TEST_SAMPLE_STEPS == MEMMGR_TEST_SAMPLE_STEPS - 1) {
+            memmgr_test_heap_measure(heap, result);
+        }
+    }
+    result->free_blocks /= MEMMGR_TEST_STEPS / MEMMGR_TEST_SAMPLE_STEPS;
+    result->fragmentation /= MEMMGR_TEST_STEPS / MEMMGR_TEST_SAMPLE_STEPS;
+
+    free(objects);
+    free(slab);
+    free(heap);
+}
+
+void test_furi_memmgr_slab_replay() {
+    MemmgrTestResult heap_only;
+    MemmgrTestResult with_slab;
+    memmgr_test_replay(false, &heap_only);
+    memmgr_test_replay(true, &with_slab);
+
+    const MemmgrTestResult* results[] = {&heap_only, &with_slab};
+    for(size_t i = 0; i < COUNT_OF(results); i++) {
+        printf(
+            "Memmgr replay %s slab: %zu free blocks, fragmentation %zu%%, %zu failures, "
+            "%lu alloc cycles\r\n",
+            i ? "with" : "without",
+            results[i]->free_blocks,
+            results[i]->fragmentation,
+            results[i]->failures,
+            results[i]->alloc_cycles);
+    }
+
+    // Small objects no longer split big free blocks
+    mu_assert_int_eq(0, with_slab.failures);
+    mu_check(with_slab.free_blocks < heap_only.free_blocks);
+    mu_check(with_slab.fragmentation < heap_only.fragmentation);
+}
@@ -1,6 +1,10 @@
 #include <furi.h>
+#include <furi_hal_cortex.h>
 #include "../minunit.h"
 
+#define FURI_STRING_TEST_ARENA_STRINGS (64)
+#define FURI_STRING_TEST_BENCHMARK_ROUNDS (256)
+
 static void test_setup(void) {
 }
 
@@ -445,6 +449,121 @@ MU_TEST(mu_test_furi_string_utf8) {
     furi_string_free(utf8_string);
 }
 
+MU_TEST(mu_test_furi_string_storage) {
+    // Grows from inline storage to heap and keeps content
+    FuriString* string = furi_string_alloc_set("short");
+    FuriString* expected = furi_string_alloc();
+    for(size_t i = 0; i < 100; i++) {
+        furi_string_push_back(string, 'a' + i % 26);
+    }
+    mu_assert_int_eq(105, furi_string_size(string));
+    mu_check(furi_string_start_with_str(string, "shortabcdefghijklmnopqrstuvwxyz"));
+    mu_check(furi_string_end_with_str(string, "tuv"));
+
+    // Shrinks back without losing content
+    furi_string_left(string, 7);
+    mu_assert_string_eq("shortab", furi_string_get_cstr(string));
+
+    // Swap and move between inline and heap strings
+    furi_string_set(expected, "a string that does not fit inline storage");
+    furi_string_swap(string, expected);
+    mu_assert_string_eq("a string that does not fit inline storage", furi_string_get_cstr(string));
+    mu_assert_string_eq("shortab", furi_string_get_cstr(expected));
+    furi_string_move(string, expected);
+    mu_assert_string_eq("shortab", furi_string_get_cstr(string));
+
+    // Appending string to itself
+    furi_string_cat(string, string);
+    mu_assert_string_eq("shortabshortab", furi_string_get_cstr(string));
+    furi_string_cat_printf(string, "%s%s", furi_string_get_cstr(string), "!");
+    mu_assert_string_eq("shortabshortabshortabshortab!", furi_string_get_cstr(string));
+    furi_string_cat_str(string, furi_string_get_cstr(string) + 24);
+    mu_assert_string_eq("shortabshortabshortabshortab!rtab!", furi_string_get_cstr(string));
+
+    furi_string_free(string);
+}
+
+MU_TEST(mu_test_furi_string_arena) {
+    FuriStringArena* arena = furi_string_arena_alloc(128);
+    FuriString* strings[FURI_STRING_TEST_ARENA_STRINGS];
+
+    for(size_t round = 0; round < 2; round++) {
+        // Short and long strings, some bigger than arena chunk
+        for(size_t i = 0; i < FURI_STRING_TEST_ARENA_STRINGS; i++) {
+            strings[i] = furi_string_alloc_arena(arena);
+            furi_string_printf(strings[i], "string %zu", i);
+            for(size_t j = 0; j < i * 4; j++) {
+                furi_string_push_back(strings[i], '0' + j % 10);
+            }
+        }
+        for(size_t i = 0; i < FURI_STRING_TEST_ARENA_STRINGS; i++) {
+            FuriString* expected = furi_string_alloc_printf("string %zu", i);
+            mu_assert_int_eq(furi_string_size(expected) + i * 4, furi_string_size(strings[i]));
+            mu_check(furi_string_start_with(strings[i], expected));
+            furi_string_free(expected);
+            // Does nothing, memory belongs to arena
+            furi_string_free(strings[i]);
+        }
+        furi_string_arena_reset(arena);
+    }
+
+    // Heap and arena strings swap and move their content
+    FuriString* arena_string = furi_string_alloc_arena(arena);
+    furi_string_set(arena_string, "arena string");
+    FuriString* heap_string = furi_string_alloc_set("heap string that is long enough for heap");
+    furi_string_swap(arena_string, heap_string);
+    mu_assert_string_eq("arena string", furi_string_get_cstr(heap_string));
+    mu_assert_string_eq(
+        "heap string that is long enough for heap", furi_string_get_cstr(arena_string));
+
+    heap_string = furi_string_alloc_move(heap_string);
+    furi_string_cat(heap_string, arena_string);
+    mu_assert_string_eq(
+        "arena stringheap string that is long enough for heap",
+        furi_string_get_cstr(heap_string));
+    furi_string_move(arena_string, heap_string);
+    mu_assert_string_eq(
+        "arena stringheap string that is long enough for heap",
+        furi_string_get_cstr(arena_string));
+
+    furi_string_arena_free(arena);
+}
+
+static uint32_t furi_string_test_benchmark(FuriStringArena* arena) {
+    FuriString* strings[FURI_STRING_TEST_ARENA_STRINGS];
+    const uint32_t start = furi_hal_cortex_get_cycle_count();
+    for(size_t i = 0; i < FURI_STRING_TEST_ARENA_STRINGS; i++) {
+        strings[i] = arena ? furi_string_alloc_arena(arena) : furi_string_alloc();
+        furi_string_printf(strings[i], "%zu", i);
+        furi_string_cat_printf(strings[i], ": %s", "key");
+        for(size_t j = 0; j < i % 32; j++) {
+            furi_string_push_back(strings[i], 'a');
+        }
+    }
+    for(size_t i = 0; i < FURI_STRING_TEST_ARENA_STRINGS; i++) {
+        furi_string_free(strings[i]);
+    }
+    if(arena) furi_string_arena_reset(arena);
+    return furi_hal_cortex_get_cycle_count() - start;
+}
+
+MU_TEST(mu_test_furi_string_benchmark) {
+    FuriStringArena* arena = furi_string_arena_alloc(0);
+    uint64_t heap_cycles = 0;
+    uint64_t arena_cycles = 0;
+    for(size_t round = 0; round < FURI_STRING_TEST_BENCHMARK_ROUNDS; round++) {
+        heap_cycles += furi_string_test_benchmark(NULL);
+        arena_cycles += furi_string_test_benchmark(arena);
+    }
+    furi_string_arena_free(arena);
+
+    const size_t operations = FURI_STRING_TEST_BENCHMARK_ROUNDS * FURI_STRING_TEST_ARENA_STRINGS;
+    printf(
+        "FuriString alloc, printf and append: heap %lu, arena %lu cycles per string\r\n",
+        (uint32_t)(heap_cycles / operations),
+        (uint32_t)(arena_cycles / operations));
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -460,6 +579,9 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_string_start_end);
     MU_RUN_TEST(mu_test_furi_string_trim);
     MU_RUN_TEST(mu_test_furi_string_utf8);
+    MU_RUN_TEST(mu_test_furi_string_storage);
+    MU_RUN_TEST(mu_test_furi_string_arena);
+    MU_RUN_TEST(mu_test_furi_string_benchmark);
 }
 
 int run_minunit_test_furi_string() {
@@ -9,6 +9,14 @@ void test_furi_concurrent_access();
 void test_furi_pubsub();
 
 void test_furi_memmgr();
+void test_furi_memmgr_slab();
+void test_furi_memmgr_slab_replay();
+
+void test_furi_log_deferred();
+void test_furi_log_binary();
+void test_furi_log_dropped();
+
+void test_furi_thread_accounting();
 
 static int foo = 0;
 
@@ -39,6 +47,30 @@ MU_TEST(mu_test_furi_memmgr) {
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_slab) {
+    test_furi_memmgr_slab();
+}
+
+MU_TEST(mu_test_furi_memmgr_slab_replay) {
+    test_furi_memmgr_slab_replay();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
+}
+
+MU_TEST(mu_test_furi_log_binary) {
+    test_furi_log_binary();
+}
+
+MU_TEST(mu_test_furi_log_dropped) {
+    test_furi_log_dropped();
+}
+
+MU_TEST(mu_test_furi_thread_accounting) {
+    test_furi_thread_accounting();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -48,6 +80,12 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_slab);
+    MU_RUN_TEST(mu_test_furi_memmgr_slab_replay);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
+    MU_RUN_TEST(mu_test_furi_log_binary);
+    MU_RUN_TEST(mu_test_furi_log_dropped);
+    MU_RUN_TEST(mu_test_furi_thread_accounting);
 }
 
 int run_minunit_test_furi() {
@@ -0,0 +1,57 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+
+#define FURI_THREAD_TEST_BUSY_US (20 * 1000)
+#define FURI_THREAD_TEST_ALLOC_SIZE 1024
+
+typedef struct {
+    uint64_t cpu_time;
+    int32_t heap_balance;
+    void* memory;
+} FuriThreadTestAccounting;
+
+static int32_t furi_thread_test_accounting_callback(void* context) {
+    FuriThreadTestAccounting* accounting = context;
+    FuriThreadId thread_id = furi_thread_get_current_id();
+
+    // CPU time of running thread is accounted when it is switched out
+    furi_delay_tick(1);
+    const uint64_t cpu_time = furi_thread_get_cpu_time(thread_id);
+    const int32_t heap_balance = furi_thread_get_heap_balance(thread_id);
+
+    furi_hal_cortex_delay_us(FURI_THREAD_TEST_BUSY_US);
+    accounting->memory = malloc(FURI_THREAD_TEST_ALLOC_SIZE);
+    furi_delay_tick(1);
+
+    accounting->cpu_time = furi_thread_get_cpu_time(thread_id) - cpu_time;
+    accounting->heap_balance = furi_thread_get_heap_balance(thread_id) - heap_balance;
+    return 0;
+}
+
+void test_furi_thread_accounting() {
+    FuriThreadTestAccounting accounting = {0};
+    FuriThread* thread = furi_thread_alloc_ex(
+        "AccountingTest", 1024, furi_thread_test_accounting_callback, &accounting);
+    furi_thread_start(thread);
+    mu_check(furi_thread_join(thread));
+    furi_thread_free(thread);
+
+    // Busy wait is wall clock based, other threads may take part of it
+    const uint64_t busy_cycles =
+        (uint64_t)FURI_THREAD_TEST_BUSY_US * furi_hal_cortex_instructions_per_microsecond();
+    mu_check(accounting.cpu_time >= busy_cycles / 2);
+
+#ifndef FURI_HOST // Host allocations go to libc and are not accounted
+    mu_check(accounting.heap_balance >= FURI_THREAD_TEST_ALLOC_SIZE);
+
+    // Thread that frees memory of others gets negative balance
+    const int32_t heap_balance = furi_thread_get_heap_balance(furi_thread_get_current_id());
+    free(accounting.memory);
+    mu_check(
+        furi_thread_get_heap_balance(furi_thread_get_current_id()) <=
+        heap_balance - FURI_THREAD_TEST_ALLOC_SIZE);
+#else
+    free(accounting.memory);
+#endif
+}
@@ -0,0 +1,276 @@
+#include <furi.h>
+#include <gui/canvas_blit.h>
+
+#include "../minunit.h"
+
+#define TEST_BUFFER_SIZE (128 * 64 / 8)
+#define TEST_BITMAP_SIZE (160 * 96 / 8)
+#define TEST_RANDOM_ITERATIONS (4000)
+#define TEST_BENCHMARK_FRAMES (200)
+
+static const u8x8_display_info_t canvas_blit_test_display_info = {
+    .chip_enable_level = 0,
+    .chip_disable_level = 1,
+    .sck_clock_hz = 1000000,
+    .tile_width = 16,
+    .tile_height = 8,
+    .pixel_width = 128,
+    .pixel_height = 64,
+};
+
+static uint8_t* buffer = NULL;
+static uint8_t* expected = NULL;
+static uint8_t* bitmap = NULL;
+static uint32_t random_state = 0;
+
+static uint8_t
+    canvas_blit_test_display(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+    UNUSED(arg_int);
+    UNUSED(arg_ptr);
+    if(msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) {
+        u8x8_d_helper_display_setup_memory(u8x8, &canvas_blit_test_display_info);
+    }
+    return 1;
+}
+
+static uint32_t canvas_blit_test_random() {
+    random_state = random_state * 1664525 + 1013904223;
+    return random_state >> 8;
+}
+
+static void canvas_blit_test_setup(u8g2_t* u8g2, const u8g2_cb_t* rotation) {
+    u8g2_SetupDisplay(
+        u8g2, canvas_blit_test_display, u8x8_cad_empty, u8x8_byte_empty, u8x8_dummy_cb);
+    u8g2_SetupBuffer(
+        u8g2,
+        buffer,
+        canvas_blit_test_display_info.tile_height,
+        u8g2_ll_hvline_vertical_top_lsb,
+        rotation);
+}
+
+/* Pixel by pixel drawing, same walk as canvas_draw_u8g2_bitmap_int */
+static void canvas_blit_test_reference(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    const uint8_t* data,
+    IconRotation rotation) {
+    const bool mirror = (rotation == IconRotation180 || rotation == IconRotation270);
+    const bool rotate = (rotation == IconRotation90 || rotation == IconRotation270);
+    const u8g2_uint_t row_size = (w + 7) / 8;
+    const uint8_t color = u8g2->draw_color;
+
+    if(rotate && !mirror) {
+        x += w + 1;
+    } else if(mirror && !rotate) {
+        y += h - 1;
+    }
+
+    for(; h > 0; h--) {
+        uint16_t x0 = x;
+        uint16_t y0 = y;
+        for(u8g2_uint_t col = 0; col < w; col++) {
+            if(data[col / 8] & (1 << (col % 8))) {
+                u8g2->draw_color = color;
+                u8g2_DrawHVLine(u8g2, x0, y0, 1, 0);
+            } else if(u8g2->bitmap_transparency == 0) {
+                u8g2->draw_color = (color == 0 ? 1 : 0);
+                u8g2_DrawHVLine(u8g2, x0, y0, 1, 0);
+            }
+
+            if(rotate) {
+                y0++;
+            } else {
+                x0++;
+            }
+        }
+
+        u8g2->draw_color = color;
+        data += row_size;
+
+        if(mirror) {
+            if(rotate) {
+                x++;
+            } else {
+                y--;
+            }
+        } else {
+            if(rotate) {
+                x--;
+            } else {
+                y++;
+            }
+        }
+    }
+}
+
+/* Same decision as canvas_draw_u8g2_bitmap */
+static void canvas_blit_test_draw(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    const uint8_t* data,
+    IconRotation rotation) {
+    if(u8g2_IsIntersection(u8g2, x, y, x + w, y + h) == 0) return;
+    if(!canvas_blit_u8g2_bitmap(u8g2, x, y, w, h, data, rotation)) {
+        canvas_blit_test_reference(u8g2, x, y, w, h, data, rotation);
+    }
+}
+
+static bool canvas_blit_test_compare(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    IconRotation rotation) {
+    for(size_t i = 0; i < TEST_BUFFER_SIZE; i++) {
+        buffer[i] = canvas_blit_test_random();
+    }
+    memcpy(expected, buffer, TEST_BUFFER_SIZE);
+
+    uint8_t* saved = buffer;
+    u8g2->tile_buf_ptr = expected;
+    if(u8g2_IsIntersection(u8g2, x, y, x + w, y + h)) {
+        canvas_blit_test_reference(u8g2, x, y, w, h, bitmap, rotation);
+    }
+    u8g2->tile_buf_ptr = saved;
+    canvas_blit_test_draw(u8g2, x, y, w, h, bitmap, rotation);
+
+    return memcmp(buffer, expected, TEST_BUFFER_SIZE) == 0;
+}
+
+static void canvas_blit_test_alloc() {
+    buffer = malloc(TEST_BUFFER_SIZE);
+    expected = malloc(TEST_BUFFER_SIZE);
+    bitmap = malloc(TEST_BITMAP_SIZE);
+    random_state = 0x12345678;
+    for(size_t i = 0; i < TEST_BITMAP_SIZE; i++) {
+        bitmap[i] = canvas_blit_test_random();
+    }
+}
+
+static void canvas_blit_test_free() {
+    free(buffer);
+    free(expected);
+    free(bitmap);
+}
+
+static const u8g2_cb_t* const canvas_blit_test_rotations[] = {
+    U8G2_R0,
+    U8G2_R1,
+    U8G2_R2,
+    U8G2_R3,
+};
+
+MU_TEST(canvas_blit_test_modes) {
+    u8g2_t u8g2;
+
+    // Every display orientation, bitmap rotation, color and transparency, fully visible
+    for(size_t display = 0; display < COUNT_OF(canvas_blit_test_rotations); display++) {
+        canvas_blit_test_setup(&u8g2, canvas_blit_test_rotations[display]);
+        for(IconRotation rotation = IconRotation0; rotation <= IconRotation270; rotation++) {
+            for(uint8_t color = 0; color < 3; color++) {
+                for(uint8_t transparency = 0; transparency < 2; transparency++) {
+                    u8g2.draw_color = color;
+                    u8g2.bitmap_transparency = transparency;
+                    mu_assert(
+                        canvas_blit_test_compare(&u8g2, 5, 3, 37, 21, rotation),
+                        "Bitmap mismatch");
+                    mu_assert(
+                        canvas_blit_test_compare(&u8g2, 8, 16, 16, 24, rotation),
+                        "Aligned bitmap mismatch");
+                }
+            }
+        }
+    }
+}
+
+MU_TEST(canvas_blit_test_clipping) {
+    u8g2_t u8g2;
+
+    // Random sizes and positions: partially visible, wrapping around and clip windows
+    for(size_t i = 0; i < TEST_RANDOM_ITERATIONS; i++) {
+        const size_t display = canvas_blit_test_random() % COUNT_OF(canvas_blit_test_rotations);
+        canvas_blit_test_setup(&u8g2, canvas_blit_test_rotations[display]);
+        u8g2.draw_color = canvas_blit_test_random() % 3;
+        u8g2.bitmap_transparency = canvas_blit_test_random() % 2;
+        if(canvas_blit_test_random() % 4 == 0) {
+            u8g2_SetClipWindow(
+                &u8g2,
+                canvas_blit_test_random() % 100,
+                canvas_blit_test_random() % 100,
+                canvas_blit_test_random() % 140,
+                canvas_blit_test_random() % 140);
+        }
+
+        u8g2_uint_t x = canvas_blit_test_random() % 256;
+        u8g2_uint_t y = canvas_blit_test_random() % 256;
+        u8g2_uint_t w = canvas_blit_test_random() % 160;
+        u8g2_uint_t h = canvas_blit_test_random() % 96;
+        IconRotation rotation = canvas_blit_test_random() % 4;
+
+        if(!canvas_blit_test_compare(&u8g2, x, y, w, h, rotation)) {
+            FURI_LOG_E(
+                "CanvasBlit",
+                "Mismatch: display %u rotation %u at %u,%u size %ux%u",
+                display,
+                rotation,
+                x,
+                y,
+                w,
+                h);
+            mu_fail("Clipped bitmap mismatch");
+        }
+    }
+}
+
+static uint32_t canvas_blit_test_benchmark_run(u8g2_t* u8g2, uint8_t height, bool blit) {
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < TEST_BENCHMARK_FRAMES; i++) {
+        if(blit) {
+            canvas_blit_test_draw(u8g2, 0, 64 - height, 128, height, bitmap, IconRotation0);
+        } else {
+            canvas_blit_test_reference(u8g2, 0, 64 - height, 128, height, bitmap, IconRotation0);
+        }
+    }
+    return MAX(furi_get_tick() - start, 1UL);
+}
+
+MU_TEST(canvas_blit_test_benchmark) {
+    u8g2_t u8g2;
+    canvas_blit_test_setup(&u8g2, U8G2_R0);
+    u8g2.draw_color = 1;
+    u8g2.bitmap_transparency = 0;
+
+    // Dolphin animation frames are 128 pixels wide, 50 to 64 pixels high
+    const uint8_t heights[] = {64, 51};
+    for(size_t i = 0; i < COUNT_OF(heights); i++) {
+        uint32_t pixel_time = canvas_blit_test_benchmark_run(&u8g2, heights[i], false);
+        uint32_t blit_time = canvas_blit_test_benchmark_run(&u8g2, heights[i], true);
+        printf(
+            "Canvas 128x%u frame: per pixel %lu fps, blit %lu fps\r\n",
+            heights[i],
+            TEST_BENCHMARK_FRAMES * 1000 / pixel_time,
+            TEST_BENCHMARK_FRAMES * 1000 / blit_time);
+        mu_check(blit_time <= pixel_time);
+    }
+}
+
+MU_TEST_SUITE(canvas_blit_suite) {
+    canvas_blit_test_alloc();
+    MU_RUN_TEST(canvas_blit_test_modes);
+    MU_RUN_TEST(canvas_blit_test_clipping);
+    MU_RUN_TEST(canvas_blit_test_benchmark);
+    canvas_blit_test_free();
+}
+
+int run_minunit_test_canvas_blit() {
+    MU_RUN_SUITE(canvas_blit_suite);
+    return MU_EXIT_CODE;
+}
@@ -0,0 +1,129 @@
+#include <furi.h>
+#include <gui/canvas_icon_cache.h>
+#include <gui/icon_i.h>
+#include <assets_icons.h>
+
+#include "../minunit.h"
+
+#define TEST_FRAME_SIZE (128 * 64 / 8)
+
+static CanvasIconCache* cache = NULL;
+static CompressIcon* compress_icon = NULL;
+
+static void canvas_icon_cache_test_setup() {
+    cache = canvas_icon_cache_alloc();
+    compress_icon = compress_icon_alloc();
+}
+
+static void canvas_icon_cache_test_teardown() {
+    canvas_icon_cache_free(cache);
+    compress_icon_free(compress_icon);
+}
+
+static bool canvas_icon_cache_test_is_compressed(const uint8_t* frame) {
+    // First byte of CompressHeader, uncompressed frames are never cached
+    return frame[0] != 0;
+}
+
+MU_TEST(canvas_icon_cache_test_hit) {
+    const uint8_t* frame = icon_get_data(&A_Levelup_128x64);
+    if(!canvas_icon_cache_test_is_compressed(frame)) return;
+
+    uint8_t* expected = malloc(TEST_FRAME_SIZE);
+    uint8_t* decoded = NULL;
+    compress_icon_decode(compress_icon, frame, &decoded);
+    memcpy(expected, decoded, TEST_FRAME_SIZE);
+
+    const uint8_t* first = canvas_icon_cache_decode(cache, compress_icon, frame, TEST_FRAME_SIZE);
+    mu_assert_mem_eq(expected, first, TEST_FRAME_SIZE);
+    const uint8_t* second =
+        canvas_icon_cache_decode(cache, compress_icon, frame, TEST_FRAME_SIZE);
+    mu_assert(first == second, "Cached frame expected");
+    mu_assert_mem_eq(expected, second, TEST_FRAME_SIZE);
+
+    CanvasIconCacheStats stats;
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(1, stats.hits);
+    mu_assert_int_eq(1, stats.misses);
+    mu_assert_int_eq(1, stats.count);
+    mu_assert_int_eq(TEST_FRAME_SIZE, stats.size);
+
+    free(expected);
+}
+
+MU_TEST(canvas_icon_cache_test_lru) {
+    const Icon* icon = &A_Levelup_128x64;
+    const uint8_t* frames[8];
+    size_t frame_count = 0;
+    for(size_t i = 0; i < icon->frame_count && frame_count < COUNT_OF(frames); i++) {
+        if(canvas_icon_cache_test_is_compressed(icon->frames[i])) {
+            frames[frame_count++] = icon->frames[i];
+        }
+    }
+
+    // Full screen frames are bigger than the cache can hold all together
+    for(size_t i = 0; i < frame_count; i++) {
+        canvas_icon_cache_decode(cache, compress_icon, frames[i], TEST_FRAME_SIZE);
+    }
+
+    CanvasIconCacheStats stats;
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(frame_count, stats.misses);
+    mu_assert(stats.count < frame_count, "Cache must be bounded");
+    mu_assert_int_eq(stats.count * TEST_FRAME_SIZE, stats.size);
+
+    // Most recent frame is still there, the oldest one is gone
+    canvas_icon_cache_decode(cache, compress_icon, frames[frame_count - 1], TEST_FRAME_SIZE);
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(1, stats.hits);
+    canvas_icon_cache_decode(cache, compress_icon, frames[0], TEST_FRAME_SIZE);
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(1, stats.hits);
+    mu_assert_int_eq(frame_count + 1, stats.misses);
+
+    canvas_icon_cache_shrink(cache, TEST_FRAME_SIZE);
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(1, stats.count);
+    canvas_icon_cache_decode(cache, compress_icon, frames[0], TEST_FRAME_SIZE);
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(2, stats.hits);
+
+    canvas_icon_cache_shrink(cache, 0);
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(0, stats.count);
+    mu_assert_int_eq(0, stats.size);
+}
+
+MU_TEST(canvas_icon_cache_test_heap_data) {
+    // Icon data in heap may be freed and its address reused for another icon
+    const uint8_t* frame = icon_get_data(&A_Levelup_128x64);
+    if(!canvas_icon_cache_test_is_compressed(frame)) return;
+
+    // CompressHeader is followed by compressed data size
+    const size_t size = 4 + (frame[2] | (frame[3] << 8));
+    uint8_t* copy = malloc(size);
+    memcpy(copy, frame, size);
+
+    canvas_icon_cache_decode(cache, compress_icon, copy, TEST_FRAME_SIZE);
+    canvas_icon_cache_decode(cache, compress_icon, copy, TEST_FRAME_SIZE);
+
+    CanvasIconCacheStats stats;
+    canvas_icon_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(0, stats.hits);
+    mu_assert_int_eq(0, stats.misses);
+    mu_assert_int_eq(0, stats.count);
+
+    free(copy);
+}
+
+MU_TEST_SUITE(canvas_icon_cache_suite) {
+    MU_SUITE_CONFIGURE(&canvas_icon_cache_test_setup, &canvas_icon_cache_test_teardown);
+    MU_RUN_TEST(canvas_icon_cache_test_hit);
+    MU_RUN_TEST(canvas_icon_cache_test_lru);
+    MU_RUN_TEST(canvas_icon_cache_test_heap_data);
+}
+
+int run_minunit_test_canvas_icon_cache() {
+    MU_RUN_SUITE(canvas_icon_cache_suite);
+    return MU_EXIT_CODE;
+}
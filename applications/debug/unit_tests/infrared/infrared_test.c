@@ -8,6 +8,8 @@
 #define IR_TEST_FILE_PREFIX "test_"
 #define IR_TEST_FILE_SUFFIX ".irtest"
 
+#define IR_TEST_BENCHMARK_ROUNDS 20
+
 typedef struct {
     InfraredDecoderHandler* decoder_handler;
     InfraredEncoderHandler* encoder_handler;
@@ -509,6 +511,127 @@ MU_TEST(infrared_test_decoder_rca) {
     infrared_test_run_decoder(InfraredProtocolRCA, 6);
 }
 
+static uint32_t infrared_test_checksum_message(uint32_t checksum, const InfraredMessage* message) {
+    checksum = checksum * 31 + message->protocol;
+    checksum = checksum * 31 + message->address;
+    checksum = checksum * 31 + message->command;
+    return checksum * 31 + message->repeat;
+}
+
+/* Decode signal as infrared worker does, returns count of decoded messages */
+static uint32_t infrared_test_replay_signal(
+    const uint32_t* timings,
+    uint32_t timings_count,
+    uint32_t* checksum) {
+    const InfraredMessage* message;
+    uint32_t message_counter = 0;
+    bool level = 0;
+
+    infrared_reset_decoder(test->decoder_handler);
+    for(uint32_t i = 0; i < timings_count; ++i) {
+        if(timings[i] > INFRARED_RAW_RX_TIMING_DELAY_US) {
+            message = infrared_check_decoder_ready(test->decoder_handler);
+            if(message) {
+                *checksum = infrared_test_checksum_message(*checksum, message);
+                ++message_counter;
+            }
+        }
+        message = infrared_decode(test->decoder_handler, level, timings[i]);
+        if(message) {
+            *checksum = infrared_test_checksum_message(*checksum, message);
+            ++message_counter;
+        }
+        level = !level;
+    }
+
+    message = infrared_check_decoder_ready(test->decoder_handler);
+    if(message) {
+        *checksum = infrared_test_checksum_message(*checksum, message);
+        ++message_counter;
+    }
+
+    return message_counter;
+}
+
+MU_TEST(infrared_test_decoder_prefilter_benchmark) {
+    static const struct {
+        InfraredProtocol protocol;
+        uint32_t test_index;
+    } datasets[] = {
+        {InfraredProtocolNEC, 1},
+        {InfraredProtocolNEC, 2},
+        {InfraredProtocolNEC, 3},
+        {InfraredProtocolNECext, 1},
+        {InfraredProtocolNEC42ext, 1},
+        {InfraredProtocolNEC42ext, 2},
+        {InfraredProtocolSamsung32, 1},
+        {InfraredProtocolRC6, 1},
+        {InfraredProtocolRC6, 2},
+        {InfraredProtocolRC5X, 1},
+        {InfraredProtocolRC5, 1},
+        {InfraredProtocolRC5, 5},
+        {InfraredProtocolSIRC, 1},
+        {InfraredProtocolSIRC, 3},
+        {InfraredProtocolSIRC, 5},
+        {InfraredProtocolKaseikyo, 1},
+        {InfraredProtocolKaseikyo, 6},
+        {InfraredProtocolRCA, 1},
+        {InfraredProtocolRCA, 6},
+    };
+
+    FuriString* buf = furi_string_alloc();
+    uint32_t time[2] = {0, 0};
+    uint32_t timings_total = 0;
+
+    for(size_t i = 0; i < COUNT_OF(datasets); ++i) {
+        uint32_t* timings;
+        uint32_t timings_count;
+
+        mu_assert(
+            infrared_test_prepare_file(infrared_get_protocol_name(datasets[i].protocol)),
+            "Failed to prepare test file");
+        furi_string_printf(buf, "decoder_input%ld", datasets[i].test_index);
+        mu_assert(
+            infrared_test_load_raw_signal(
+                test->ff, furi_string_get_cstr(buf), &timings, &timings_count),
+            "Failed to load raw signal from file");
+        flipper_format_buffered_file_close(test->ff);
+
+        // Same messages have to be decoded with and without prefilter
+        uint32_t message_count[2];
+        uint32_t checksum[2] = {0, 0};
+        for(size_t prefilter = 0; prefilter < 2; ++prefilter) {
+            infrared_set_decoder_prefilter(test->decoder_handler, prefilter);
+            message_count[prefilter] =
+                infrared_test_replay_signal(timings, timings_count, &checksum[prefilter]);
+
+            uint32_t start = furi_get_tick();
+            for(size_t round = 0; round < IR_TEST_BENCHMARK_ROUNDS; ++round) {
+                uint32_t dummy = 0;
+                infrared_test_replay_signal(timings, timings_count, &dummy);
+            }
+            time[prefilter] += furi_get_tick() - start;
+        }
+
+        mu_assert(message_count[0] > 0, "Nothing decoded");
+        mu_assert_int_eq(message_count[0], message_count[1]);
+        mu_assert_int_eq(checksum[0], checksum[1]);
+
+        timings_total += timings_count;
+        free(timings);
+    }
+
+    infrared_set_decoder_prefilter(test->decoder_handler, true);
+    furi_string_free(buf);
+
+    printf(
+        "IR decoder %lu timings x %u: all decoders %lu ms, prefilter %lu ms\r\n",
+        timings_total,
+        IR_TEST_BENCHMARK_ROUNDS,
+        time[0],
+        time[1]);
+}
+
 MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolNEC, 1);
     infrared_test_run_encoder_decoder(InfraredProtocolNECext, 1);
@@ -540,6 +663,7 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_kaseikyo);
     MU_RUN_TEST(infrared_test_decoder_rca);
     MU_RUN_TEST(infrared_test_decoder_mixed);
+    MU_RUN_TEST(infrared_test_decoder_prefilter_benchmark);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
 }
 
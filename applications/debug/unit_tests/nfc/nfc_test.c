@@ -21,6 +21,9 @@
 
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
+#define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_LEGACY_INDEX_PATH \
+    NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH KEYS_DICT_INDEX_EXTENSION
+#define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_BATCH (8)
 
 typedef struct {
     Storage* storage;
@@ -437,11 +440,14 @@ static void mf_classic_value_block() {
 
 MU_TEST(mf_classic_dict_test) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* index_path = furi_string_alloc();
+    keys_dict_get_index_path(NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, index_path);
     if(storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NULL) == FSE_OK) {
         mu_assert(
             storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
             "Remove test dict failed");
     }
+    storage_simply_remove(storage, furi_string_get_cstr(index_path));
 
     KeysDict* dict = keys_dict_alloc(
         NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
@@ -502,6 +508,215 @@ MU_TEST(mf_classic_dict_test) {
     mu_assert(
         storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
         "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, furi_string_get_cstr(index_path)),
+        "Remove test dict index failed");
+
+    furi_string_free(index_path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(mf_classic_dict_bulk_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* index_path = furi_string_alloc();
+    keys_dict_get_index_path(NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, index_path);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH);
+    storage_simply_remove(storage, furi_string_get_cstr(index_path));
+
+    const size_t test_key_num = 40;
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    for(size_t i = 0; i < test_key_num; i++) {
+        furi_hal_random_fill_buf(key_arr_ref[i].data, sizeof(MfClassicKey));
+    }
+    // Duplicates within the batch
+    key_arr_ref[5] = key_arr_ref[2];
+    key_arr_ref[17] = key_arr_ref[2];
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_add_keys(dict, key_arr_ref[0].data, test_key_num / 2, sizeof(MfClassicKey)) ==
+            test_key_num / 2 - 2,
+        "keys_dict_add_keys() failed");
+    // Half of the keys are already present
+    mu_assert(
+        keys_dict_add_keys(dict, key_arr_ref[0].data, test_key_num, sizeof(MfClassicKey)) ==
+            test_key_num / 2,
+        "keys_dict_add_keys() merge failed");
+    mu_assert(
+        keys_dict_get_total_keys(dict) == test_key_num - 2, "keys_dict_keys_total() failed");
+    keys_dict_free(dict);
+
+    // Index is built on close, then reused
+    for(size_t pass = 0; pass < 2; pass++) {
+        dict = keys_dict_alloc(
+            NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH,
+            KeysDictModeOpenExisting,
+            sizeof(MfClassicKey));
+        mu_assert(
+            keys_dict_get_total_keys(dict) == test_key_num - 2, "keys_dict_keys_total() failed");
+
+        MfClassicKey batch[NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_BATCH];
+        size_t key_idx = 0;
+        size_t batch_size = 0;
+        while((batch_size = keys_dict_get_next_keys(
+                   dict, batch[0].data, COUNT_OF(batch), sizeof(MfClassicKey))) > 0) {
+            for(size_t i = 0; i < batch_size; i++) {
+                if(key_idx == 5 || key_idx == 17) key_idx++;
+                mu_assert(
+                    memcmp(key_arr_ref[key_idx].data, batch[i].data, sizeof(MfClassicKey)) == 0,
+                    "Loaded key data mismatch");
+                key_idx++;
+            }
+        }
+        mu_assert(key_idx == test_key_num, "keys_dict_get_next_keys() failed");
+
+        for(size_t i = 0; i < test_key_num; i++) {
+            mu_assert(
+                keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)),
+                "keys_dict_is_key_present() failed");
+        }
+        MfClassicKey key_absent = key_arr_ref[0];
+        key_absent.data[0] ^= 0xFF;
+        mu_assert(
+            !keys_dict_is_key_present(dict, key_absent.data, sizeof(MfClassicKey)),
+            "keys_dict_is_key_present() false positive");
+
+        keys_dict_free(dict);
+        mu_assert(
+            storage_common_stat(storage, furi_string_get_cstr(index_path), NULL) ==
+                FSE_OK,
+            "Dict index not created");
+    }
+
+    free(key_arr_ref);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, furi_string_get_cstr(index_path)),
+        "Remove test dict index failed");
+
+    furi_string_free(index_path);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static uint64_t mf_classic_dict_index_size(Storage* storage, FuriString* index_path) {
+    FileInfo info = {0};
+    storage_common_stat(storage, furi_string_get_cstr(index_path), &info);
+    return info.size;
+}
+
+// Rebuild truncates the index, reused index keeps the byte
+static bool mf_classic_dict_index_pad(Storage* storage, FuriString* index_path) {
+    File* file = storage_file_alloc(storage);
+    const uint8_t pad = 0;
+    bool padded =
+        storage_file_open(file, furi_string_get_cstr(index_path), FSAM_WRITE, FSOM_OPEN_APPEND) &&
+        storage_file_write(file, &pad, sizeof(pad)) == sizeof(pad);
+    storage_file_free(file);
+    return padded;
+}
+
+MU_TEST(mf_classic_dict_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* index_path = furi_string_alloc();
+    keys_dict_get_index_path(NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, index_path);
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH);
+    storage_simply_remove(storage, furi_string_get_cstr(index_path));
+
+    const size_t test_key_num = 20;
+    const size_t test_key_read = 5;
+    MfClassicKey* key_arr_ref = malloc((test_key_num + 1) * sizeof(MfClassicKey));
+    furi_hal_random_fill_buf(key_arr_ref[0].data, (test_key_num + 1) * sizeof(MfClassicKey));
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_add_keys(dict, key_arr_ref[0].data, test_key_num, sizeof(MfClassicKey)) ==
+            test_key_num,
+        "keys_dict_add_keys() failed");
+    keys_dict_free(dict);
+
+    // Read only dictionaries are indexed in cache folder, nothing is created next to them
+    storage_simply_remove(storage, furi_string_get_cstr(index_path));
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(keys_dict_get_total_keys(dict) == test_key_num, "keys_dict_keys_total() failed");
+    mu_assert(
+        keys_dict_is_key_present(dict, key_arr_ref[test_key_num - 1].data, sizeof(MfClassicKey)),
+        "keys_dict_is_key_present() failed");
+    keys_dict_free(dict);
+    const uint64_t index_size = mf_classic_dict_index_size(storage, index_path);
+    mu_assert(index_size > 0, "Dict index not created");
+    mu_assert(
+        storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_LEGACY_INDEX_PATH, NULL) ==
+            FSE_NOT_EXIST,
+        "Index created next to dict");
+
+    // Unchanged dictionary reuses index
+    mu_assert(mf_classic_dict_index_pad(storage, index_path), "Dict index pad failed");
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    keys_dict_free(dict);
+    mu_assert(
+        mf_classic_dict_index_size(storage, index_path) == index_size + 1, "Dict index rebuilt");
+
+    // Key added in the middle of iteration comes last, index is not rewritten until close
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+
+    MfClassicKey key_dut = {};
+    size_t key_idx = 0;
+    for(; key_idx < test_key_read; key_idx++) {
+        mu_assert(
+            keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey)),
+            "keys_dict_get_next_key() failed");
+    }
+    const MfClassicKey* key_new = &key_arr_ref[test_key_num];
+    mu_assert(keys_dict_add_key(dict, key_new->data, sizeof(MfClassicKey)), "add key failed");
+    mu_assert(
+        keys_dict_is_key_present(dict, key_new->data, sizeof(MfClassicKey)),
+        "keys_dict_is_key_present() failed");
+    mu_assert(
+        mf_classic_dict_index_size(storage, index_path) == index_size + 1,
+        "Dict index rewritten");
+
+    while(keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey))) {
+        mu_assert(key_idx <= test_key_num, "keys_dict_get_next_key() repeats keys");
+        mu_assert(
+            memcmp(key_arr_ref[key_idx].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+            "Loaded key data mismatch");
+        key_idx++;
+    }
+    mu_assert(key_idx == test_key_num + 1, "keys_dict_get_next_key() failed");
+    keys_dict_free(dict);
+    const uint64_t updated_size = mf_classic_dict_index_size(storage, index_path);
+    mu_assert(updated_size > index_size + 1, "Dict index not updated");
+
+    // Index updated on close matches dictionary as it is after close
+    mu_assert(mf_classic_dict_index_pad(storage, index_path), "Dict index pad failed");
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(
+        keys_dict_get_total_keys(dict) == test_key_num + 1, "keys_dict_keys_total() failed");
+    keys_dict_free(dict);
+    mu_assert(
+        mf_classic_dict_index_size(storage, index_path) == updated_size + 1,
+        "Dict index rebuilt after update");
+
+    free(key_arr_ref);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(storage, furi_string_get_cstr(index_path)),
+        "Remove test dict index failed");
+
+    furi_string_free(index_path);
+    furi_record_close(RECORD_STORAGE);
 }
 
 MU_TEST_SUITE(nfc) {
@@ -544,6 +759,8 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_value_block);
 
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_bulk_test);
+    MU_RUN_TEST(mf_classic_dict_index_test);
 
     nfc_test_free();
 }
@@ -51,6 +51,7 @@ static RpcSessionContext rpc_session[TEST_RPC_SESSIONS];
 #define MAX_RECEIVE_OUTPUT_TIMEOUT 3000
 #define MAX_NAME_LENGTH 254
 #define MAX_DATA_SIZE 512u // have to be exact as in rpc_storage.c
+#define USB_READ_DATA_SIZE 4096u // have to be exact as in rpc_storage.c
 #define TEST_DIR TEST_DIR_NAME "/"
 #define TEST_DIR_NAME EXT_PATH("unit_tests_tmp")
 #define MD5SUM_SIZE 16
@@ -104,12 +105,12 @@ static void test_rpc_setup(void) {
     rpc_session_set_context(rpc_session[0].session, &rpc_session[0]);
 }
 
-static void test_rpc_setup_second_session(void) {
+static void test_rpc_setup_second_session(RpcOwner owner) {
     furi_check(rpc);
     furi_check(!(rpc_session[1].session));
 
     for(int i = 0; !(rpc_session[1].session) && (i < 10000); ++i) {
-        rpc_session[1].session = rpc_session_open(rpc, RpcOwnerUnknown);
+        rpc_session[1].session = rpc_session_open(rpc, owner);
         furi_delay_tick(1);
     }
     furi_check(rpc_session[1].session);
@@ -798,6 +799,7 @@ static void
 static void test_rpc_add_read_to_list_by_reading_real_file(
     MsgList_t msg_list,
     const char* path,
+    size_t chunk_size,
     uint32_t command_id) {
     furi_check(MsgList_empty_p(msg_list));
     Storage* fs_api = furi_record_open(RECORD_STORAGE);
@@ -817,10 +819,10 @@ static void test_rpc_add_read_to_list_by_reading_real_file(
             response->content.storage_read_response.has_file = true;
 
             response->content.storage_read_response.file.data =
-                malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MIN(size_left, MAX_DATA_SIZE)));
+                malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MIN(size_left, chunk_size)));
             uint8_t* buffer = response->content.storage_read_response.file.data->bytes;
             uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
+            size_t read_size = MIN(size_left, chunk_size);
             *read_size_msg = storage_file_read(file, buffer, read_size);
             size_left -= read_size;
             result = (*read_size_msg == read_size);
@@ -844,20 +846,29 @@ static void test_rpc_add_read_to_list_by_reading_real_file(
     furi_record_close(RECORD_STORAGE);
 }
 
-static void test_storage_read_run(const char* path, uint32_t command_id) {
+static void test_storage_read_run_session(
+    const char* path,
+    uint8_t session,
+    size_t chunk_size,
+    uint32_t command_id) {
     PB_Main request;
     MsgList_t expected_msg_list;
     MsgList_init(expected_msg_list);
 
-    test_rpc_add_read_to_list_by_reading_real_file(expected_msg_list, path, command_id);
+    test_rpc_add_read_to_list_by_reading_real_file(
+        expected_msg_list, path, chunk_size, command_id);
     test_rpc_create_simple_message(&request, PB_Main_storage_read_request_tag, path, command_id);
-    test_rpc_encode_and_feed_one(&request, 0);
-    test_rpc_decode_and_compare(expected_msg_list, 0);
+    test_rpc_encode_and_feed_one(&request, session);
+    test_rpc_decode_and_compare(expected_msg_list, session);
 
     pb_release(&PB_Main_msg, &request);
     test_rpc_free_msg_list(expected_msg_list);
 }
 
+static void test_storage_read_run(const char* path, uint32_t command_id) {
+    test_storage_read_run_session(path, 0, MAX_DATA_SIZE, command_id);
+}
+
 static bool test_is_exists(const char* path) {
     Storage* fs_api = furi_record_open(RECORD_STORAGE);
     FileInfo fileinfo;
@@ -996,12 +1007,29 @@ MU_TEST(test_storage_read) {
     test_create_file(TEST_DIR "file2.txt", MAX_DATA_SIZE);
     test_create_file(TEST_DIR "file3.txt", MAX_DATA_SIZE + 1);
     test_create_file(TEST_DIR "file4.txt", (MAX_DATA_SIZE * 2) + 1);
+    test_create_file(TEST_DIR "file5.txt", (MAX_DATA_SIZE * 9) + 3);
 
     test_storage_read_run(TEST_DIR "empty.txt", ++command_id);
     test_storage_read_run(TEST_DIR "file1.txt", ++command_id);
     test_storage_read_run(TEST_DIR "file2.txt", ++command_id);
     test_storage_read_run(TEST_DIR "file3.txt", ++command_id);
     test_storage_read_run(TEST_DIR "file4.txt", ++command_id);
+    test_storage_read_run(TEST_DIR "file5.txt", ++command_id);
+}
+
+MU_TEST(test_storage_read_usb) {
+    // USB sessions read in bigger chunks while heap has room for them
+    mu_check(memmgr_heap_get_max_free_block() > USB_READ_DATA_SIZE * 8);
+
+    test_create_file(TEST_DIR "file1.txt", USB_READ_DATA_SIZE);
+    test_create_file(TEST_DIR "file2.txt", USB_READ_DATA_SIZE + 1);
+    test_create_file(TEST_DIR "file3.txt", (USB_READ_DATA_SIZE * 2) + 3);
+
+    test_rpc_setup_second_session(RpcOwnerUsb);
+    test_storage_read_run_session(TEST_DIR "file1.txt", 1, USB_READ_DATA_SIZE, ++command_id);
+    test_storage_read_run_session(TEST_DIR "file2.txt", 1, USB_READ_DATA_SIZE, ++command_id);
+    test_storage_read_run_session(TEST_DIR "file3.txt", 1, USB_READ_DATA_SIZE, ++command_id);
+    test_rpc_teardown_second_session();
 }
 
 static void test_storage_write_run(
@@ -1498,6 +1526,7 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_list_md5);
     MU_RUN_TEST(test_storage_list_size);
     MU_RUN_TEST(test_storage_read);
+    MU_RUN_TEST(test_storage_read_usb);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
     MU_RUN_TEST(test_storage_delete);
@@ -1744,10 +1773,10 @@ MU_TEST(test_rpc_multisession_ping) {
 
     test_rpc_setup();
 
-    test_rpc_setup_second_session();
+    test_rpc_setup_second_session(RpcOwnerUnknown);
     test_rpc_teardown_second_session();
 
-    test_rpc_setup_second_session();
+    test_rpc_setup_second_session(RpcOwnerUnknown);
 
     test_rpc_add_ping_to_list(input_0, PING_REQUEST, 0);
     test_rpc_add_ping_to_list(input_1, PING_REQUEST, 1);
@@ -1779,7 +1808,7 @@ MU_TEST(test_rpc_multisession_storage) {
     MsgList_init(expected_1);
 
     test_rpc_storage_setup();
-    test_rpc_setup_second_session();
+    test_rpc_setup_second_session(RpcOwnerUnknown);
 
     uint8_t pattern[16] = "0123456789abcdef";
 
@@ -0,0 +1,226 @@
+#include <furi.h>
+#include <sector_cache.h>
+
+#include "../minunit.h"
+
+#define TEST_SECTORS_COUNT (64)
+
+typedef struct {
+    uint8_t data[TEST_SECTORS_COUNT][SECTOR_CACHE_SECTOR_SIZE];
+    size_t reads;
+    size_t read_sectors;
+    size_t writes;
+    bool fail;
+} SectorCacheTestDevice;
+
+static SectorCacheTestDevice* device = NULL;
+static void* cache_memory = NULL;
+
+static bool sector_cache_test_read(void* context, uint8_t* data, uint32_t sector, uint32_t count) {
+    SectorCacheTestDevice* test_device = context;
+    if(test_device->fail || sector + count > TEST_SECTORS_COUNT) return false;
+    memcpy(data, test_device->data[sector], count * SECTOR_CACHE_SECTOR_SIZE);
+    test_device->reads++;
+    test_device->read_sectors += count;
+    return true;
+}
+
+static bool sector_cache_test_write(
+    void* context,
+    const uint8_t* data,
+    uint32_t sector,
+    uint32_t count) {
+    SectorCacheTestDevice* test_device = context;
+    if(test_device->fail || sector + count > TEST_SECTORS_COUNT) return false;
+    memcpy(test_device->data[sector], data, count * SECTOR_CACHE_SECTOR_SIZE);
+    test_device->writes++;
+    return true;
+}
+
+static SectorCache* sector_cache_test_alloc(const SectorCacheConfig* config) {
+    device = malloc(sizeof(SectorCacheTestDevice));
+    for(size_t i = 0; i < TEST_SECTORS_COUNT; i++) {
+        memset(device->data[i], i, SECTOR_CACHE_SECTOR_SIZE);
+    }
+
+    cache_memory = malloc(sector_cache_get_memory_size(config));
+    SectorCache* cache = sector_cache_init(
+        cache_memory, config, sector_cache_test_read, sector_cache_test_write, device);
+    sector_cache_set_sectors_count(cache, TEST_SECTORS_COUNT);
+    return cache;
+}
+
+static void sector_cache_test_free(void) {
+    free(cache_memory);
+    free(device);
+}
+
+static bool sector_cache_test_check(const uint8_t* data, uint8_t value, size_t count) {
+    for(size_t i = 0; i < count * SECTOR_CACHE_SECTOR_SIZE; i++) {
+        if(data[i] != value + i / SECTOR_CACHE_SECTOR_SIZE) return false;
+    }
+    return true;
+}
+
+MU_TEST(sector_cache_lru_test) {
+    SectorCacheConfig config = {.sets = 2, .ways = 2, .prefetch = 0, .write_back = false};
+    SectorCache* cache = sector_cache_test_alloc(&config);
+    uint8_t buffer[SECTOR_CACHE_SECTOR_SIZE];
+    SectorCacheStats stats;
+
+    // Sectors 0, 2 and 4 share set 0
+    mu_check(sector_cache_read(cache, buffer, 0, 1));
+    mu_check(sector_cache_read(cache, buffer, 2, 1));
+    mu_check(sector_cache_read(cache, buffer, 0, 1));
+    mu_assert_int_eq(2, device->reads);
+    mu_check(sector_cache_test_check(buffer, 0, 1));
+
+    // 2 is least recently used and goes out
+    mu_check(sector_cache_read(cache, buffer, 4, 1));
+    mu_check(sector_cache_read(cache, buffer, 0, 1));
+    mu_assert_int_eq(3, device->reads);
+    mu_check(sector_cache_read(cache, buffer, 2, 1));
+    mu_assert_int_eq(4, device->reads);
+    mu_check(sector_cache_test_check(buffer, 2, 1));
+
+    sector_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(2, stats.hits);
+    mu_assert_int_eq(4, stats.misses);
+    mu_assert_int_eq(2, stats.evictions);
+
+    // Priority sector survives even being least recently used
+    sector_cache_invalidate(cache);
+    sector_cache_set_priority_range(cache, 0, 1);
+    mu_check(sector_cache_read(cache, buffer, 0, 1));
+    mu_check(sector_cache_read(cache, buffer, 2, 1));
+    mu_check(sector_cache_read(cache, buffer, 4, 1));
+    mu_check(sector_cache_read(cache, buffer, 6, 1));
+    size_t reads = device->reads;
+    mu_check(sector_cache_read(cache, buffer, 0, 1));
+    mu_assert_int_eq(reads, device->reads);
+    mu_check(sector_cache_test_check(buffer, 0, 1));
+
+    sector_cache_test_free();
+}
+
+MU_TEST(sector_cache_multi_sector_test) {
+    SectorCacheConfig config = {.sets = 4, .ways = 2, .prefetch = 0, .write_back = false};
+    SectorCache* cache = sector_cache_test_alloc(&config);
+    uint8_t* buffer = malloc(8 * SECTOR_CACHE_SECTOR_SIZE);
+
+    mu_check(sector_cache_read(cache, buffer, 12, 1));
+
+    // Cached sector in the middle splits device requests
+    mu_check(sector_cache_read(cache, buffer, 10, 5));
+    mu_check(sector_cache_test_check(buffer, 10, 5));
+    mu_assert_int_eq(3, device->reads);
+
+    // Bulk reads are not cached
+    mu_check(sector_cache_read(cache, buffer, 10, 1));
+    mu_assert_int_eq(4, device->reads);
+
+    // Multi sector write updates cached copies
+    for(size_t i = 0; i < 4 * SECTOR_CACHE_SECTOR_SIZE; i++) {
+        buffer[i] = 40 + i / SECTOR_CACHE_SECTOR_SIZE;
+    }
+    mu_check(sector_cache_write(cache, buffer, 10, 4));
+    mu_check(sector_cache_read(cache, buffer, 12, 1));
+    mu_check(sector_cache_test_check(buffer, 42, 1));
+    mu_assert_int_eq(4, device->reads);
+
+    // Failed write drops cached copies
+    device->fail = true;
+    mu_check(!sector_cache_write(cache, buffer, 12, 1));
+    device->fail = false;
+    mu_check(sector_cache_read(cache, buffer, 12, 1));
+    mu_assert_int_eq(5, device->reads);
+
+    free(buffer);
+    sector_cache_test_free();
+}
+
+MU_TEST(sector_cache_read_ahead_test) {
+    SectorCacheConfig config = {.sets = 8, .ways = 2, .prefetch = 3, .write_back = false};
+    SectorCache* cache = sector_cache_test_alloc(&config);
+    uint8_t buffer[SECTOR_CACHE_SECTOR_SIZE];
+    SectorCacheStats stats;
+
+    // Sequential scan: one device request per prefetch + 1 sectors
+    for(uint32_t sector = 20; sector < 29; sector++) {
+        mu_check(sector_cache_read(cache, buffer, sector, 1));
+        mu_check(sector_cache_test_check(buffer, sector, 1));
+    }
+    mu_assert_int_eq(3, device->reads);
+
+    sector_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(6, stats.prefetched);
+
+    // Never past the device end
+    sector_cache_invalidate(cache);
+    device->reads = 0;
+    device->read_sectors = 0;
+    for(uint32_t sector = TEST_SECTORS_COUNT - 3; sector < TEST_SECTORS_COUNT; sector++) {
+        mu_check(sector_cache_read(cache, buffer, sector, 1));
+        mu_check(sector_cache_test_check(buffer, sector, 1));
+    }
+    mu_assert_int_eq(3, device->read_sectors);
+
+    sector_cache_test_free();
+}
+
+MU_TEST(sector_cache_write_back_test) {
+    SectorCacheConfig config = {.sets = 2, .ways = 2, .prefetch = 0, .write_back = true};
+    SectorCache* cache = sector_cache_test_alloc(&config);
+    uint8_t buffer[SECTOR_CACHE_SECTOR_SIZE];
+    SectorCacheStats stats;
+
+    // Repeated writes of one sector reach the device once
+    for(size_t i = 0; i < 10; i++) {
+        memset(buffer, 100 + i, sizeof(buffer));
+        mu_check(sector_cache_write(cache, buffer, 3, 1));
+    }
+    mu_assert_int_eq(0, device->writes);
+    mu_check(sector_cache_read(cache, buffer, 3, 1));
+    mu_check(sector_cache_test_check(buffer, 109, 1));
+    mu_assert_int_eq(0, device->reads);
+
+    mu_check(sector_cache_flush(cache));
+    mu_assert_int_eq(1, device->writes);
+    mu_check(sector_cache_test_check(device->data[3], 109, 1));
+    mu_check(sector_cache_flush(cache));
+    mu_assert_int_eq(1, device->writes);
+
+    // Dirty victim is written on eviction
+    memset(buffer, 200, sizeof(buffer));
+    mu_check(sector_cache_write(cache, buffer, 5, 1));
+    mu_check(sector_cache_read(cache, buffer, 7, 1));
+    mu_check(sector_cache_read(cache, buffer, 9, 1));
+    mu_check(sector_cache_read(cache, buffer, 11, 1));
+    mu_check(sector_cache_test_check(device->data[5], 200, 1));
+
+    // Failed flush keeps data dirty
+    memset(buffer, 201, sizeof(buffer));
+    mu_check(sector_cache_write(cache, buffer, 5, 1));
+    device->fail = true;
+    mu_check(!sector_cache_flush(cache));
+    device->fail = false;
+    mu_check(sector_cache_flush(cache));
+    mu_check(sector_cache_test_check(device->data[5], 201, 1));
+
+    sector_cache_get_stats(cache, &stats);
+    mu_assert_int_eq(3, stats.write_backs);
+
+    sector_cache_test_free();
+}
+
+MU_TEST_SUITE(sector_cache_suite) {
+    MU_RUN_TEST(sector_cache_lru_test);
+    MU_RUN_TEST(sector_cache_multi_sector_test);
+    MU_RUN_TEST(sector_cache_read_ahead_test);
+    MU_RUN_TEST(sector_cache_write_back_test);
+}
+
+int run_minunit_test_sector_cache() {
+    MU_RUN_SUITE(sector_cache_suite);
+    return MU_EXIT_CODE;
+}
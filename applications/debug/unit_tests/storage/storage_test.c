@@ -1,6 +1,7 @@
 #include "../minunit.h"
 #include <furi.h>
 #include <storage/storage.h>
+#include <toolbox/stream/buffered_file_stream.h>
 
 // DO NOT USE THIS IN PRODUCTION CODE
 // This is a hack to access internal storage functions and definitions
@@ -13,6 +14,11 @@
 
 #define STORAGE_TEST_DIR UNIT_TESTS_PATH("test_dir")
 
+#define STORAGE_BENCHMARK_FILE UNIT_TESTS_PATH("storage_benchmark.test")
+#define STORAGE_BENCHMARK_SIZE (32 * 1024)
+#define STORAGE_BENCHMARK_SMALL_READ (64)
+#define STORAGE_BENCHMARK_VECTORS (16)
+
 static bool storage_file_create(Storage* storage, const char* path, const char* data) {
     File* file = storage_file_alloc(storage);
     bool result = false;
@@ -175,6 +181,144 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(storage_file_vector) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* filename = UNIT_TESTS_PATH("storage_vector.test");
+
+    const size_t sizes[] = {100, 700, 1500};
+    const size_t total = 100 + 700 + 1500;
+    uint8_t* data = malloc(total);
+    for(size_t i = 0; i < total; i++) {
+        data[i] = (i % 113);
+    }
+
+    StorageIoVector vectors[COUNT_OF(sizes)];
+    size_t offset = 0;
+    for(size_t i = 0; i < COUNT_OF(sizes); i++) {
+        vectors[i].buff = data + offset;
+        vectors[i].size = sizes[i];
+        offset += sizes[i];
+    }
+
+    mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(total, storage_file_writev(file, vectors, COUNT_OF(vectors)));
+    mu_check(storage_file_close(file));
+
+    // Read past the end: second buffer is filled partially
+    uint8_t* buffer = malloc(3000);
+    memset(buffer, 0, 3000);
+    StorageIoVector read_vectors[] = {
+        {.buff = buffer, .size = 1000},
+        {.buff = buffer + 1000, .size = 2000},
+    };
+    mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(total, storage_file_readv(file, read_vectors, COUNT_OF(read_vectors)));
+    mu_assert_int_eq(FSE_OK, storage_file_get_error(file));
+    mu_assert_mem_eq(data, buffer, total);
+    mu_assert_int_eq(0, storage_file_readv(file, read_vectors, COUNT_OF(read_vectors)));
+    mu_check(storage_file_close(file));
+
+    free(buffer);
+    free(data);
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void storage_benchmark_print(const char* name, size_t calls, size_t size, uint32_t time) {
+    time = MAX(time, 1UL);
+    printf(
+        "Storage %s: %u calls, %lu calls/s, %lu KiB/s\r\n",
+        name,
+        calls,
+        (uint32_t)(calls * 1000 / time),
+        (uint32_t)((uint64_t)size * 1000 / 1024 / time));
+}
+
+MU_TEST(storage_file_read_benchmark) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(STORAGE_BENCHMARK_SIZE);
+    for(size_t i = 0; i < STORAGE_BENCHMARK_SIZE; i++) {
+        data[i] = (i % 113);
+    }
+
+    mu_check(storage_file_open(file, STORAGE_BENCHMARK_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(
+        STORAGE_BENCHMARK_SIZE, storage_file_write(file, data, STORAGE_BENCHMARK_SIZE));
+    mu_check(storage_file_close(file));
+
+    // Small reads, one storage request each
+    const size_t small_calls = STORAGE_BENCHMARK_SIZE / STORAGE_BENCHMARK_SMALL_READ;
+    mu_check(storage_file_open(file, STORAGE_BENCHMARK_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < small_calls; i++) {
+        mu_assert_int_eq(
+            STORAGE_BENCHMARK_SMALL_READ,
+            storage_file_read(
+                file, data + i * STORAGE_BENCHMARK_SMALL_READ, STORAGE_BENCHMARK_SMALL_READ));
+    }
+    storage_benchmark_print(
+        "small read", small_calls, STORAGE_BENCHMARK_SIZE, furi_get_tick() - start);
+    mu_check(storage_file_close(file));
+
+    // Same small reads batched in vectors
+    const size_t vector_calls = small_calls / STORAGE_BENCHMARK_VECTORS;
+    StorageIoVector vectors[STORAGE_BENCHMARK_VECTORS];
+    mu_check(storage_file_open(file, STORAGE_BENCHMARK_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    start = furi_get_tick();
+    for(size_t i = 0; i < vector_calls; i++) {
+        for(size_t j = 0; j < STORAGE_BENCHMARK_VECTORS; j++) {
+            vectors[j].buff =
+                data + (i * STORAGE_BENCHMARK_VECTORS + j) * STORAGE_BENCHMARK_SMALL_READ;
+            vectors[j].size = STORAGE_BENCHMARK_SMALL_READ;
+        }
+        mu_assert_int_eq(
+            STORAGE_BENCHMARK_VECTORS * STORAGE_BENCHMARK_SMALL_READ,
+            storage_file_readv(file, vectors, STORAGE_BENCHMARK_VECTORS));
+    }
+    storage_benchmark_print(
+        "vector read", vector_calls, STORAGE_BENCHMARK_SIZE, furi_get_tick() - start);
+    mu_check(storage_file_close(file));
+
+    // Small reads through buffered stream
+    Stream* stream = buffered_file_stream_alloc(storage);
+    mu_check(buffered_file_stream_open(
+        stream, STORAGE_BENCHMARK_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    start = furi_get_tick();
+    for(size_t i = 0; i < small_calls; i++) {
+        mu_assert_int_eq(
+            STORAGE_BENCHMARK_SMALL_READ,
+            stream_read(
+                stream, data + i * STORAGE_BENCHMARK_SMALL_READ, STORAGE_BENCHMARK_SMALL_READ));
+    }
+    storage_benchmark_print(
+        "buffered read", small_calls, STORAGE_BENCHMARK_SIZE, furi_get_tick() - start);
+    mu_check(buffered_file_stream_close(stream));
+    stream_free(stream);
+
+    // Whole file in one request
+    mu_check(storage_file_open(file, STORAGE_BENCHMARK_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    start = furi_get_tick();
+    mu_assert_int_eq(
+        STORAGE_BENCHMARK_SIZE, storage_file_read(file, data, STORAGE_BENCHMARK_SIZE));
+    storage_benchmark_print("large read", 1, STORAGE_BENCHMARK_SIZE, furi_get_tick() - start);
+    mu_check(storage_file_close(file));
+
+    for(size_t i = 0; i < STORAGE_BENCHMARK_SIZE; i++) {
+        if(data[i] != (i % 113)) {
+            mu_fail("Benchmark data mismatch");
+            break;
+        }
+    }
+
+    free(data);
+    storage_simply_remove(storage, STORAGE_BENCHMARK_FILE);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
@@ -184,6 +328,8 @@ MU_TEST_SUITE(storage_file) {
 
 MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
+    MU_RUN_TEST(storage_file_vector);
+    MU_RUN_TEST(storage_file_read_benchmark);
 }
 
 MU_TEST(storage_dir_open_close) {
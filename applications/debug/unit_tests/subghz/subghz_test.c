@@ -5,7 +5,10 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_varint.h>
+#include <toolbox/stream/string_stream.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/protocols/keeloq_common.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
@@ -18,6 +21,10 @@
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT 10000
+#define TEST_BENCHMARK_PULSES 4096
+#define TEST_BENCHMARK_PASSES 4
+#define TEST_KEELOQ_BATCHES 64
+#define TEST_RAW_VARINT_COUNT 512
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
@@ -146,6 +153,93 @@ static bool subghz_decode_random_test(const char* path) {
     }
 }
 
+static size_t subghz_test_load_pulses(const char* path, LevelDuration* pulses, size_t max) {
+    size_t count = 0;
+    uint32_t test_start = furi_get_tick();
+
+    file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path, NULL)) {
+        // the worker needs a file in order to open and read part of the file
+        furi_delay_ms(100);
+
+        while(count < max && furi_get_tick() - test_start < TEST_TIMEOUT) {
+            LevelDuration level_duration =
+                subghz_file_encoder_worker_get_level_duration(file_worker_encoder_handler);
+            if(level_duration_is_reset(level_duration)) break;
+            pulses[count++] = level_duration;
+            // Yield, to load data inside the worker
+            furi_thread_yield();
+        }
+        if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
+            subghz_file_encoder_worker_stop(file_worker_encoder_handler);
+        }
+    }
+    subghz_file_encoder_worker_free(file_worker_encoder_handler);
+
+    return count;
+}
+
+static bool subghz_receiver_benchmark(const char* path) {
+    LevelDuration* pulses = malloc(sizeof(LevelDuration) * TEST_BENCHMARK_PULSES);
+    const size_t pulse_count = subghz_test_load_pulses(path, pulses, TEST_BENCHMARK_PULSES);
+
+    // Reference: every decodable decoder is fed with every pulse
+    const size_t protocol_count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    SubGhzProtocolDecoderBase** decoders = malloc(sizeof(void*) * protocol_count);
+    size_t decoder_count = 0;
+    for(size_t i = 0; i < protocol_count; i++) {
+        const SubGhzProtocol* protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i);
+        if(!(protocol->flag & SubGhzProtocolFlag_Decodable)) continue;
+        SubGhzProtocolDecoderBase* decoder =
+            subghz_receiver_search_decoder_base_by_name(receiver_handler, protocol->name);
+        if(decoder) decoders[decoder_count++] = decoder;
+    }
+
+    subghz_receiver_reset(receiver_handler);
+    subghz_test_decoder_count = 0;
+    uint32_t reference_start = furi_get_tick();
+    for(size_t pass = 0; pass < TEST_BENCHMARK_PASSES; pass++) {
+        for(size_t i = 0; i < pulse_count; i++) {
+            bool level = level_duration_get_level(pulses[i]);
+            uint32_t duration = level_duration_get_duration(pulses[i]);
+            for(size_t j = 0; j < decoder_count; j++) {
+                decoders[j]->protocol->decoder->feed(decoders[j], level, duration);
+            }
+        }
+    }
+    uint32_t reference_time = furi_get_tick() - reference_start;
+    uint16_t reference_decoded = subghz_test_decoder_count;
+
+    subghz_receiver_reset(receiver_handler);
+    subghz_test_decoder_count = 0;
+    uint32_t receiver_start = furi_get_tick();
+    for(size_t pass = 0; pass < TEST_BENCHMARK_PASSES; pass++) {
+        for(size_t i = 0; i < pulse_count; i++) {
+            subghz_receiver_decode(
+                receiver_handler,
+                level_duration_get_level(pulses[i]),
+                level_duration_get_duration(pulses[i]));
+        }
+    }
+    uint32_t receiver_time = furi_get_tick() - receiver_start;
+    uint16_t receiver_decoded = subghz_test_decoder_count;
+
+    const uint32_t total = pulse_count * TEST_BENCHMARK_PASSES;
+    printf(
+        "SubGhz receiver: %lu pulses, %u decoders, all-feed %lu pulses/s, indexed %lu pulses/s\r\n",
+        total,
+        decoder_count,
+        total * 1000 / MAX(reference_time, 1UL),
+        total * 1000 / MAX(receiver_time, 1UL));
+
+    free(decoders);
+    free(pulses);
+    subghz_receiver_reset(receiver_handler);
+
+    return pulse_count && (reference_decoded == receiver_decoded);
+}
+
 static bool subghz_encoder_test(const char* path) {
     subghz_test_decoder_count = 0;
     uint32_t test_start = furi_get_tick();
@@ -214,6 +308,86 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keeloq_batch_test) {
+    uint32_t data[KEELOQ_BATCH_SIZE];
+    uint64_t key[KEELOQ_BATCH_SIZE];
+    uint32_t result[KEELOQ_BATCH_SIZE];
+
+    // Every batch size, both scalar and bit-sliced paths
+    for(size_t count = 1; count <= KEELOQ_BATCH_SIZE; count++) {
+        for(size_t i = 0; i < count; i++) {
+            data[i] = rand();
+            key[i] = ((uint64_t)rand() << 32) | rand();
+        }
+        subghz_protocol_keeloq_common_decrypt_batch(data, key, result, count);
+        for(size_t i = 0; i < count; i++) {
+            mu_assert_int_eq(subghz_protocol_keeloq_common_decrypt(data[i], key[i]), result[i]);
+        }
+    }
+
+    uint32_t scalar_start = furi_get_tick();
+    for(size_t batch = 0; batch < TEST_KEELOQ_BATCHES; batch++) {
+        for(size_t i = 0; i < KEELOQ_BATCH_SIZE; i++) {
+            result[i] = subghz_protocol_keeloq_common_decrypt(data[i] + batch, key[i]);
+        }
+    }
+    uint32_t scalar_time = furi_get_tick() - scalar_start;
+
+    uint32_t batch_start = furi_get_tick();
+    for(size_t batch = 0; batch < TEST_KEELOQ_BATCHES; batch++) {
+        data[0] += batch;
+        subghz_protocol_keeloq_common_decrypt_batch(data, key, result, KEELOQ_BATCH_SIZE);
+    }
+    uint32_t batch_time = furi_get_tick() - batch_start;
+
+    const uint32_t total = TEST_KEELOQ_BATCHES * KEELOQ_BATCH_SIZE;
+    printf(
+        "KeeLoq decrypt: scalar %lu/s, batch %lu/s\r\n",
+        total * 1000 / MAX(scalar_time, 1UL),
+        total * 1000 / MAX(batch_time, 1UL));
+}
+
+MU_TEST(subghz_raw_varint_test) {
+    Stream* stream = string_stream_alloc();
+    int32_t* data = malloc(TEST_RAW_VARINT_COUNT * sizeof(int32_t));
+
+    // Alternating levels, both short pulses and varint size boundaries
+    for(size_t i = 0; i < TEST_RAW_VARINT_COUNT; i++) {
+        int32_t duration = (i % 7 == 0) ? (1 << (i % 21)) : (int32_t)(rand() % 30000 + 1);
+        data[i] = (i % 2) ? -duration : duration;
+    }
+    data[1] = INT32_MIN + 1;
+    data[2] = INT32_MAX;
+
+    mu_check(subghz_raw_varint_write(stream, data, TEST_RAW_VARINT_COUNT));
+    size_t size = stream_size(stream);
+    mu_check(size < TEST_RAW_VARINT_COUNT * sizeof(int32_t));
+
+    mu_check(stream_rewind(stream));
+    SubGhzRawVarintReader* reader = subghz_raw_varint_reader_alloc(stream);
+    int32_t duration = 0;
+    for(size_t i = 0; i < TEST_RAW_VARINT_COUNT; i++) {
+        mu_check(subghz_raw_varint_reader_read(reader, &duration));
+        mu_assert_int_eq(data[i], duration);
+    }
+    mu_check(!subghz_raw_varint_reader_read(reader, &duration));
+    subghz_raw_varint_reader_free(reader);
+
+    // Last duration cut in half is dropped, not misread
+    mu_check(stream_seek(stream, size - 1, StreamOffsetFromStart));
+    mu_check(stream_delete(stream, 1));
+    mu_check(stream_rewind(stream));
+    reader = subghz_raw_varint_reader_alloc(stream);
+    size_t count = 0;
+    while(subghz_raw_varint_reader_read(reader, &duration)) count++;
+    mu_assert_int_eq(TEST_RAW_VARINT_COUNT - 1, count);
+    subghz_raw_varint_reader_free(reader);
+
+    free(data);
+    stream_free(stream);
+}
+
+#ifndef FURI_HOST // No radio on host
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -367,6 +541,7 @@ MU_TEST(subghz_hal_async_tx_test) {
         subghz_hal_async_tx_test_run(SubGhzHalAsyncTxTestTypeResetEnd),
         "Test furi_hal_async_tx reset end");
 }
+#endif
 
 //test decoders
 MU_TEST(subghz_decoder_came_atomo_test) {
@@ -830,11 +1005,21 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_receiver_benchmark_test) {
+    mu_assert(
+        subghz_receiver_benchmark(TEST_RANDOM_DIR_NAME),
+        "Indexed receiver decodes differ from feeding all decoders\r\n");
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keeloq_batch_test);
+    MU_RUN_TEST(subghz_raw_varint_test);
 
+#ifndef FURI_HOST
     MU_RUN_TEST(subghz_hal_async_tx_test);
+#endif
 
     MU_RUN_TEST(subghz_decoder_came_atomo_test);
     MU_RUN_TEST(subghz_decoder_came_test);
@@ -907,6 +1092,7 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_decoder_acurite_592txr_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_receiver_benchmark_test);
     subghz_test_deinit();
 }
 
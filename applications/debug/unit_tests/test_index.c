@@ -27,9 +27,15 @@ int run_minunit_test_lfrfid_protocols();
 int run_minunit_test_nfc();
 int run_minunit_test_bit_lib();
 int run_minunit_test_float_tools();
+int run_minunit_test_sector_cache();
 int run_minunit_test_bt();
 int run_minunit_test_dialogs_file_browser_options();
 int run_minunit_test_expansion();
+int run_minunit_test_canvas_blit();
+int run_minunit_test_canvas_icon_cache();
+int run_minunit_test_api_hashtable();
+int run_minunit_test_trace();
+int run_minunit_test_elf();
 
 typedef int (*UnitTestEntry)();
 
@@ -58,10 +64,16 @@ const UnitTest unit_tests[] = {
     {.name = "lfrfid", .entry = run_minunit_test_lfrfid_protocols},
     {.name = "bit_lib", .entry = run_minunit_test_bit_lib},
     {.name = "float_tools", .entry = run_minunit_test_float_tools},
+    {.name = "sector_cache", .entry = run_minunit_test_sector_cache},
     {.name = "bt", .entry = run_minunit_test_bt},
     {.name = "dialogs_file_browser_options",
      .entry = run_minunit_test_dialogs_file_browser_options},
     {.name = "expansion", .entry = run_minunit_test_expansion},
+    {.name = "canvas_blit", .entry = run_minunit_test_canvas_blit},
+    {.name = "canvas_icon_cache", .entry = run_minunit_test_canvas_icon_cache},
+    {.name = "api_hashtable", .entry = run_minunit_test_api_hashtable},
+    {.name = "trace", .entry = run_minunit_test_trace},
+    {.name = "elf", .entry = run_minunit_test_elf},
 };
 
 void minunit_print_progress() {
@@ -109,7 +121,8 @@ void unit_tests_cli(Cli* cli, FuriString* args, void* context) {
     } else {
         notification_message_block(notification, &sequence_set_only_blue_255);
 
-        uint32_t heap_before = memmgr_get_free_heap();
+        // Small allocations are served by slabs, count them too
+        uint32_t heap_before = memmgr_get_free_heap() + memmgr_heap_get_slab_free();
         uint32_t cycle_counter = furi_get_tick();
 
         for(size_t i = 0; i < COUNT_OF(unit_tests); i++) {
@@ -137,7 +150,7 @@ void unit_tests_cli(Cli* cli, FuriString* args, void* context) {
 
             // Wait for tested services and apps to deallocate memory
             furi_delay_ms(200);
-            uint32_t heap_after = memmgr_get_free_heap();
+            uint32_t heap_after = memmgr_get_free_heap() + memmgr_heap_get_slab_free();
             printf("Leaked: %ld\r\n", heap_before - heap_after);
 
             // Final Report
@@ -0,0 +1,130 @@
+#include <furi.h>
+#include <toolbox/trace.h>
+#include <toolbox/stream/string_stream.h>
+#include "../minunit.h"
+
+#define TRACE_TEST_THREAD_NAME "TraceTest"
+
+static FuriString* trace_test_export() {
+    FuriString* json = furi_string_alloc();
+    Stream* stream = string_stream_alloc();
+
+    if(trace_export(stream)) {
+        stream_rewind(stream);
+        stream_read_line(stream, json);
+        FuriString* line = furi_string_alloc();
+        while(stream_read_line(stream, line)) {
+            furi_string_cat(json, line);
+        }
+        furi_string_free(line);
+        furi_string_trim(json);
+    }
+
+    stream_free(stream);
+    return json;
+}
+
+static size_t trace_test_count(FuriString* json, const char* needle) {
+    size_t count = 0;
+    size_t position = furi_string_search_str(json, needle, 0);
+    while(position != FURI_STRING_FAILURE) {
+        count++;
+        position = furi_string_search_str(json, needle, position + 1);
+    }
+    return count;
+}
+
+static int32_t trace_test_thread(void* context) {
+    UNUSED(context);
+    trace_begin(TraceProbeSubGhzDecode);
+    trace_end(TraceProbeSubGhzDecode);
+    return 0;
+}
+
+MU_TEST(trace_test_idle) {
+    trace_clear();
+    mu_check(!trace_is_running());
+
+    // Not recording: probes are ignored and there is nothing to export
+    trace_begin(TraceProbeGuiRedraw);
+    trace_end(TraceProbeGuiRedraw);
+    Stream* stream = string_stream_alloc();
+    mu_check(!trace_export(stream));
+    mu_assert_int_eq(0, stream_size(stream));
+    stream_free(stream);
+    mu_assert_int_eq(0, trace_get_dropped_count());
+}
+
+MU_TEST(trace_test_record) {
+    mu_check(trace_start(TRACE_EVENTS_DEFAULT));
+    mu_check(trace_is_running());
+    mu_check(!trace_start(TRACE_EVENTS_DEFAULT));
+
+    // Probes that are not hit by services while tests run
+    trace_begin(TraceProbeElfLoadSections);
+    trace_counter(TraceProbeNfcPollerState, 42);
+    trace_end(TraceProbeElfLoadSections);
+
+    FuriThread* thread =
+        furi_thread_alloc_ex(TRACE_TEST_THREAD_NAME, 1024, trace_test_thread, NULL);
+    furi_thread_start(thread);
+    furi_thread_join(thread);
+    furi_thread_free(thread);
+
+    // Running trace can't be exported
+    Stream* stream = string_stream_alloc();
+    mu_check(!trace_export(stream));
+    stream_free(stream);
+
+    trace_stop();
+    mu_check(!trace_is_running());
+    trace_begin(TraceProbeElfLoadSections);
+
+    FuriString* json = trace_test_export();
+    mu_check(furi_string_start_with_str(json, "{\"displayTimeUnit\""));
+    mu_check(furi_string_end_with_str(json, "}"));
+    mu_assert_int_eq(trace_test_count(json, "{"), trace_test_count(json, "}"));
+
+    mu_assert_int_eq(2, trace_test_count(json, "\"name\":\"elf_file_load_sections\""));
+    mu_assert_int_eq(2, trace_test_count(json, "\"name\":\"subghz_receiver_decode\""));
+    mu_assert_int_eq(1, trace_test_count(json, "\"args\":{\"value\":42}"));
+    mu_assert_int_eq(1, trace_test_count(json, "\"name\":\"" TRACE_TEST_THREAD_NAME "\""));
+    mu_assert_int_eq(1, trace_test_count(json, "\"dropped_events\":\"0\""));
+    furi_string_free(json);
+
+    trace_clear();
+    json = trace_test_export();
+    mu_assert_int_eq(0, furi_string_size(json));
+    furi_string_free(json);
+}
+
+MU_TEST(trace_test_overflow) {
+    mu_check(trace_start(2));
+    for(size_t i = 0; i < 5; i++) {
+        trace_counter(TraceProbeNfcPollerState, i);
+    }
+    trace_stop();
+    // Services may overflow their buffers too
+    mu_check(trace_get_dropped_count() >= 3);
+
+    // Oldest events are kept
+    FuriString* json = trace_test_export();
+    mu_assert_int_eq(2, trace_test_count(json, "\"name\":\"nfc_worker_poller_state\""));
+    mu_assert_int_eq(1, trace_test_count(json, "\"args\":{\"value\":0}"));
+    mu_assert_int_eq(1, trace_test_count(json, "\"args\":{\"value\":1}"));
+    furi_string_free(json);
+
+    trace_clear();
+    mu_assert_int_eq(0, trace_get_dropped_count());
+}
+
+MU_TEST_SUITE(trace_suite) {
+    MU_RUN_TEST(trace_test_idle);
+    MU_RUN_TEST(trace_test_record);
+    MU_RUN_TEST(trace_test_overflow);
+}
+
+int run_minunit_test_trace() {
+    MU_RUN_SUITE(trace_suite);
+    return MU_EXIT_CODE;
+}
@@ -1,5 +1,6 @@
 #include <flipper_application/api_hashtable/api_hashtable.h>
 #include <flipper_application/api_hashtable/compilesort.hpp>
+#include <flipper_application/api_hashtable/compilehash.hpp>
 
 /* 
  * This file contains an implementation of a symbol table 
@@ -10,16 +11,22 @@
 
 static_assert(!has_hash_collisions(app_api_table), "Detected API method hash collision!");
 
-constexpr HashtableApiInterface applicaton_hashtable_api_interface{
+/* perfect hash table built at compile time, symbol lookup is O(1) */
+static constexpr auto app_api_perfect_hash = perfect_hash(app_api_table);
+static_assert(app_api_perfect_hash.is_valid, "Failed to build API perfect hash table!");
+
+constexpr PerfectHashApiInterface applicaton_hashtable_api_interface{
     {
         .api_version_major = 0,
         .api_version_minor = 0,
-        /* generic resolver using pre-sorted array */
-        .resolver_callback = &elf_resolve_from_hashtable,
+        /* generic resolver using perfect hash table */
+        .resolver_callback = &elf_resolve_from_perfect_hash,
     },
-    /* pointers to application's API table boundaries */
-    .table_cbegin = app_api_table.cbegin(),
-    .table_cend = app_api_table.cend(),
+    /* pointers to application's API perfect hash table */
+    .table = app_api_perfect_hash.table.data(),
+    .displacements = app_api_perfect_hash.displacements.data(),
+    .table_size = app_api_perfect_hash.table.size(),
+    .displacements_size = app_api_perfect_hash.displacements.size(),
 };
 
 /* Casting to generic resolver to use in Composite API resolver */
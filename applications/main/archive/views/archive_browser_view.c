@@ -587,6 +587,9 @@ ArchiveBrowserView* browser_alloc() {
 
     browser->path = furi_string_alloc_set(archive_get_default_path(TAB_DEFAULT));
 
+    browser->meta_cache = flipper_application_meta_cache_alloc(furi_record_open(RECORD_STORAGE));
+    browser->meta_cache_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
     with_view_model(
         browser->view,
         ArchiveBrowserViewModel * model,
@@ -620,6 +623,10 @@ void browser_free(ArchiveBrowserView* browser) {
 
     furi_string_free(browser->path);
 
+    furi_mutex_free(browser->meta_cache_mutex);
+    flipper_application_meta_cache_free(browser->meta_cache);
+    furi_record_close(RECORD_STORAGE);
+
     view_free(browser->view);
     free(browser);
 }
@@ -9,6 +9,7 @@
 #include <gui/elements.h>
 #include <gui/modules/file_browser_worker.h>
 #include <storage/storage.h>
+#include <flipper_application/application_meta_cache.h>
 #include "../helpers/archive_files.h"
 #include "../helpers/archive_menu.h"
 #include "../helpers/archive_favorites.h"
@@ -90,6 +91,9 @@ struct ArchiveBrowserView {
     InputKey last_tab_switch_dir;
     bool is_root;
     FuriTimer* scroll_timer;
+    // Items are added from worker, search and UI threads
+    FlipperApplicationMetaCache* meta_cache;
+    FuriMutex* meta_cache_mutex;
 };
 
 typedef struct {
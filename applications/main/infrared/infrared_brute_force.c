@@ -1,16 +1,36 @@
 #include "infrared_brute_force.h"
 
 #include <stdlib.h>
+#include <m-array.h>
 #include <m-dict.h>
 #include <flipper_format/flipper_format.h>
 
 #include "infrared_signal.h"
 
+#define INFRARED_BRUTE_FORCE_PREFETCH_STACK_SIZE 2048
+
+typedef enum {
+    InfraredBruteForcePrefetchFlagRead = (1 << 0),
+    InfraredBruteForcePrefetchFlagExit = (1 << 1),
+} InfraredBruteForcePrefetchFlag;
+
+#define INFRARED_BRUTE_FORCE_PREFETCH_FLAGS_ALL \
+    (InfraredBruteForcePrefetchFlagRead | InfraredBruteForcePrefetchFlagExit)
+
 typedef struct {
     uint32_t index;
     uint32_t count;
 } InfraredBruteForceRecord;
 
+/* Signal of a record in the database file */
+typedef struct {
+    uint32_t index;
+    uint32_t offset;
+} InfraredBruteForceSignal;
+
+ARRAY_DEF(InfraredBruteForceSignalArray, InfraredBruteForceSignal, M_POD_OPLIST);
+ARRAY_DEF(InfraredBruteForceOffsetArray, uint32_t, M_POD_OPLIST);
+
 DICT_DEF2(
     InfraredBruteForceRecordDict,
     FuriString*,
@@ -24,6 +44,17 @@ struct InfraredBruteForce {
     FuriString* current_record_name;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    // Offsets of all record signals, collected by infrared_brute_force_calculate_messages()
+    InfraredBruteForceSignalArray_t signals;
+    // Offsets of the running record signals
+    InfraredBruteForceOffsetArray_t offsets;
+    // Next signal is read by the worker while the current one is transmitted
+    FuriThread* prefetch_thread;
+    FuriSemaphore* prefetch_done;
+    InfraredSignal* next_signal;
+    size_t next_signal_index;
+    bool is_next_signal_pending;
+    bool is_next_signal_ready;
     bool is_started;
 };
 
@@ -32,15 +63,22 @@ InfraredBruteForce* infrared_brute_force_alloc() {
     brute_force->ff = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->next_signal = NULL;
+    brute_force->prefetch_thread = NULL;
+    brute_force->prefetch_done = NULL;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
+    InfraredBruteForceSignalArray_init(brute_force->signals);
+    InfraredBruteForceOffsetArray_init(brute_force->offsets);
     return brute_force;
 }
 
 void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     InfraredBruteForceRecordDict_clear(brute_force->records);
+    InfraredBruteForceSignalArray_clear(brute_force->signals);
+    InfraredBruteForceOffsetArray_clear(brute_force->offsets);
     furi_string_free(brute_force->current_record_name);
     free(brute_force);
 }
@@ -57,16 +95,27 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    // Only names are read, raw signal bodies are skipped without parsing
+    flipper_format_set_key_index(ff, true);
+
+    InfraredBruteForceSignalArray_reset(brute_force->signals);
 
     success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
     if(success) {
+        Stream* stream = flipper_format_get_raw_stream(ff);
         FuriString* signal_name;
         signal_name = furi_string_alloc();
-        while(flipper_format_read_string(ff, "name", signal_name)) {
+        while(infrared_signal_read_name(ff, signal_name)) {
             InfraredBruteForceRecord* record =
                 InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
             if(record) { //-V547
                 ++(record->count);
+                // Signal body starts right after the name
+                InfraredBruteForceSignal signal = {
+                    .index = record->index,
+                    .offset = stream_tell(stream),
+                };
+                InfraredBruteForceSignalArray_push_back(brute_force->signals, signal);
             }
         }
         furi_string_free(signal_name);
@@ -77,6 +126,51 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     return success;
 }
 
+static bool infrared_brute_force_read_signal(
+    InfraredBruteForce* brute_force,
+    InfraredSignal* signal,
+    size_t index) {
+    if(index >= InfraredBruteForceOffsetArray_size(brute_force->offsets)) return false;
+
+    const uint32_t offset = *InfraredBruteForceOffsetArray_cget(brute_force->offsets, index);
+    Stream* stream = flipper_format_get_raw_stream(brute_force->ff);
+    return stream_seek(stream, offset, StreamOffsetFromStart) &&
+           infrared_signal_read_body(signal, brute_force->ff);
+}
+
+// Started once per brute force, reads next_signal on every read flag
+static int32_t infrared_brute_force_prefetch_thread(void* context) {
+    InfraredBruteForce* brute_force = context;
+
+    while(true) {
+        uint32_t flags = furi_thread_flags_wait(
+            INFRARED_BRUTE_FORCE_PREFETCH_FLAGS_ALL, FuriFlagWaitAny, FuriWaitForever);
+        furi_check(!(flags & FuriFlagError));
+        if(flags & InfraredBruteForcePrefetchFlagExit) break;
+
+        brute_force->is_next_signal_ready = infrared_brute_force_read_signal(
+            brute_force, brute_force->next_signal, brute_force->next_signal_index);
+        furi_semaphore_release(brute_force->prefetch_done);
+    }
+
+    return 0;
+}
+
+static void infrared_brute_force_prefetch_next(InfraredBruteForce* brute_force) {
+    brute_force->is_next_signal_pending = true;
+    furi_thread_flags_set(
+        furi_thread_get_id(brute_force->prefetch_thread), InfraredBruteForcePrefetchFlagRead);
+}
+
+static void infrared_brute_force_prefetch_wait(InfraredBruteForce* brute_force) {
+    if(brute_force->is_next_signal_pending) {
+        furi_check(
+            furi_semaphore_acquire(brute_force->prefetch_done, FuriWaitForever) ==
+            FuriStatusOk);
+        brute_force->is_next_signal_pending = false;
+    }
+}
+
 bool infrared_brute_force_start(
     InfraredBruteForce* brute_force,
     uint32_t index,
@@ -100,13 +194,40 @@ bool infrared_brute_force_start(
     }
 
     if(*record_count) {
+        InfraredBruteForceOffsetArray_reset(brute_force->offsets);
+        InfraredBruteForceSignalArray_it_t signal_it;
+        for(InfraredBruteForceSignalArray_it(signal_it, brute_force->signals);
+            !InfraredBruteForceSignalArray_end_p(signal_it);
+            InfraredBruteForceSignalArray_next(signal_it)) {
+            const InfraredBruteForceSignal* signal =
+                InfraredBruteForceSignalArray_cref(signal_it);
+            if(signal->index == index) {
+                InfraredBruteForceOffsetArray_push_back(brute_force->offsets, signal->offset);
+            }
+        }
+
         Storage* storage = furi_record_open(RECORD_STORAGE);
         brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
+        brute_force->next_signal = infrared_signal_alloc();
+        brute_force->prefetch_done = furi_semaphore_alloc(1, 0);
+        brute_force->prefetch_thread = furi_thread_alloc_ex(
+            "InfraredBruteForce",
+            INFRARED_BRUTE_FORCE_PREFETCH_STACK_SIZE,
+            infrared_brute_force_prefetch_thread,
+            brute_force);
+        brute_force->next_signal_index = 0;
+        brute_force->is_next_signal_pending = false;
+        brute_force->is_next_signal_ready = false;
         brute_force->is_started = true;
+        furi_thread_start(brute_force->prefetch_thread);
         success =
             flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
-        if(!success) infrared_brute_force_stop(brute_force);
+        if(success) {
+            infrared_brute_force_prefetch_next(brute_force);
+        } else {
+            infrared_brute_force_stop(brute_force);
+        }
     }
     return success;
 }
@@ -117,10 +238,20 @@ bool infrared_brute_force_is_started(const InfraredBruteForce* brute_force) {
 
 void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
+    // Read in progress is finished first, worker exits on the next wait
+    furi_thread_flags_set(
+        furi_thread_get_id(brute_force->prefetch_thread), InfraredBruteForcePrefetchFlagExit);
+    furi_thread_join(brute_force->prefetch_thread);
+    furi_thread_free(brute_force->prefetch_thread);
+    furi_semaphore_free(brute_force->prefetch_done);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
+    infrared_signal_free(brute_force->next_signal);
     flipper_format_free(brute_force->ff);
+    brute_force->prefetch_thread = NULL;
+    brute_force->prefetch_done = NULL;
     brute_force->current_signal = NULL;
+    brute_force->next_signal = NULL;
     brute_force->ff = NULL;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
@@ -128,11 +259,13 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
 
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_by_name_and_read(
-        brute_force->current_signal,
-        brute_force->ff,
-        furi_string_get_cstr(brute_force->current_record_name));
+    infrared_brute_force_prefetch_wait(brute_force);
+
+    const bool success = brute_force->is_next_signal_ready;
     if(success) {
+        FURI_SWAP(brute_force->current_signal, brute_force->next_signal);
+        brute_force->next_signal_index++;
+        infrared_brute_force_prefetch_next(brute_force);
         infrared_signal_transmit(brute_force->current_signal);
     }
     return success;
@@ -152,4 +285,6 @@ void infrared_brute_force_add_record(
 void infrared_brute_force_reset(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     InfraredBruteForceRecordDict_reset(brute_force->records);
+    InfraredBruteForceSignalArray_reset(brute_force->signals);
+    InfraredBruteForceOffsetArray_reset(brute_force->offsets);
 }
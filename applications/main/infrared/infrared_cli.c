@@ -364,6 +364,7 @@ static void infrared_cli_list_remote_signals(FuriString* remote_name) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(ff, true);
     FuriString* remote_path = furi_string_alloc_printf(
         "%s/%s.ir", EXT_PATH(INFRARED_ASSETS_FOLDER), furi_string_get_cstr(remote_name));
 
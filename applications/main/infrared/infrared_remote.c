@@ -88,6 +88,8 @@ bool infrared_remote_load_signal(
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    // Signal names are looked up without parsing bodies of signals before them
+    flipper_format_set_key_index(ff, true);
 
     bool success = false;
 
@@ -366,6 +368,7 @@ bool infrared_remote_load(InfraredRemote* remote, const char* path) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(ff, true);
 
     FuriString* tmp = furi_string_alloc();
     bool success = false;
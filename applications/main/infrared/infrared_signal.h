@@ -151,6 +151,18 @@ bool infrared_signal_read(InfraredSignal* signal, FlipperFormat* ff, FuriString*
  */
 bool infrared_signal_read_name(FlipperFormat* ff, FuriString* name);
 
+/**
+ * @brief Read a signal body from a FlipperFormat file into an InfraredSignal instance.
+ *
+ * Same behaviour as infrared_signal_read(), but the name is not read. The seek position
+ * must be right after a signal name, as infrared_signal_read_name() leaves it.
+ *
+ * @param[in,out] signal pointer to the instance to be read into.
+ * @param[in,out] ff pointer to the FlipperFormat file instance to read from.
+ * @returns true if a signal was successfully read, false otherwise.
+ */
+bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff);
+
 /**
  * @brief Read a signal with a particular name from a FlipperFormat file into an InfraredSignal instance.
  *
@@ -4,15 +4,76 @@
 static const char* nfc_resources_header = "Flipper EMV resources";
 static const uint32_t nfc_resources_file_version = 1;
 
-static bool nfc_emv_parser_search_data(
+typedef enum {
+    NfcEmvParserTableAid,
+    NfcEmvParserTableCountry,
+    NfcEmvParserTableCurrency,
+
+    NfcEmvParserTableNum,
+} NfcEmvParserTableType;
+
+typedef struct {
+    bool loaded;
+    // File body with keys and values split into C strings
+    char* data;
+    // Keys in data, sorted, value follows key's terminating zero
+    const char** keys;
+    size_t keys_count;
+} NfcEmvParserTable;
+
+static const char* const nfc_emv_parser_table_path[NfcEmvParserTableNum] = {
+    [NfcEmvParserTableAid] = EXT_PATH("nfc/assets/aid.nfc"),
+    [NfcEmvParserTableCountry] = EXT_PATH("nfc/assets/country_code.nfc"),
+    [NfcEmvParserTableCurrency] = EXT_PATH("nfc/assets/currency_code.nfc"),
+};
+
+static NfcEmvParserTable nfc_emv_parser_tables[NfcEmvParserTableNum];
+
+static int nfc_emv_parser_key_cmp(const void* a, const void* b) {
+    const char* key_a = *(const char**)a;
+    const char* key_b = *(const char**)b;
+    int cmp = strcmp(key_a, key_b);
+    // Same key twice: first one in file wins, as with sequential search
+    if(cmp == 0) cmp = (key_a > key_b) - (key_a < key_b);
+    return cmp;
+}
+
+// Splits "KEY: VALUE" lines in place into "KEY\0VALUE\0" and collects keys
+static void nfc_emv_parser_table_split(NfcEmvParserTable* table, size_t data_size) {
+    char* line = table->data;
+    char* end = table->data + data_size;
+
+    while(line < end) {
+        char* line_end = memchr(line, '\n', end - line);
+        if(!line_end) line_end = end;
+        *line_end = '\0';
+
+        char* separator = strchr(line, ':');
+        if(line[0] != '#' && separator && separator != line) {
+            *separator = '\0';
+            char* value = separator + 1;
+            while(*value == ' ') value++;
+            size_t value_len = strlen(value);
+            while(value_len && (value[value_len - 1] == '\r' || value[value_len - 1] == ' ')) {
+                value_len--;
+            }
+            // Value right after the key, so it can be found from the key
+            memmove(separator + 1, value, value_len);
+            separator[1 + value_len] = '\0';
+
+            table->keys[table->keys_count++] = line;
+        }
+
+        line = line_end + 1;
+    }
+}
+
+static bool nfc_emv_parser_table_load(
     Storage* storage,
-    const char* file_name,
-    FuriString* key,
-    FuriString* data) {
-    bool parsed = false;
+    NfcEmvParserTable* table,
+    const char* file_name) {
     FlipperFormat* file = flipper_format_file_alloc(storage);
-    FuriString* temp_str;
-    temp_str = furi_string_alloc();
+    FuriString* temp_str = furi_string_alloc();
 
     do {
         // Open file
@@ -23,12 +84,67 @@ static bool nfc_emv_parser_search_data(
         if(furi_string_cmp_str(temp_str, nfc_resources_header) ||
            (version != nfc_resources_file_version))
             break;
-        if(!flipper_format_read_string(file, furi_string_get_cstr(key), data)) break;
-        parsed = true;
+
+        // Whole body in one read
+        Stream* stream = flipper_format_get_raw_stream(file);
+        size_t data_size = stream_size(stream) - stream_tell(stream);
+        table->data = malloc(data_size + 1);
+        if(stream_read(stream, (uint8_t*)table->data, data_size) != data_size) {
+            free(table->data);
+            table->data = NULL;
+            break;
+        }
+        table->data[data_size] = '\0';
+
+        // One key per line at most
+        size_t lines_count = 1;
+        for(size_t i = 0; i < data_size; i++) {
+            if(table->data[i] == '\n') lines_count++;
+        }
+        table->keys = malloc(lines_count * sizeof(const char*));
+        table->keys_count = 0;
+
+        nfc_emv_parser_table_split(table, data_size);
+        qsort(table->keys, table->keys_count, sizeof(const char*), nfc_emv_parser_key_cmp);
     } while(false);
 
     furi_string_free(temp_str);
     flipper_format_free(file);
+
+    return table->data != NULL;
+}
+
+static bool nfc_emv_parser_search_data(
+    Storage* storage,
+    NfcEmvParserTableType type,
+    FuriString* key,
+    FuriString* data) {
+    NfcEmvParserTable* table = &nfc_emv_parser_tables[type];
+
+    // Loaded once, missing file is not retried until cache is freed
+    if(!table->loaded) {
+        nfc_emv_parser_table_load(storage, table, nfc_emv_parser_table_path[type]);
+        table->loaded = true;
+    }
+
+    const char* key_str = furi_string_get_cstr(key);
+    size_t low = 0;
+    size_t high = table->keys_count;
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        if(strcmp(table->keys[mid], key_str) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    bool parsed = false;
+    if(low < table->keys_count && strcmp(table->keys[low], key_str) == 0) {
+        furi_string_set_str(data, table->keys[low] + strlen(key_str) + 1);
+        parsed = true;
+    }
+
     return parsed;
 }
 
@@ -44,7 +160,7 @@ bool nfc_emv_parser_get_aid_name(
     for(uint8_t i = 0; i < aid_len; i++) {
         furi_string_cat_printf(key, "%02X", aid[i]);
     }
-    if(nfc_emv_parser_search_data(storage, EXT_PATH("nfc/assets/aid.nfc"), key, aid_name)) {
+    if(nfc_emv_parser_search_data(storage, NfcEmvParserTableAid, key, aid_name)) {
         parsed = true;
     }
     furi_string_free(key);
@@ -58,8 +174,7 @@ bool nfc_emv_parser_get_country_name(
     bool parsed = false;
     FuriString* key;
     key = furi_string_alloc_printf("%04X", country_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/country_code.nfc"), key, country_name)) {
+    if(nfc_emv_parser_search_data(storage, NfcEmvParserTableCountry, key, country_name)) {
         parsed = true;
     }
     furi_string_free(key);
@@ -73,10 +188,18 @@ bool nfc_emv_parser_get_currency_name(
     bool parsed = false;
     FuriString* key;
     key = furi_string_alloc_printf("%04X", currency_code);
-    if(nfc_emv_parser_search_data(
-           storage, EXT_PATH("nfc/assets/currency_code.nfc"), key, currency_name)) {
+    if(nfc_emv_parser_search_data(storage, NfcEmvParserTableCurrency, key, currency_name)) {
         parsed = true;
     }
     furi_string_free(key);
     return parsed;
 }
+
+void nfc_emv_parser_cache_free(void) {
+    for(size_t i = 0; i < NfcEmvParserTableNum; i++) {
+        NfcEmvParserTable* table = &nfc_emv_parser_tables[i];
+        if(table->keys) free(table->keys);
+        if(table->data) free(table->data);
+        memset(table, 0, sizeof(NfcEmvParserTable));
+    }
+}
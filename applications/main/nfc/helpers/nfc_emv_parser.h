@@ -38,3 +38,9 @@ bool nfc_emv_parser_get_currency_name(
     Storage* storage,
     uint16_t currency_code,
     FuriString* currency_name);
+
+/** Free lookup tables
+ * Resource files are loaded into sorted tables on first lookup and reused
+ * until this call.
+ */
+void nfc_emv_parser_cache_free(void);
@@ -144,6 +144,7 @@ void nfc_app_free(NfcApp* instance) {
     mf_ultralight_auth_free(instance->mf_ul_auth);
     mf_classic_key_cache_free(instance->mfc_key_cache);
     nfc_supported_cards_free(instance->nfc_supported_cards);
+    nfc_emv_parser_cache_free();
 
     // Nfc device
     nfc_device_free(instance->nfc_device);
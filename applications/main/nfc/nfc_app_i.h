@@ -74,6 +74,7 @@
 
 #define NFC_APP_MF_CLASSIC_DICT_USER_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict_user.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict.nfc")
+#define NFC_APP_MF_CLASSIC_DICT_BATCH_SIZE (16)
 
 typedef enum {
     NfcRpcStateIdle,
@@ -82,6 +83,10 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    // Keys read ahead from dict
+    MfClassicKey dict_batch[NFC_APP_MF_CLASSIC_DICT_BATCH_SIZE];
+    size_t dict_batch_size;
+    size_t dict_batch_position;
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
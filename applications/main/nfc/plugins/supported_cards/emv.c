@@ -110,6 +110,9 @@ static bool emv_parse(const NfcDevice* device, FuriString* parsed_data) {
         parsed = true;
     } while(false);
 
+    // Plugin is unloaded after parsing, tables go with it
+    nfc_emv_parser_cache_free();
+
     return parsed;
 }
 
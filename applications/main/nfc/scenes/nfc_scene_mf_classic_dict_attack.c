@@ -10,6 +10,30 @@ typedef enum {
     DictAttackStateSystemDictInProgress,
 } DictAttackState;
 
+static void nfc_scene_mf_classic_dict_attack_rewind(NfcApp* instance) {
+    keys_dict_rewind(instance->nfc_dict_context.dict);
+    instance->nfc_dict_context.dict_batch_size = 0;
+    instance->nfc_dict_context.dict_batch_position = 0;
+}
+
+static bool nfc_scene_mf_classic_dict_attack_get_next_key(NfcApp* instance, MfClassicKey* key) {
+    NfcMfClassicDictAttackContext* mfc_dict = &instance->nfc_dict_context;
+
+    if(mfc_dict->dict_batch_position == mfc_dict->dict_batch_size) {
+        mfc_dict->dict_batch_size = keys_dict_get_next_keys(
+            mfc_dict->dict,
+            mfc_dict->dict_batch[0].data,
+            NFC_APP_MF_CLASSIC_DICT_BATCH_SIZE,
+            sizeof(MfClassicKey));
+        mfc_dict->dict_batch_position = 0;
+        if(mfc_dict->dict_batch_size == 0) return false;
+    }
+
+    *key = mfc_dict->dict_batch[mfc_dict->dict_batch_position++];
+
+    return true;
+}
+
 NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context) {
     furi_assert(context);
     furi_assert(event.event_data);
@@ -41,8 +65,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
         MfClassicKey key = {};
-        if(keys_dict_get_next_key(
-               instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
+        if(nfc_scene_mf_classic_dict_attack_get_next_key(instance, &key)) {
             mfc_event->data->key_request_data.key = key;
             mfc_event->data->key_request_data.key_provided = true;
             instance->nfc_dict_context.dict_keys_current++;
@@ -61,7 +84,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        nfc_scene_mf_classic_dict_attack_rewind(instance);
         instance->nfc_dict_context.dict_keys_current = 0;
         instance->nfc_dict_context.current_sector =
             mfc_event->data->next_sector_data.current_sector;
@@ -80,7 +103,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeKeyAttackStop) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        nfc_scene_mf_classic_dict_attack_rewind(instance);
         instance->nfc_dict_context.is_key_attack = false;
         instance->nfc_dict_context.dict_keys_current = 0;
         view_dispatcher_send_custom_event(
@@ -152,6 +175,7 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
     dict_attack_set_total_dict_keys(
         instance->dict_attack, instance->nfc_dict_context.dict_keys_total);
     instance->nfc_dict_context.dict_keys_current = 0;
+    nfc_scene_mf_classic_dict_attack_rewind(instance);
 
     dict_attack_set_callback(
         instance->dict_attack, nfc_dict_attack_dict_attack_result_callback, instance);
@@ -365,6 +365,15 @@ static void subghz_scene_receiver_config_set_autosave(VariableItem* item) {
     subghz->last_settings->autosave = index == 1;
 }
 
+static void subghz_scene_receiver_config_set_compact_raw(VariableItem* item) {
+    SubGhz* subghz = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    variable_item_set_current_value_text(item, combobox_text[index]);
+
+    subghz->last_settings->compact_raw = index == 1;
+}
+
 static inline bool subghz_scene_receiver_config_ignore_filter_get_index(
     SubGhzProtocolFilter filter,
     SubGhzProtocolFilter flag) {
@@ -438,6 +447,7 @@ static void subghz_scene_receiver_config_var_list_enter_callback(void* context,
         subghz->repeater = SubGhzRepeaterStateOff;
         subghz->last_settings->delete_old_signals = false;
         subghz->last_settings->autosave = false;
+        subghz->last_settings->compact_raw = false;
 
         subghz_txrx_speaker_set_state(subghz->txrx, speaker_value[default_index]);
         subghz->last_settings->enable_sound = false;
@@ -699,6 +709,17 @@ void subghz_scene_receiver_config_on_enter(void* context) {
             RAW_THRESHOLD_RSSI_COUNT);
         variable_item_set_current_value_index(item, value_index);
         variable_item_set_current_value_text(item, raw_threshold_rssi_text[value_index]);
+
+        item = variable_item_list_add(
+            subghz->variable_item_list,
+            "Compact RAW",
+            COMBO_BOX_COUNT,
+            subghz_scene_receiver_config_set_compact_raw,
+            subghz);
+
+        value_index = subghz->last_settings->compact_raw;
+        variable_item_set_current_value_index(item, value_index);
+        variable_item_set_current_value_text(item, combobox_text[value_index]);
     }
 
     variable_item_list_set_selected_item(
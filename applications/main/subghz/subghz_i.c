@@ -65,6 +65,8 @@ bool subghz_key_load(SubGhz* subghz, const char* file_path, bool show_dialog) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    // Optional keys are looked up and the file is rewound for the protocol
+    flipper_format_set_key_index(fff_data_file, true);
     Stream* fff_data_stream =
         flipper_format_get_raw_stream(subghz_txrx_get_fff_data(subghz->txrx));
 
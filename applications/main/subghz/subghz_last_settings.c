@@ -25,6 +25,7 @@
 #define SUBGHZ_LAST_SETTING_FIELD_ENABLE_SOUND "Sound"
 #define SUBGHZ_LAST_SETTING_FIELD_DELETE_OLD "DelOldSignals"
 #define SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE "Autosave"
+#define SUBGHZ_LAST_SETTING_FIELD_COMPACT_RAW "CompactRAW"
 
 SubGhzLastSettings* subghz_last_settings_alloc(void) {
     SubGhzLastSettings* instance = malloc(sizeof(SubGhzLastSettings));
@@ -55,6 +56,7 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
     bool temp_remove_duplicates = false;
     bool temp_delete_old_sig = false;
     bool temp_autosave = false;
+    bool temp_compact_raw = false;
     uint32_t temp_ignore_filter = 0;
     uint32_t temp_filter = 0;
     float temp_rssi = 0;
@@ -137,6 +139,8 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
             fff_data_file, SUBGHZ_LAST_SETTING_FIELD_DELETE_OLD, (bool*)&temp_delete_old_sig, 1);
         flipper_format_read_bool(
             fff_data_file, SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE, (bool*)&temp_autosave, 1);
+        flipper_format_read_bool(
+            fff_data_file, SUBGHZ_LAST_SETTING_FIELD_COMPACT_RAW, (bool*)&temp_compact_raw, 1);
 
     } else {
         FURI_LOG_E(TAG, "Error open file %s", SUBGHZ_LAST_SETTINGS_PATH);
@@ -160,6 +164,7 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
         instance->enable_sound = 0;
         instance->delete_old_signals = false;
         instance->autosave = false;
+        instance->compact_raw = false;
         instance->ignore_filter = 0x00;
         // See bin_raw_value in applications/main/subghz/scenes/subghz_scene_receiver_config.c
         instance->filter = SubGhzProtocolFlag_Decodable;
@@ -198,6 +203,8 @@ void subghz_last_settings_load(SubGhzLastSettings* instance, size_t preset_count
 
         instance->autosave = temp_autosave;
 
+        instance->compact_raw = temp_compact_raw;
+
         // External power amp CC1101
         instance->external_module_power_amp = temp_external_module_power_amp;
 
@@ -344,6 +351,10 @@ bool subghz_last_settings_save(SubGhzLastSettings* instance) {
                file, SUBGHZ_LAST_SETTING_FIELD_AUTOSAVE, &instance->autosave, 1)) {
             break;
         }
+        if(!flipper_format_insert_or_update_bool(
+               file, SUBGHZ_LAST_SETTING_FIELD_COMPACT_RAW, &instance->compact_raw, 1)) {
+            break;
+        }
         saved = true;
     } while(0);
 
@@ -8,6 +8,9 @@
 #include <notification/notification_messages.h>
 #include <loader/loader.h>
 #include <lib/toolbox/args.h>
+#include <lib/toolbox/trace.h>
+#include <lib/toolbox/stream/file_stream.h>
+#include <storage/storage.h>
 
 // Close to ISO, `date +'%Y-%m-%d %H:%M:%S %u'`
 #define CLI_DATE_FORMAT "%.4d-%.2d-%.2d %.2d:%.2d:%.2d %d"
@@ -202,15 +205,40 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
     return false;
 }
 
+bool cli_command_log_mode_set_from_string(FuriString* mode) {
+    if(furi_string_cmp_str(mode, "deferred") == 0) {
+        furi_log_set_mode(FuriLogModeDeferred);
+        return true;
+    } else if(furi_string_cmp_str(mode, "binary") == 0) {
+        furi_log_set_mode(FuriLogModeBinary);
+        return true;
+    } else {
+        printf(
+            "<log level deferred> — format records in background, callers are not delayed\r\n");
+        printf("<log level binary> — raw records, decode them with scripts/log_decode.py\r\n");
+    }
+    return false;
+}
+
 void cli_command_log(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriStreamBuffer* ring = furi_stream_buffer_alloc(CLI_COMMAND_LOG_RING_SIZE, 1);
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
+    FuriLogMode previous_mode = furi_log_get_mode();
     bool restore_log_level = false;
 
     if(furi_string_size(args) > 0) {
-        if(!cli_command_log_level_set_from_string(args)) {
+        FuriString* level = furi_string_alloc();
+        args_read_string_and_trim(args, level);
+        bool is_valid = cli_command_log_level_set_from_string(level);
+        if(is_valid && furi_string_size(args) > 0) {
+            is_valid = cli_command_log_mode_set_from_string(args);
+        }
+        furi_string_free(level);
+
+        if(!is_valid) {
+            furi_log_set_level(previous_level);
             furi_stream_buffer_free(ring);
             return;
         }
@@ -235,6 +263,8 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
         cli_write(cli, buffer, ret);
     }
 
+    // Queued records still go to the console
+    furi_log_set_mode(previous_mode);
     furi_log_remove_handler(log_handler);
 
     if(restore_log_level) {
@@ -320,6 +350,77 @@ void cli_command_sysctl(Cli* cli, FuriString* args, void* context) {
     furi_string_free(cmd);
 }
 
+void cli_command_trace_print_usage() {
+    printf("Usage:\r\n");
+    printf("trace <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+
+    printf(
+        "\tstart [events]\t - Start recording, events per thread, default %d\r\n",
+        TRACE_EVENTS_DEFAULT);
+    printf("\tstop\t - Stop recording\r\n");
+    printf("\tsave <path>\t - Save recorded trace as JSON, open it in ui.perfetto.dev\r\n");
+}
+
+void cli_command_trace_save(FuriString* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+
+    if(!file_stream_open(stream, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        printf("Failed to open %s\r\n", furi_string_get_cstr(path));
+    } else if(!trace_export(stream)) {
+        printf("Nothing to save or write error, stop recording first\r\n");
+    } else {
+        printf("Saved, %lu events dropped\r\n", trace_get_dropped_count());
+    }
+
+    file_stream_close(stream);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
+void cli_command_trace(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(context);
+    FuriString* cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            cli_command_trace_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "start") == 0) {
+            int events = TRACE_EVENTS_DEFAULT;
+            if(furi_string_size(args) && (!args_read_int_and_trim(args, &events) || events <= 0)) {
+                cli_print_usage("trace start", "[events]", furi_string_get_cstr(args));
+                break;
+            }
+            printf(trace_start(events) ? "Recording\r\n" : "Already recording\r\n");
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "stop") == 0) {
+            trace_stop();
+            printf("Stopped, %lu events dropped\r\n", trace_get_dropped_count());
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "save") == 0) {
+            if(!args_read_probably_quoted_string_and_trim(args, cmd)) {
+                cli_print_usage("trace save", "<path>", furi_string_get_cstr(args));
+                break;
+            }
+            cli_command_trace_save(cmd);
+            break;
+        }
+
+        cli_command_trace_print_usage();
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
 void cli_command_vibro(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(context);
@@ -421,6 +522,124 @@ void cli_command_ps(Cli* cli, FuriString* args, void* context) {
     printf("\r\nTotal: %d", thread_num);
 }
 
+#define CLI_COMMAND_TOP_THREADS_MAX 32
+#define CLI_COMMAND_TOP_INTERVAL_DEFAULT 1000
+#define CLI_COMMAND_TOP_INTERVAL_MIN 100
+
+typedef struct {
+    FuriThreadId thread_id;
+    uint64_t cpu_time;
+    uint32_t cpu_permille;
+} CliCommandTopThread;
+
+static uint32_t cli_command_top_sample(CliCommandTopThread* threads) {
+    FuriThreadId thread_ids[CLI_COMMAND_TOP_THREADS_MAX];
+    uint32_t count = furi_thread_enumerate(thread_ids, CLI_COMMAND_TOP_THREADS_MAX);
+    for(uint32_t i = 0; i < count; i++) {
+        threads[i].thread_id = thread_ids[i];
+        threads[i].cpu_time = furi_thread_get_cpu_time(thread_ids[i]);
+        threads[i].cpu_permille = 0;
+    }
+    return count;
+}
+
+/* CPU time of the period: difference to the previous sample, all of it for new threads */
+static void cli_command_top_calculate(
+    CliCommandTopThread* threads,
+    uint32_t count,
+    const CliCommandTopThread* previous,
+    uint32_t previous_count,
+    uint64_t period) {
+    for(uint32_t i = 0; i < count; i++) {
+        uint64_t cpu_time = threads[i].cpu_time;
+        for(uint32_t j = 0; j < previous_count; j++) {
+            if(previous[j].thread_id == threads[i].thread_id) {
+                cpu_time -= previous[j].cpu_time;
+                break;
+            }
+        }
+        threads[i].cpu_permille = MIN(cpu_time * 1000 / period, 1000ULL);
+    }
+
+    // Busiest first, insertion sort is fine for a few dozen threads
+    for(uint32_t i = 1; i < count; i++) {
+        CliCommandTopThread thread = threads[i];
+        uint32_t j = i;
+        for(; j > 0 && threads[j - 1].cpu_permille < thread.cpu_permille; j--) {
+            threads[j] = threads[j - 1];
+        }
+        threads[j] = thread;
+    }
+}
+
+void cli_command_top(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    int interval = CLI_COMMAND_TOP_INTERVAL_DEFAULT;
+    if(furi_string_size(args) &&
+       (!args_read_int_and_trim(args, &interval) || interval < CLI_COMMAND_TOP_INTERVAL_MIN)) {
+        cli_print_usage("top", "[interval in ms, 100 or more]", furi_string_get_cstr(args));
+        return;
+    }
+
+    CliCommandTopThread* threads =
+        malloc(sizeof(CliCommandTopThread) * CLI_COMMAND_TOP_THREADS_MAX);
+    CliCommandTopThread* previous =
+        malloc(sizeof(CliCommandTopThread) * CLI_COMMAND_TOP_THREADS_MAX);
+    const uint64_t cycles_per_ms = furi_hal_cortex_instructions_per_microsecond() * 1000;
+
+    uint32_t previous_count = cli_command_top_sample(previous);
+    uint32_t previous_tick = furi_get_tick();
+
+    printf("Press CTRL+C to stop...\r\n");
+    bool is_interrupted = false;
+    while(!is_interrupted) {
+        while(furi_get_tick() - previous_tick < (uint32_t)interval) {
+            is_interrupted = cli_cmd_interrupt_received(cli);
+            if(is_interrupted) break;
+            furi_delay_ms(50);
+        }
+        if(is_interrupted) break;
+
+        uint32_t count = cli_command_top_sample(threads);
+        const uint32_t tick = furi_get_tick();
+        const uint64_t period = MAX((tick - previous_tick) * cycles_per_ms, 1ULL);
+        cli_command_top_calculate(threads, count, previous, previous_count, period);
+
+        printf(
+            "\r\n%-20s %-20s %-6s %-8s %s\r\n", "Name", "AppID", "CPU", "Heap", "Stack min free");
+        uint32_t total_permille = 0;
+        for(uint32_t i = 0; i < count; i++) {
+            const char* name = furi_thread_get_name(threads[i].thread_id);
+            total_permille += threads[i].cpu_permille;
+            printf(
+                "%-20s %-20s %3lu.%lu%% %-8ld %lu\r\n",
+                name ? name : "",
+                furi_thread_get_appid(threads[i].thread_id),
+                threads[i].cpu_permille / 10,
+                threads[i].cpu_permille % 10,
+                furi_thread_get_heap_balance(threads[i].thread_id),
+                furi_thread_get_stack_space(threads[i].thread_id));
+        }
+        // Cycle counter stops in sleep, time spent there is not accounted to idle thread
+        total_permille = MIN(total_permille, 1000UL);
+        printf(
+            "Threads: %lu, awake: %lu.%lu%%, sleep: %lu.%lu%%\r\n",
+            count,
+            total_permille / 10,
+            total_permille % 10,
+            (1000 - total_permille) / 10,
+            (1000 - total_permille) % 10);
+
+        FURI_SWAP(threads, previous);
+        previous_count = count;
+        previous_tick = tick;
+    }
+
+    free(threads);
+    free(previous);
+}
+
 void cli_command_free(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
     UNUSED(args);
@@ -430,6 +649,7 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Total heap size: %zu\r\n", memmgr_get_total_heap());
     printf("Minimum heap size: %zu\r\n", memmgr_get_minimum_free_heap());
     printf("Maximum heap block: %zu\r\n", memmgr_heap_get_max_free_block());
+    printf("Free slab size: %zu\r\n", memmgr_heap_get_slab_free());
 
     printf("Pool free: %zu\r\n", memmgr_pool_get_free());
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
@@ -481,7 +701,9 @@ void cli_commands_init(Cli* cli) {
     cli_add_command(cli, "log", CliCommandFlagParallelSafe, cli_command_log, NULL);
     cli_add_command(cli, "l", CliCommandFlagParallelSafe, cli_command_log, NULL);
     cli_add_command(cli, "sysctl", CliCommandFlagDefault, cli_command_sysctl, NULL);
+    cli_add_command(cli, "trace", CliCommandFlagParallelSafe, cli_command_trace, NULL);
     cli_add_command(cli, "ps", CliCommandFlagParallelSafe, cli_command_ps, NULL);
+    cli_add_command(cli, "top", CliCommandFlagParallelSafe, cli_command_top, NULL);
     cli_add_command(cli, "free", CliCommandFlagParallelSafe, cli_command_free, NULL);
     cli_add_command(cli, "free_blocks", CliCommandFlagParallelSafe, cli_command_free_blocks, NULL);
 
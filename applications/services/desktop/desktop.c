@@ -351,6 +351,7 @@ Desktop* desktop_alloc() {
     view_port_draw_callback_set(
         desktop->lock_icon_viewport, desktop_lock_icon_draw_callback, desktop);
     view_port_enabled_set(desktop->lock_icon_viewport, false);
+    view_port_set_dirty_tracking(desktop->lock_icon_viewport, true);
     gui_add_view_port(desktop->gui, desktop->lock_icon_viewport, GuiLayerStatusBarLeft);
 
     // Clock
@@ -358,6 +359,8 @@ Desktop* desktop_alloc() {
     view_port_set_width(desktop->clock_viewport, 25);
     view_port_draw_callback_set(desktop->clock_viewport, desktop_clock_draw_callback, desktop);
     view_port_enabled_set(desktop->clock_viewport, false);
+    // Updated by desktop clock timer when displayed time changes
+    view_port_set_dirty_tracking(desktop->clock_viewport, true);
     gui_add_view_port(desktop->gui, desktop->clock_viewport, GuiLayerStatusBarRight);
 
     // Stealth mode icon
@@ -370,6 +373,7 @@ Desktop* desktop_alloc() {
     } else {
         view_port_enabled_set(desktop->stealth_mode_icon_viewport, false);
     }
+    view_port_set_dirty_tracking(desktop->stealth_mode_icon_viewport, true);
     gui_add_view_port(desktop->gui, desktop->stealth_mode_icon_viewport, GuiLayerStatusBarLeft);
 
     desktop->loader = furi_record_open(RECORD_LOADER);
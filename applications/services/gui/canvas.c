@@ -1,4 +1,5 @@
 #include "canvas_i.h"
+#include "canvas_blit.h"
 #include "icon_i.h"
 #include "icon_animation_i.h"
 
@@ -8,6 +9,9 @@
 #include <u8g2_glue.h>
 #include <xtreme/xtreme.h>
 
+/** Commits between full display updates */
+#define CANVAS_COMMIT_FULL_INTERVAL (64u)
+
 const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
     [FontPrimary] = {.leading_default = 12, .leading_min = 11, .height = 8, .descender = 2},
     [FontSecondary] = {.leading_default = 11, .leading_min = 9, .height = 7, .descender = 2},
@@ -23,10 +27,14 @@ const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
 Canvas* canvas_init() {
     Canvas* canvas = malloc(sizeof(Canvas));
     canvas->compress_icon = compress_icon_alloc();
+    canvas->icon_cache = canvas_icon_cache_alloc();
 
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
+    // Copy of the display content, first commit sends everything
+    canvas->committed = malloc(canvas_get_buffer_size(canvas));
+    canvas->commits_partial = CANVAS_COMMIT_FULL_INTERVAL;
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
     // Wake up display
@@ -41,7 +49,9 @@ Canvas* canvas_init() {
 
 void canvas_free(Canvas* canvas) {
     furi_assert(canvas);
+    canvas_icon_cache_free(canvas->icon_cache);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->committed);
     free(canvas);
 }
 
@@ -57,7 +67,72 @@ void canvas_reset(Canvas* canvas) {
 
 void canvas_commit(Canvas* canvas) {
     furi_assert(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+    canvas_commit_changes(canvas);
+}
+
+bool canvas_commit_changes(Canvas* canvas) {
+    furi_assert(canvas);
+
+    u8g2_t* u8g2 = &canvas->fb;
+    uint8_t* buffer = u8g2_GetBufferPtr(u8g2);
+    const uint8_t tile_width = u8g2_GetBufferTileWidth(u8g2);
+    const uint8_t tile_height = u8g2_GetBufferTileHeight(u8g2);
+    const size_t page_size = tile_width * 8;
+
+    const bool full = canvas->commits_partial >= CANVAS_COMMIT_FULL_INTERVAL;
+    canvas->commits_partial = full ? 0 : canvas->commits_partial + 1;
+
+    bool changed = false;
+    for(uint8_t ty = 0; ty < tile_height; ty++) {
+        uint8_t* page = &buffer[ty * page_size];
+        uint8_t* committed = &canvas->committed[ty * page_size];
+
+        // Send one span per page, from the first to the last changed tile
+        uint8_t first = tile_width;
+        uint8_t last = 0;
+        for(uint8_t tx = 0; tx < tile_width; tx++) {
+            if(memcmp(&page[tx * 8], &committed[tx * 8], 8) != 0) {
+                if(first == tile_width) first = tx;
+                last = tx;
+            }
+        }
+
+        if(first < tile_width) {
+            changed = true;
+            memcpy(&committed[first * 8], &page[first * 8], (last - first + 1) * 8);
+        }
+        if(full) {
+            u8g2_UpdateDisplayArea(u8g2, 0, ty, tile_width, 1);
+        } else if(first < tile_width) {
+            u8g2_UpdateDisplayArea(u8g2, first, ty, last - first + 1, 1);
+        }
+    }
+
+    if(full || changed) {
+        u8x8_RefreshDisplay(u8g2_GetU8x8(u8g2));
+    }
+
+    return changed;
+}
+
+void canvas_restore_rows(Canvas* canvas, uint64_t rows) {
+    furi_assert(canvas);
+
+    uint8_t* buffer = u8g2_GetBufferPtr(&canvas->fb);
+    const uint8_t tile_height = u8g2_GetBufferTileHeight(&canvas->fb);
+    const size_t page_size = u8g2_GetBufferTileWidth(&canvas->fb) * 8;
+    furi_assert(tile_height <= sizeof(rows));
+
+    // Pages are 8 rows high, LSB is the top row
+    for(uint8_t ty = 0; ty < tile_height; ty++) {
+        const uint8_t mask = rows >> (ty * 8);
+        if(!mask) continue;
+        uint8_t* page = &buffer[ty * page_size];
+        const uint8_t* committed = &canvas->committed[ty * page_size];
+        for(size_t x = 0; x < page_size; x++) {
+            page[x] = (page[x] & ~mask) | (committed[x] & mask);
+        }
+    }
 }
 
 uint8_t* canvas_get_buffer(Canvas* canvas) {
@@ -254,6 +329,15 @@ uint8_t canvas_glyph_width(Canvas* canvas, uint16_t symbol) {
     return u8g2_GetGlyphWidth(&canvas->fb, symbol);
 }
 
+static const uint8_t* canvas_decode_icon(
+    Canvas* canvas,
+    const uint8_t* icon_data,
+    size_t width,
+    size_t height) {
+    return canvas_icon_cache_decode(
+        canvas->icon_cache, canvas->compress_icon, icon_data, ((width + 7) / 8) * height);
+}
+
 void canvas_draw_bitmap(
     Canvas* canvas,
     uint8_t x,
@@ -265,8 +349,8 @@ void canvas_draw_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* bitmap_data = NULL;
-    compress_icon_decode(canvas->compress_icon, compressed_bitmap_data, &bitmap_data);
+    const uint8_t* bitmap_data =
+        canvas_decode_icon(canvas, compressed_bitmap_data, width, height);
     canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, bitmap_data, IconRotation0);
 }
 
@@ -280,9 +364,11 @@ void canvas_draw_icon_animation(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(
-        canvas->compress_icon, icon_animation_get_data(icon_animation), &icon_data);
+    const uint8_t* icon_data = canvas_decode_icon(
+        canvas,
+        icon_animation_get_data(icon_animation),
+        icon_animation_get_width(icon_animation),
+        icon_animation_get_height(icon_animation));
     canvas_draw_u8g2_bitmap(
         &canvas->fb,
         x,
@@ -382,6 +468,9 @@ void canvas_draw_u8g2_bitmap(
     if(u8g2_IsIntersection(u8g2, x, y, x + w, y + h) == 0) return;
 #endif /* U8G2_WITH_INTERSECTION */
 
+    // Pixel by pixel drawing is left for wrapping coordinates and other buffer layouts
+    if(canvas_blit_u8g2_bitmap(u8g2, x, y, w, h, bitmap, rotation)) return;
+
     switch(rotation) {
     case IconRotation0:
         canvas_draw_u8g2_bitmap_int(u8g2, x, y, w, h, 0, 0, bitmap);
@@ -411,8 +500,8 @@ void canvas_draw_icon_ex(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    const uint8_t* icon_data = canvas_decode_icon(
+        canvas, icon_get_data(icon), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, rotation);
 }
@@ -423,8 +512,8 @@ void canvas_draw_icon(Canvas* canvas, uint8_t x, uint8_t y, const Icon* icon) {
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    const uint8_t* icon_data = canvas_decode_icon(
+        canvas, icon_get_data(icon), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, IconRotation0);
 }
@@ -558,8 +647,8 @@ void canvas_draw_icon_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_data(icon), &icon_data);
+    const uint8_t* icon_data =
+        canvas_decode_icon(canvas, icon_get_data(icon), MAX(w, 0), MAX(h, 0));
     u8g2_DrawXBM(&canvas->fb, x, y, w, h, icon_data);
 }
 
@@ -0,0 +1,335 @@
+#include "canvas_blit.h"
+
+#include <furi.h>
+
+/* Largest coordinate u8g2 can address without wrapping around */
+#define CANVAS_BLIT_COORD_MAX ((int32_t)(u8g2_uint_t)~0U)
+
+/* Coordinate of source pixel (col, row): base + col * column step + row * row step */
+typedef struct {
+    int32_t base;
+    int32_t col;
+    int32_t row;
+} CanvasBlitAxis;
+
+/* Coordinate after display rotation: offset + x * logical x + y * logical y */
+typedef struct {
+    int32_t offset;
+    int32_t x;
+    int32_t y;
+} CanvasBlitTransform;
+
+typedef struct {
+    uint8_t* buffer;
+    size_t stride;
+    uint8_t color;
+    uint8_t ncolor;
+    bool transparent;
+} CanvasBlitTarget;
+
+static CanvasBlitAxis canvas_blit_transform(
+    const CanvasBlitTransform* transform,
+    const CanvasBlitAxis* x,
+    const CanvasBlitAxis* y) {
+    CanvasBlitAxis result = {
+        .base = transform->offset + transform->x * x->base + transform->y * y->base,
+        .col = transform->x * x->col + transform->y * y->col,
+        .row = transform->x * x->row + transform->y * y->row,
+    };
+    return result;
+}
+
+static bool canvas_blit_get_display_transform(
+    u8g2_t* u8g2,
+    CanvasBlitTransform* x,
+    CanvasBlitTransform* y) {
+    const int32_t width = u8g2->width;
+    const int32_t height = u8g2->height;
+
+    // Same pixel mapping as u8g2_draw_l90_* callbacks
+    if(u8g2->cb == U8G2_R0) {
+        *x = (CanvasBlitTransform){.offset = 0, .x = 1, .y = 0};
+        *y = (CanvasBlitTransform){.offset = 0, .x = 0, .y = 1};
+    } else if(u8g2->cb == U8G2_R1) {
+        *x = (CanvasBlitTransform){.offset = height - 1, .x = 0, .y = -1};
+        *y = (CanvasBlitTransform){.offset = 0, .x = 1, .y = 0};
+    } else if(u8g2->cb == U8G2_R2) {
+        *x = (CanvasBlitTransform){.offset = width - 1, .x = -1, .y = 0};
+        *y = (CanvasBlitTransform){.offset = height - 1, .x = 0, .y = -1};
+    } else if(u8g2->cb == U8G2_R3) {
+        *x = (CanvasBlitTransform){.offset = 0, .x = 0, .y = 1};
+        *y = (CanvasBlitTransform){.offset = width - 1, .x = -1, .y = 0};
+    } else if(u8g2->cb == U8G2_MIRROR) {
+        *x = (CanvasBlitTransform){.offset = width - 1, .x = -1, .y = 0};
+        *y = (CanvasBlitTransform){.offset = 0, .x = 0, .y = 1};
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+static bool canvas_blit_axis_fits(const CanvasBlitAxis* axis, int32_t w, int32_t h) {
+    int32_t first = axis->base;
+    int32_t last = axis->base + axis->col * (w - 1) + axis->row * (h - 1);
+    return first >= 0 && first <= CANVAS_BLIT_COORD_MAX && last >= 0 &&
+           last <= CANVAS_BLIT_COORD_MAX;
+}
+
+/* Narrow [from, to) so that base + step * index stays in [min, max) */
+static void canvas_blit_range_clip(
+    int32_t base,
+    int32_t step,
+    int32_t min,
+    int32_t max,
+    int32_t* from,
+    int32_t* to) {
+    int32_t low, high;
+    if(step > 0) {
+        low = min - base;
+        high = max - base;
+    } else {
+        low = base - max + 1;
+        high = base - min + 1;
+    }
+
+    if(*from < low) *from = low;
+    if(*to > high) *to = high;
+}
+
+static void canvas_blit_axis_clip(
+    const CanvasBlitAxis* axis,
+    int32_t min,
+    int32_t max,
+    int32_t* col_from,
+    int32_t* col_to,
+    int32_t* row_from,
+    int32_t* row_to) {
+    if(axis->col) {
+        canvas_blit_range_clip(axis->base, axis->col, min, max, col_from, col_to);
+    } else {
+        canvas_blit_range_clip(axis->base, axis->row, min, max, row_from, row_to);
+    }
+}
+
+/* Bits [col, col + count) of a bitmap row, first column in bit 0, count is 1..8 */
+static inline uint8_t canvas_blit_get_bits(const uint8_t* row, int32_t col, int32_t count) {
+    uint32_t value = u8x8_pgm_read(row + (col >> 3));
+    if((col & 7) + count > 8) {
+        value |= (uint32_t)u8x8_pgm_read(row + (col >> 3) + 1) << 8;
+    }
+    return (value >> (col & 7)) & ((1U << count) - 1);
+}
+
+static inline uint8_t canvas_blit_reverse(uint8_t value) {
+    value = (value & 0xF0) >> 4 | (value & 0x0F) << 4;
+    value = (value & 0xCC) >> 2 | (value & 0x33) << 2;
+    value = (value & 0xAA) >> 1 | (value & 0x55) << 1;
+    return value;
+}
+
+/* Transpose 8x8 bit matrix: bit (8 * i + j) goes to bit (8 * j + i) */
+static inline uint64_t canvas_blit_transpose(uint64_t value) {
+    uint64_t t;
+    t = (value ^ (value >> 7)) & 0x00AA00AA00AA00AAULL;
+    value ^= t ^ (t << 7);
+    t = (value ^ (value >> 14)) & 0x0000CCCC0000CCCCULL;
+    value ^= t ^ (t << 14);
+    t = (value ^ (value >> 28)) & 0x00000000F0F0F0F0ULL;
+    value ^= t ^ (t << 28);
+    return value;
+}
+
+/* Same as u8g2_ll_hvline_vertical_top_lsb does for a single pixel */
+static inline void canvas_blit_apply(uint8_t* ptr, uint8_t mask, uint8_t color) {
+    if(color <= 1) *ptr |= mask;
+    if(color != 1) *ptr ^= mask;
+}
+
+static inline void
+    canvas_blit_write(const CanvasBlitTarget* target, uint8_t* ptr, uint8_t mask, uint8_t bits) {
+    canvas_blit_apply(ptr, bits & mask, target->color);
+    if(!target->transparent) {
+        canvas_blit_apply(ptr, ~bits & mask, target->ncolor);
+    }
+}
+
+/* Source rows go along display pages: up to 8 rows are transposed into page bytes */
+static void canvas_blit_rows(
+    const CanvasBlitTarget* target,
+    const CanvasBlitAxis* x,
+    const CanvasBlitAxis* y,
+    const uint8_t* bitmap,
+    size_t row_size,
+    int32_t col_from,
+    int32_t col_to,
+    int32_t row_from,
+    int32_t row_to) {
+    for(int32_t row = row_from; row < row_to;) {
+        int32_t py = y->base + y->row * row;
+        int32_t bit = py & 7;
+        int32_t count = (y->row > 0) ? MIN(8 - bit, row_to - row) : MIN(bit + 1, row_to - row);
+
+        uint8_t mask = 0;
+        for(int32_t i = 0; i < count; i++) {
+            mask |= 1 << (bit + y->row * i);
+        }
+
+        uint8_t* page = target->buffer + (py >> 3) * target->stride;
+        for(int32_t col = col_from; col < col_to; col += 8) {
+            int32_t width = MIN(8, col_to - col);
+
+            uint64_t matrix = 0;
+            for(int32_t i = 0; i < count; i++) {
+                const uint8_t* source = bitmap + (row + i) * row_size;
+                matrix |= (uint64_t)canvas_blit_get_bits(source, col, width)
+                          << (8 * (bit + y->row * i));
+            }
+            matrix = canvas_blit_transpose(matrix);
+
+            for(int32_t i = 0; i < width; i++) {
+                int32_t px = x->base + x->col * (col + i);
+                canvas_blit_write(target, page + px, mask, matrix >> (8 * i));
+            }
+        }
+
+        row += count;
+    }
+}
+
+/* Source rows go across display pages: each row is written 8 pixels at a time */
+static void canvas_blit_columns(
+    const CanvasBlitTarget* target,
+    const CanvasBlitAxis* x,
+    const CanvasBlitAxis* y,
+    const uint8_t* bitmap,
+    size_t row_size,
+    int32_t col_from,
+    int32_t col_to,
+    int32_t row_from,
+    int32_t row_to) {
+    for(int32_t row = row_from; row < row_to; row++) {
+        const uint8_t* source = bitmap + row * row_size;
+        uint8_t* column = target->buffer + x->base + x->row * row;
+
+        for(int32_t col = col_from; col < col_to;) {
+            int32_t py = y->base + y->col * col;
+            int32_t bit = py & 7;
+            int32_t count;
+            uint8_t bits;
+
+            if(y->col > 0) {
+                count = MIN(8 - bit, col_to - col);
+                bits = canvas_blit_get_bits(source, col, count) << bit;
+                bit += count - 1;
+            } else {
+                count = MIN(bit + 1, col_to - col);
+                bits = canvas_blit_reverse(canvas_blit_get_bits(source, col, count)) >>
+                       (7 - bit);
+            }
+
+            uint8_t mask = (0xFF >> (7 - bit)) & (0xFF << (bit + 1 - count));
+            canvas_blit_write(target, column + (py >> 3) * target->stride, mask, bits);
+            col += count;
+        }
+    }
+}
+
+bool canvas_blit_u8g2_bitmap(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    const uint8_t* bitmap,
+    IconRotation rotation) {
+    furi_assert(u8g2);
+
+    if(u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb) return false;
+    if(u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height) return false;
+    if(u8g2->pixel_curr_row != 0) return false;
+
+    CanvasBlitTransform transform_x, transform_y;
+    if(!canvas_blit_get_display_transform(u8g2, &transform_x, &transform_y)) return false;
+
+    if(w == 0 || h == 0) return true;
+
+    // Logical position of source pixels, as canvas_draw_u8g2_bitmap_int walks them
+    CanvasBlitAxis logical_x, logical_y;
+    switch(rotation) {
+    case IconRotation0:
+        logical_x = (CanvasBlitAxis){.base = x, .col = 1, .row = 0};
+        logical_y = (CanvasBlitAxis){.base = y, .col = 0, .row = 1};
+        break;
+    case IconRotation90:
+        logical_x = (CanvasBlitAxis){.base = x + w + 1, .col = 0, .row = -1};
+        logical_y = (CanvasBlitAxis){.base = y, .col = 1, .row = 0};
+        break;
+    case IconRotation180:
+        logical_x = (CanvasBlitAxis){.base = x, .col = 1, .row = 0};
+        logical_y = (CanvasBlitAxis){.base = y + h - 1, .col = 0, .row = -1};
+        break;
+    case IconRotation270:
+        logical_x = (CanvasBlitAxis){.base = x, .col = 0, .row = 1};
+        logical_y = (CanvasBlitAxis){.base = y, .col = 1, .row = 0};
+        break;
+    default:
+        return true;
+    }
+
+    // Coordinates wrapping around u8g2_uint_t reappear on the other side, leave it to u8g2
+    if(!canvas_blit_axis_fits(&logical_x, w, h) || !canvas_blit_axis_fits(&logical_y, w, h)) {
+        return false;
+    }
+
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+    if(u8g2->is_page_clip_window_intersection == 0) return true;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+
+    // Visible part of the source, user window already includes the clip window
+    int32_t col_from = 0, col_to = w;
+    int32_t row_from = 0, row_to = h;
+    canvas_blit_axis_clip(
+        &logical_x, u8g2->user_x0, u8g2->user_x1, &col_from, &col_to, &row_from, &row_to);
+    canvas_blit_axis_clip(
+        &logical_y, u8g2->user_y0, u8g2->user_y1, &col_from, &col_to, &row_from, &row_to);
+    if(col_from >= col_to || row_from >= row_to) return true;
+
+    CanvasBlitAxis physical_x = canvas_blit_transform(&transform_x, &logical_x, &logical_y);
+    CanvasBlitAxis physical_y = canvas_blit_transform(&transform_y, &logical_x, &logical_y);
+
+    CanvasBlitTarget target = {
+        .buffer = u8g2->tile_buf_ptr,
+        .stride = u8g2->pixel_buf_width,
+        .color = u8g2->draw_color,
+        .ncolor = (u8g2->draw_color == 0 ? 1 : 0),
+        .transparent = (u8g2->bitmap_transparency != 0),
+    };
+    size_t row_size = (w + 7) / 8;
+
+    if(physical_x.col) {
+        canvas_blit_rows(
+            &target,
+            &physical_x,
+            &physical_y,
+            bitmap,
+            row_size,
+            col_from,
+            col_to,
+            row_from,
+            row_to);
+    } else {
+        canvas_blit_columns(
+            &target,
+            &physical_x,
+            &physical_y,
+            bitmap,
+            row_size,
+            col_from,
+            col_to,
+            row_from,
+            row_to);
+    }
+
+    return true;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file canvas_blit.h
+ * GUI: direct frame buffer bitmap drawing
+ */
+
+#pragma once
+
+#include "canvas.h"
+#include <u8g2.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Draw a u8g2 bitmap straight into the frame buffer, up to 8 pixels per write
+ *
+ * Result is the same as drawing the bitmap pixel by pixel with u8g2_DrawHVLine:
+ * display rotation, user and clip windows, draw color and bitmap transparency
+ * are respected. Only full frame buffers with vertical LSB first pages are supported.
+ *
+ * @param      u8g2      u8g2 instance
+ * @param      x         x coordinate
+ * @param      y         y coordinate
+ * @param      w         bitmap width
+ * @param      h         bitmap height
+ * @param      bitmap    bitmap data, rows of (w + 7) / 8 bytes, LSB first
+ * @param      rotation  bitmap rotation
+ *
+ * @return     true if handled, false if the bitmap must be drawn pixel by pixel
+ */
+bool canvas_blit_u8g2_bitmap(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    const uint8_t* bitmap,
+    IconRotation rotation);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,6 +8,7 @@
 #include "canvas.h"
 #include <u8g2.h>
 #include <toolbox/compress.h>
+#include "canvas_icon_cache.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,6 +24,9 @@ struct Canvas {
     uint8_t width;
     uint8_t height;
     CompressIcon* compress_icon;
+    CanvasIconCache* icon_cache;
+    uint8_t* committed;
+    uint8_t commits_partial;
 };
 
 /** Allocate memory and initialize canvas
@@ -37,6 +41,26 @@ Canvas* canvas_init();
  */
 void canvas_free(Canvas* canvas);
 
+/** Send changed part of canvas buffer to display
+ *
+ * Only tiles that differ from the previous commit are sent. Whole buffer is
+ * still sent once in a while, in case display memory got corrupted.
+ *
+ * @param      canvas  Canvas instance
+ *
+ * @return     true if buffer content is different from the previous commit
+ */
+bool canvas_commit_changes(Canvas* canvas);
+
+/** Restore buffer rows from the previous commit
+ *
+ * Used to keep content that was not redrawn since the previous commit.
+ *
+ * @param      canvas  Canvas instance
+ * @param      rows    bit mask of display rows, bit 0 is the top row
+ */
+void canvas_restore_rows(Canvas* canvas, uint64_t rows);
+
 /** Get canvas buffer.
  *
  * @param      canvas  Canvas instance
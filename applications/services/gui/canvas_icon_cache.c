@@ -0,0 +1,175 @@
+#include "canvas_icon_cache.h"
+
+#include <furi.h>
+#include <furi_hal_flash.h>
+
+/** Number of decoded frames kept */
+#define CANVAS_ICON_CACHE_ENTRIES (16u)
+
+/** Upper cache size limit, in bytes */
+#define CANVAS_ICON_CACHE_SIZE_MAX (4096u)
+
+/** Largest frame the icon decoder can produce, full screen */
+#define CANVAS_ICON_CACHE_FRAME_SIZE_MAX (1024u)
+
+/** Free heap the cache never competes for */
+#define CANVAS_ICON_CACHE_HEAP_RESERVE (16384u)
+
+/** Cache takes no more than 1/N of free heap above reserve */
+#define CANVAS_ICON_CACHE_HEAP_SHARE (4u)
+
+typedef struct {
+    const uint8_t* icon_data;
+    uint8_t* data;
+    size_t size;
+    uint32_t last_used;
+} CanvasIconCacheEntry;
+
+struct CanvasIconCache {
+    CanvasIconCacheEntry entries[CANVAS_ICON_CACHE_ENTRIES];
+    size_t size;
+    uint32_t clock;
+    uint32_t hits;
+    uint32_t misses;
+};
+
+CanvasIconCache* canvas_icon_cache_alloc(void) {
+    CanvasIconCache* cache = malloc(sizeof(CanvasIconCache));
+    memset(cache, 0, sizeof(CanvasIconCache));
+    return cache;
+}
+
+void canvas_icon_cache_free(CanvasIconCache* cache) {
+    furi_assert(cache);
+    canvas_icon_cache_shrink(cache, 0);
+    free(cache);
+}
+
+static bool canvas_icon_cache_is_persistent(const uint8_t* icon_data) {
+    // Application icons live in heap and their addresses are reused after exit
+    const size_t address = (size_t)icon_data;
+    return (address >= furi_hal_flash_get_base()) &&
+           (address < (size_t)furi_hal_flash_get_free_start_address());
+}
+
+static size_t canvas_icon_cache_get_limit(const CanvasIconCache* cache) {
+    // Cached frames are heap too: count them as available, or the cache would oscillate
+    const size_t available = memmgr_get_free_heap() + cache->size;
+    if(available <= CANVAS_ICON_CACHE_HEAP_RESERVE) {
+        return 0;
+    }
+    return MIN(
+        (available - CANVAS_ICON_CACHE_HEAP_RESERVE) / CANVAS_ICON_CACHE_HEAP_SHARE,
+        CANVAS_ICON_CACHE_SIZE_MAX);
+}
+
+static CanvasIconCacheEntry* canvas_icon_cache_find_victim(CanvasIconCache* cache) {
+    CanvasIconCacheEntry* victim = &cache->entries[0];
+    for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+        CanvasIconCacheEntry* entry = &cache->entries[i];
+        if(!entry->data) {
+            return entry;
+        } else if((int32_t)(entry->last_used - victim->last_used) < 0) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+static void canvas_icon_cache_evict(CanvasIconCache* cache, CanvasIconCacheEntry* entry) {
+    if(entry->data) {
+        free(entry->data);
+        cache->size -= entry->size;
+    }
+    entry->icon_data = NULL;
+    entry->data = NULL;
+    entry->size = 0;
+}
+
+void canvas_icon_cache_shrink(CanvasIconCache* cache, size_t size) {
+    furi_assert(cache);
+
+    while(cache->size > size) {
+        CanvasIconCacheEntry* victim = NULL;
+        for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+            CanvasIconCacheEntry* entry = &cache->entries[i];
+            if(entry->data &&
+               (!victim || (int32_t)(entry->last_used - victim->last_used) < 0)) {
+                victim = entry;
+            }
+        }
+        furi_check(victim);
+        canvas_icon_cache_evict(cache, victim);
+    }
+}
+
+const uint8_t* canvas_icon_cache_decode(
+    CanvasIconCache* cache,
+    CompressIcon* compress_icon,
+    const uint8_t* icon_data,
+    size_t size) {
+    furi_assert(cache);
+    furi_assert(compress_icon);
+    furi_assert(icon_data);
+
+    const size_t limit = canvas_icon_cache_get_limit(cache);
+    if(cache->size > limit) {
+        canvas_icon_cache_shrink(cache, limit);
+    }
+
+    for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+        CanvasIconCacheEntry* entry = &cache->entries[i];
+        if(entry->data && entry->icon_data == icon_data) {
+            if(entry->size >= size) {
+                entry->last_used = ++cache->clock;
+                cache->hits++;
+                return entry->data;
+            }
+            // Same frame drawn with a larger size, e.g. as XBM: keep the larger copy
+            canvas_icon_cache_evict(cache, entry);
+            break;
+        }
+    }
+
+    uint8_t* decoded = NULL;
+    compress_icon_decode(compress_icon, icon_data, &decoded);
+
+    // Uncompressed frames are used in place and there is nothing to save for them
+    if(decoded == icon_data + 1 || size == 0 || size > CANVAS_ICON_CACHE_FRAME_SIZE_MAX ||
+       !canvas_icon_cache_is_persistent(icon_data)) {
+        return decoded;
+    }
+
+    cache->misses++;
+    if(size > limit) {
+        return decoded;
+    }
+
+    canvas_icon_cache_shrink(cache, limit - size);
+    CanvasIconCacheEntry* entry = canvas_icon_cache_find_victim(cache);
+    canvas_icon_cache_evict(cache, entry);
+
+    entry->icon_data = icon_data;
+    entry->data = malloc(size);
+    entry->size = size;
+    entry->last_used = ++cache->clock;
+    memcpy(entry->data, decoded, size);
+    cache->size += size;
+
+    return entry->data;
+}
+
+void canvas_icon_cache_get_stats(const CanvasIconCache* cache, CanvasIconCacheStats* stats) {
+    furi_assert(cache);
+    furi_assert(stats);
+
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->size = cache->size;
+    stats->count = 0;
+    for(size_t i = 0; i < CANVAS_ICON_CACHE_ENTRIES; i++) {
+        if(cache->entries[i].data) {
+            stats->count++;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file canvas_icon_cache.h
+ * GUI: decoded icon frame cache
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <toolbox/compress.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct CanvasIconCache CanvasIconCache;
+
+typedef struct {
+    uint32_t hits; /**< frames served without decompression */
+    uint32_t misses; /**< cacheable frames that had to be decompressed */
+    size_t count; /**< frames held */
+    size_t size; /**< bytes of decoded data held */
+} CanvasIconCacheStats;
+
+/** Allocate empty icon cache
+ *
+ * @return     CanvasIconCache instance
+ */
+CanvasIconCache* canvas_icon_cache_alloc(void);
+
+/** Free icon cache and all decoded frames it holds
+ *
+ * @param      cache  CanvasIconCache instance
+ */
+void canvas_icon_cache_free(CanvasIconCache* cache);
+
+/** Get decoded frame, decompressing it only when it is not cached yet
+ *
+ * Only frames stored in the firmware image are cached: their address never
+ * gets reused for other data. Cache size follows free heap and shrinks as soon
+ * as free heap drops, so memory hungry applications do not lose to it.
+ *
+ * @warning    returned pointer is valid till next canvas_icon_cache_decode,
+ *             canvas_icon_cache_shrink or canvas_icon_cache_free call
+ *
+ * @param      cache          CanvasIconCache instance
+ * @param      compress_icon  CompressIcon instance used on cache miss
+ * @param      icon_data      compressed frame data
+ * @param      size           decoded frame size in bytes, 0 if unknown
+ *
+ * @return     decoded frame data
+ */
+const uint8_t* canvas_icon_cache_decode(
+    CanvasIconCache* cache,
+    CompressIcon* compress_icon,
+    const uint8_t* icon_data,
+    size_t size);
+
+/** Drop least recently used frames until cache holds no more than size bytes
+ *
+ * @param      cache  CanvasIconCache instance
+ * @param      size   size limit in bytes
+ */
+void canvas_icon_cache_shrink(CanvasIconCache* cache, size_t size);
+
+/** Get cache statistics
+ *
+ * @param      cache  CanvasIconCache instance
+ * @param      stats  pointer to CanvasIconCacheStats to fill
+ */
+void canvas_icon_cache_get_stats(const CanvasIconCache* cache, CanvasIconCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,6 +2,7 @@
 #include "gui_i.h"
 #include <assets_icons.h>
 #include <storage/storage.h>
+#include <toolbox/trace.h>
 #include <storage/storage_i.h>
 
 #define TAG "GuiSrv"
@@ -278,13 +279,70 @@ static bool gui_redraw_desktop(Gui* gui) {
     return false;
 }
 
+typedef enum {
+    GuiDirtyNone = 0,
+    GuiDirtyStatusBar = (1 << 0),
+    GuiDirtyMain = (1 << 1),
+    GuiDirtyAll = (GuiDirtyStatusBar | GuiDirtyMain),
+} GuiDirty;
+
+static GuiDirty gui_take_dirty(Gui* gui) {
+    GuiDirty dirty = gui->layout_changed ? GuiDirtyAll : GuiDirtyNone;
+    gui->layout_changed = false;
+
+    // Flags of hidden view ports are consumed too, they are drawn from scratch when shown
+    for(size_t i = 0; i < GuiLayerMAX; i++) {
+        ViewPortArray_it_t it;
+        for(ViewPortArray_it(it, gui->layers[i]); !ViewPortArray_end_p(it);
+            ViewPortArray_next(it)) {
+            if(view_port_take_dirty(*ViewPortArray_ref(it))) {
+                const bool is_status_bar =
+                    (i == GuiLayerStatusBarLeft || i == GuiLayerStatusBarRight);
+                dirty |= is_status_bar ? GuiDirtyStatusBar : GuiDirtyMain;
+            }
+        }
+    }
+
+    return dirty;
+}
+
 static void gui_redraw(Gui* gui) {
     furi_assert(gui);
+    trace_begin(TraceProbeGuiRedraw);
     gui_lock(gui);
 
     do {
         if(gui->direct_draw) break;
 
+        const bool layout_changed = gui->layout_changed;
+        GuiDirty dirty = gui_take_dirty(gui);
+        if(dirty == GuiDirtyNone) break;
+
+        const bool is_hand_orient_flip = furi_hal_rtc_is_flag_set(FuriHalRtcFlagHandOrient);
+
+        // Rows that keep content of the previous frame, layers that own them are not redrawn
+        uint64_t kept_rows = 0;
+
+        if(gui->lockdown) {
+            if(dirty == GuiDirtyStatusBar && !xtreme_settings.lockscreen_statusbar) break;
+        } else if(gui_view_port_find_enabled(gui->layers[GuiLayerFullscreen])) {
+            if(dirty == GuiDirtyStatusBar) break;
+        } else {
+            ViewPort* window = gui_view_port_find_enabled(gui->layers[GuiLayerWindow]);
+            // Window and status bar share no rows unless window is flipped relative to it,
+            // rows of a frame committed with other hand orientation are in wrong place
+            if(window && dirty != GuiDirtyAll &&
+               view_port_get_orientation(window) == ViewPortOrientationHorizontal &&
+               is_hand_orient_flip == gui->is_hand_orient_flip) {
+                const uint64_t status_bar_rows = is_hand_orient_flip ? GUI_STATUS_BAR_ROWS_FLIP :
+                                                                       GUI_STATUS_BAR_ROWS;
+                kept_rows = (dirty == GuiDirtyStatusBar) ? ~status_bar_rows : status_bar_rows;
+            } else {
+                dirty = GuiDirtyAll;
+            }
+        }
+
+        gui->is_hand_orient_flip = is_hand_orient_flip;
         canvas_reset(gui->canvas);
 
         if(gui->lockdown) {
@@ -297,14 +355,20 @@ static void gui_redraw(Gui* gui) {
             }
         } else {
             if(!gui_redraw_fs(gui)) {
-                if(!gui_redraw_window(gui)) {
-                    gui_redraw_desktop(gui);
+                if(dirty & GuiDirtyMain) {
+                    if(!gui_redraw_window(gui)) {
+                        gui_redraw_desktop(gui);
+                    }
+                }
+                if(dirty & GuiDirtyStatusBar) {
+                    gui_redraw_status_bar(gui, false);
                 }
-                gui_redraw_status_bar(gui, false);
             }
         }
 
-        canvas_commit(gui->canvas);
+        canvas_restore_rows(gui->canvas, kept_rows);
+
+        if(!canvas_commit_changes(gui->canvas) && !layout_changed) break;
         for
             M_EACH(p, gui->canvas_callback_pair, CanvasCallbackPairArray_t) {
                 p->callback(
@@ -316,6 +380,7 @@ static void gui_redraw(Gui* gui) {
     } while(false);
 
     gui_unlock(gui);
+    trace_end(TraceProbeGuiRedraw);
 }
 
 static void gui_input(Gui* gui, InputEvent* input_event) {
@@ -449,6 +514,7 @@ void gui_add_view_port(Gui* gui, ViewPort* view_port, GuiLayer layer) {
     // Add view port and link with gui
     ViewPortArray_push_back(gui->layers[layer], view_port);
     view_port_gui_set(view_port, gui);
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -475,6 +541,7 @@ void gui_remove_view_port(Gui* gui, ViewPort* view_port) {
     if(gui->ongoing_input_view_port == view_port) {
         gui->ongoing_input_view_port = NULL;
     }
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -504,6 +571,7 @@ void gui_view_port_send_to_front(Gui* gui, ViewPort* view_port) {
     furi_assert(layer != GuiLayerMAX);
     // Return to the top
     ViewPortArray_push_back(gui->layers[layer], view_port);
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -533,6 +601,7 @@ void gui_view_port_send_to_back(Gui* gui, ViewPort* view_port) {
     furi_assert(layer != GuiLayerMAX);
     // Return to the top
     ViewPortArray_push_at(gui->layers[layer], 0, view_port);
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -547,6 +616,8 @@ void gui_add_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, vo
     gui_lock(gui);
     furi_assert(!CanvasCallbackPairArray_count(gui->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(gui->canvas_callback_pair, p);
+    // New subscriber needs a frame even if nothing changed
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -578,6 +649,7 @@ void gui_set_hide_statusbar(Gui* gui, bool hidden) {
     } else {
         gui->hide_statusbar_count--;
     }
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -589,6 +661,7 @@ void gui_set_lockdown(Gui* gui, bool lockdown) {
 
     gui_lock(gui);
     gui->lockdown = lockdown;
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     // Request redraw
@@ -615,6 +688,7 @@ void gui_direct_draw_release(Gui* gui) {
 
     gui_lock(gui);
     gui->direct_draw = false;
+    gui->layout_changed = true;
     gui_unlock(gui);
 
     gui_update(gui);
@@ -633,6 +707,8 @@ Gui* gui_alloc() {
     }
     // Drawing canvas
     gui->canvas = canvas_init();
+    gui->layout_changed = true;
+    gui->is_hand_orient_flip = furi_hal_rtc_is_flag_set(FuriHalRtcFlagHandOrient);
     CanvasCallbackPairArray_init(gui->canvas_callback_pair);
 
     // Input
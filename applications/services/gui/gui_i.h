@@ -38,6 +38,11 @@
 #define GUI_WINDOW_WIDTH GUI_DISPLAY_WIDTH
 #define GUI_WINDOW_HEIGHT (GUI_DISPLAY_HEIGHT - GUI_WINDOW_Y)
 
+/* Bit masks of display rows that layers occupy */
+#define GUI_STATUS_BAR_ROWS ((1ULL << GUI_STATUS_BAR_HEIGHT) - 1)
+#define GUI_STATUS_BAR_ROWS_FLIP \
+    (GUI_STATUS_BAR_ROWS << (GUI_DISPLAY_HEIGHT - GUI_STATUS_BAR_HEIGHT))
+
 #define GUI_THREAD_FLAG_DRAW (1 << 0)
 #define GUI_THREAD_FLAG_INPUT (1 << 1)
 #define GUI_THREAD_FLAG_ASCII (1 << 2)
@@ -65,6 +70,8 @@ struct Gui {
     // Layers and Canvas
     bool lockdown;
     bool direct_draw;
+    bool layout_changed;
+    bool is_hand_orient_flip; /**< Hand orientation of committed frame */
     ViewPortArray_t layers[GuiLayerMAX];
     Canvas* canvas;
     CanvasCallbackPairArray_t canvas_callback_pair;
@@ -13,6 +13,8 @@ ViewDispatcher* view_dispatcher_alloc() {
     view_port_ascii_callback_set(
         view_dispatcher->view_port, view_dispatcher_ascii_callback, view_dispatcher);
     view_port_enabled_set(view_dispatcher->view_port, false);
+    // Views redraw through model commit
+    view_port_set_dirty_tracking(view_dispatcher->view_port, true);
 
     ViewDict_init(view_dispatcher->views);
 
@@ -94,6 +94,8 @@ ViewPort* view_port_alloc() {
     ViewPort* view_port = malloc(sizeof(ViewPort));
     view_port->orientation = ViewPortOrientationHorizontal;
     view_port->is_enabled = true;
+    view_port->is_dirty = true;
+    view_port->is_dirty_tracked = false;
     view_port->mutex = furi_mutex_alloc(FuriMutexTypeRecursive);
     return view_port;
 }
@@ -111,6 +113,7 @@ void view_port_set_width(ViewPort* view_port, uint8_t width) {
     furi_assert(view_port);
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     view_port->width = width;
+    view_port->is_dirty = true;
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
@@ -126,6 +129,7 @@ void view_port_set_height(ViewPort* view_port, uint8_t height) {
     furi_assert(view_port);
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     view_port->height = height;
+    view_port->is_dirty = true;
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
@@ -142,6 +146,7 @@ void view_port_enabled_set(ViewPort* view_port, bool enabled) {
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     if(view_port->is_enabled != enabled) {
         view_port->is_enabled = enabled;
+        view_port->is_dirty = true;
         if(view_port->gui) gui_update(view_port->gui);
     }
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
@@ -160,6 +165,7 @@ void view_port_draw_callback_set(ViewPort* view_port, ViewPortDrawCallback callb
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     view_port->draw_callback = callback;
     view_port->draw_callback_context = context;
+    view_port->is_dirty = true;
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
@@ -194,7 +200,10 @@ void view_port_update(ViewPort* view_port) {
         FURI_LOG_W(TAG, "ViewPort lockup: see %s:%d", __FILE__, __LINE__ - 3);
     }
 
-    if(view_port->gui && view_port->is_enabled) gui_update(view_port->gui);
+    if(view_port->gui && view_port->is_enabled) {
+        view_port->is_dirty = true;
+        gui_update(view_port->gui);
+    }
     furi_mutex_release(view_port->mutex);
 }
 
@@ -205,6 +214,29 @@ void view_port_gui_set(ViewPort* view_port, Gui* gui) {
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
+void view_port_set_dirty_tracking(ViewPort* view_port, bool enable) {
+    furi_assert(view_port);
+    furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
+    view_port->is_dirty_tracked = enable;
+    view_port->is_dirty = true;
+    furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
+}
+
+bool view_port_take_dirty(ViewPort* view_port) {
+    furi_assert(view_port);
+
+    // Called with gui locked: same timeout as view_port_draw, busy ViewPort is redrawn
+    if(furi_mutex_acquire(view_port->mutex, 2) != FuriStatusOk) {
+        return true;
+    }
+
+    bool is_dirty = view_port->is_dirty ||
+                    (view_port->is_enabled && !view_port->is_dirty_tracked);
+    view_port->is_dirty = false;
+    furi_mutex_release(view_port->mutex);
+    return is_dirty;
+}
+
 void view_port_draw(ViewPort* view_port, Canvas* canvas) {
     furi_assert(view_port);
     furi_assert(canvas);
@@ -290,6 +322,7 @@ void view_port_set_orientation(ViewPort* view_port, ViewPortOrientation orientat
     furi_assert(view_port);
     furi_check(furi_mutex_acquire(view_port->mutex, FuriWaitForever) == FuriStatusOk);
     view_port->orientation = orientation;
+    view_port->is_dirty = true;
     furi_check(furi_mutex_release(view_port->mutex) == FuriStatusOk);
 }
 
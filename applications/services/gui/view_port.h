@@ -107,6 +107,17 @@ void view_port_ascii_callback_set(
  */
 void view_port_update(ViewPort* view_port);
 
+/** Enable ViewPort dirty tracking.
+ *
+ * By default ViewPort is redrawn on every GUI frame. With dirty tracking it is
+ * redrawn only after view_port_update or reconfiguration, enable it only when
+ * every change of drawn content is followed by view_port_update.
+ *
+ * @param      view_port  ViewPort instance
+ * @param      enable     true to redraw only when updated
+ */
+void view_port_set_dirty_tracking(ViewPort* view_port, bool enable);
+
 /** Set ViewPort orientation.
  *
  * @param      view_port    ViewPort instance
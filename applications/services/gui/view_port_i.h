@@ -12,6 +12,8 @@ struct ViewPort {
     Gui* gui;
     FuriMutex* mutex;
     bool is_enabled;
+    bool is_dirty;
+    bool is_dirty_tracked;
     ViewPortOrientation orientation;
 
     uint8_t width;
@@ -36,6 +38,18 @@ struct ViewPort {
  */
 void view_port_gui_set(ViewPort* view_port, Gui* gui);
 
+/** Get and clear dirty flag.
+ *
+ * To be used by GUI, called on tree redraw. ViewPort is dirty when it was
+ * updated, enabled, disabled or reconfigured since the previous call. Enabled
+ * ViewPort without dirty tracking and ViewPort which is busy are always dirty.
+ *
+ * @param      view_port  ViewPort instance
+ *
+ * @return     true if ViewPort must be redrawn
+ */
+bool view_port_take_dirty(ViewPort* view_port);
+
 /** Process draw call. Calls draw callback.
  *
  * To be used by GUI, called on tree redraw.
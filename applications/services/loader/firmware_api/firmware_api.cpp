@@ -2,6 +2,7 @@
 
 #include <flipper_application/api_hashtable/api_hashtable.h>
 #include <flipper_application/api_hashtable/compilesort.hpp>
+#include <flipper_application/api_hashtable/compilehash.hpp>
 
 /* Generated table */
 #include <firmware_api_table.h>
@@ -9,32 +10,61 @@
 #include <furi_hal_info.h>
 
 static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
+static_assert(elf_api_perfect_hash.is_valid, "Failed to build API perfect hash table!");
 
 #ifdef APP_UNIT_TESTS
-constexpr HashtableApiInterface mock_elf_api_interface{
+constexpr PerfectHashApiInterface mock_elf_api_interface{
     {
         .api_version_major = 0,
         .api_version_minor = 0,
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hash,
     },
-    .table_cbegin = nullptr,
-    .table_cend = nullptr,
+    .table = nullptr,
+    .displacements = nullptr,
+    .table_size = 0,
+    .displacements_size = 0,
 };
 
 const ElfApiInterface* const firmware_api_interface = &mock_elf_api_interface;
 #else
-constexpr HashtableApiInterface elf_api_interface{
+constexpr PerfectHashApiInterface elf_api_interface{
     {
         .api_version_major = (elf_api_version >> 16),
         .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hash,
     },
-    .table_cbegin = elf_api_table.cbegin(),
-    .table_cend = elf_api_table.cend(),
+    .table = elf_api_perfect_hash.table.data(),
+    .displacements = elf_api_perfect_hash.displacements.data(),
+    .table_size = elf_api_perfect_hash.table.size(),
+    .displacements_size = elf_api_perfect_hash.displacements.size(),
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 #endif
 
+extern "C" uint32_t firmware_api_get_table_hash(void) {
+    static uint32_t table_hash = 0;
+
+    if(!table_hash) {
+        const PerfectHashApiInterface* perfect_hash_interface =
+            static_cast<const PerfectHashApiInterface*>(firmware_api_interface);
+
+        // FNV-1a
+        uint32_t hash = 0x811C9DC5;
+        for(size_t i = 0; i < perfect_hash_interface->table_size; i++) {
+            const sym_entry* entry = &perfect_hash_interface->table[i];
+            const uint32_t values[] = {entry->hash, entry->address};
+            for(const uint32_t value : values) {
+                for(size_t i = 0; i < sizeof(value); i++) {
+                    hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 0x01000193;
+                }
+            }
+        }
+        table_hash = hash;
+    }
+
+    return table_hash;
+}
+
 extern "C" void furi_hal_info_get_api_version(uint16_t* major, uint16_t* minor) {
     *major = firmware_api_interface->api_version_major;
     *minor = firmware_api_interface->api_version_minor;
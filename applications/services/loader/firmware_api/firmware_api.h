@@ -2,4 +2,19 @@
 
 #include <flipper_application/elf/elf_api_interface.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const ElfApiInterface* const firmware_api_interface;
+
+/**
+ * @brief Get hash of firmware API table: symbol hashes and addresses
+ * Changes with every firmware build that moves any exported symbol
+ * @return table hash
+ */
+uint32_t firmware_api_get_table_hash(void);
+
+#ifdef __cplusplus
+}
+#endif
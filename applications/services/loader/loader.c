@@ -9,6 +9,7 @@
 #include <dialogs/dialogs.h>
 #include <toolbox/path.h>
 #include <flipper_application/flipper_application.h>
+#include <flipper_application/application_meta_cache.h>
 #include <loader/firmware_api/firmware_api.h>
 #include <toolbox/stream/file_stream.h>
 #include <core/dangerous_defines.h>
@@ -175,13 +176,13 @@ static void loader_thread_state_callback(FuriThreadState thread_state, void* con
 // implementation
 
 bool loader_menu_load_fap_meta(
-    Storage* storage,
+    FlipperApplicationMetaCache* meta_cache,
     FuriString* path,
     FuriString* name,
     const Icon** icon) {
     *icon = NULL;
     uint8_t* icon_buf = malloc(CUSTOM_ICON_MAX_SIZE);
-    if(!flipper_application_load_name_and_icon(path, storage, &icon_buf, name)) {
+    if(!flipper_application_meta_cache_load_name_and_icon(meta_cache, path, &icon_buf, name)) {
         free(icon_buf);
         icon_buf = NULL;
         return false;
@@ -236,6 +237,7 @@ static Loader* loader_alloc() {
     if(!furi_hal_is_normal_boot()) return loader;
     Storage* storage = furi_record_open(RECORD_STORAGE);
     Stream* stream = file_stream_alloc(storage);
+    FlipperApplicationMetaCache* meta_cache = flipper_application_meta_cache_alloc(storage);
     FuriString* line = furi_string_alloc();
     FuriString* name = furi_string_alloc();
     do {
@@ -268,7 +270,7 @@ static Loader* loader_alloc() {
             const Icon* icon = NULL;
             const char* exe = NULL;
             if(storage_file_exists(storage, furi_string_get_cstr(line))) {
-                if(loader_menu_load_fap_meta(storage, line, name, &icon)) {
+                if(loader_menu_load_fap_meta(meta_cache, line, name, &icon)) {
                     label = strdup(furi_string_get_cstr(name));
                     exe = strdup(furi_string_get_cstr(line));
                 }
@@ -297,6 +299,7 @@ static Loader* loader_alloc() {
     } while(false);
     furi_string_free(name);
     furi_string_free(line);
+    flipper_application_meta_cache_free(meta_cache);
     file_stream_close(stream);
     stream_free(stream);
     furi_record_close(RECORD_STORAGE);
@@ -424,6 +427,8 @@ static LoaderStatus loader_start_external_app(
 
     do {
         loader->app.fap = flipper_application_alloc(storage, firmware_api_interface);
+        flipper_application_set_relocation_snapshot(loader->app.fap, true);
+        flipper_application_set_streaming_load(loader->app.fap, true);
         size_t start = furi_get_tick();
 
         FURI_LOG_I(TAG, "Loading %s", path);
@@ -2,6 +2,7 @@
 #include "loader_applications.h"
 #include <dialogs/dialogs.h>
 #include <flipper_application/flipper_application.h>
+#include <flipper_application/application_meta_cache.h>
 #include <assets_icons.h>
 #include <gui/gui.h>
 #include <gui/view_holder.h>
@@ -39,6 +40,7 @@ typedef struct {
     FuriString* fap_path;
     DialogsApp* dialogs;
     Storage* storage;
+    FlipperApplicationMetaCache* meta_cache;
     Loader* loader;
 
     Gui* gui;
@@ -51,6 +53,7 @@ static LoaderApplicationsApp* loader_applications_app_alloc() {
     app->fap_path = furi_string_alloc_set(EXT_PATH("apps"));
     app->dialogs = furi_record_open(RECORD_DIALOGS);
     app->storage = furi_record_open(RECORD_STORAGE);
+    app->meta_cache = flipper_application_meta_cache_alloc(app->storage);
     app->loader = furi_record_open(RECORD_LOADER);
 
     app->gui = furi_record_open(RECORD_GUI);
@@ -72,6 +75,7 @@ static void loader_applications_app_free(LoaderApplicationsApp* app) {
 
     furi_record_close(RECORD_LOADER);
     furi_record_close(RECORD_DIALOGS);
+    flipper_application_meta_cache_free(app->meta_cache);
     furi_record_close(RECORD_STORAGE);
     furi_string_free(app->fap_path);
     free(app);
@@ -84,8 +88,8 @@ static bool loader_applications_item_callback(
     FuriString* item_name) {
     LoaderApplicationsApp* loader_applications_app = context;
     furi_assert(loader_applications_app);
-    return flipper_application_load_name_and_icon(
-        path, loader_applications_app->storage, icon_ptr, item_name);
+    return flipper_application_meta_cache_load_name_and_icon(
+        loader_applications_app->meta_cache, path, icon_ptr, item_name);
 }
 
 static bool loader_applications_select_app(LoaderApplicationsApp* loader_applications_app) {
@@ -245,6 +245,8 @@ static ViewPort* power_battery_view_port_alloc(Power* power) {
     ViewPort* battery_view_port = view_port_alloc();
     view_port_set_width(battery_view_port, icon_get_width(&I_Battery_25x8));
     view_port_draw_callback_set(battery_view_port, power_draw_battery_callback, power);
+    // Updated by power service loop when battery info changes
+    view_port_set_dirty_tracking(battery_view_port, true);
     gui_add_view_port(power->gui, battery_view_port, GuiLayerStatusBarRight);
     return battery_view_port;
 }
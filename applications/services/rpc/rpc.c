@@ -84,6 +84,7 @@ struct RpcSession {
     RpcSessionClosedCallback closed_callback;
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
+    uint32_t screen_stream_keyframe_interval;
     void* context;
 };
 
@@ -185,6 +186,16 @@ size_t rpc_session_get_available_size(RpcSession* session) {
     return furi_stream_buffer_spaces_available(session->stream);
 }
 
+void rpc_session_set_screen_stream_delta(RpcSession* session, uint32_t keyframe_interval) {
+    furi_assert(session);
+    session->screen_stream_keyframe_interval = keyframe_interval;
+}
+
+uint32_t rpc_session_get_screen_stream_delta(RpcSession* session) {
+    furi_assert(session);
+    return session->screen_stream_keyframe_interval;
+}
+
 bool rpc_pb_stream_read(pb_istream_t* istream, pb_byte_t* buf, size_t count) {
     furi_assert(istream);
     furi_assert(buf);
@@ -391,6 +402,7 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     session->terminate = false;
     session->decode_error = false;
     session->owner = owner;
+    session->screen_stream_keyframe_interval = 0;
     RpcHandlerDict_init(session->handlers);
 
     session->decoded_message = malloc(sizeof(PB_Main));
@@ -452,9 +464,15 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
-void rpc_send(RpcSession* session, PB_Main* message) {
+void rpc_send_with_buffer(
+    RpcSession* session,
+    PB_Main* message,
+    uint8_t** buffer_ptr,
+    size_t* buffer_size) {
     furi_assert(session);
     furi_assert(message);
+    furi_assert(buffer_ptr);
+    furi_assert(buffer_size);
 
     pb_ostream_t ostream = PB_OSTREAM_SIZING;
 
@@ -466,7 +484,12 @@ void rpc_send(RpcSession* session, PB_Main* message) {
     bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
     furi_check(result && ostream.bytes_written);
 
-    uint8_t* buffer = malloc(ostream.bytes_written);
+    if(*buffer_size < ostream.bytes_written) {
+        free(*buffer_ptr);
+        *buffer_ptr = malloc(ostream.bytes_written);
+        *buffer_size = ostream.bytes_written;
+    }
+    uint8_t* buffer = *buffer_ptr;
     ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
 
     pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
@@ -480,7 +503,12 @@ void rpc_send(RpcSession* session, PB_Main* message) {
         session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
     }
     furi_mutex_release(session->callbacks_mutex);
+}
 
+void rpc_send(RpcSession* session, PB_Main* message) {
+    uint8_t* buffer = NULL;
+    size_t buffer_size = 0;
+    rpc_send_with_buffer(session, message, &buffer, &buffer_size);
     free(buffer);
 }
 
@@ -11,6 +11,9 @@ extern "C" {
 
 #define RPC_BUFFER_SIZE (1024)
 
+/** Default number of delta frames between screen stream keyframes */
+#define RPC_SCREEN_STREAM_KEYFRAME_INTERVAL (32)
+
 #define RECORD_RPC "rpc"
 
 /** Rpc interface. Used for opening session only. */
@@ -135,6 +138,30 @@ size_t rpc_session_feed(RpcSession* session, const uint8_t* buffer, size_t size,
  */
 size_t rpc_session_get_available_size(RpcSession* session);
 
+/** Enable delta compressed screen streaming for session
+ *
+ * Applies to screen streams started afterwards. ScreenFrame data is then:
+ * - byte 0: frame type, 0x00 for keyframe, 0x01 for delta frame
+ * - bytes 1..: frame XOR previous transmitted frame (XOR nothing for keyframes)
+ *   in compress_encode() format: 0x01, 0x00, uint16 LE size including this
+ *   header, heatshrink data (window 8, lookahead 4); or 0x00 followed by raw data
+ *
+ * Frames are skipped while session buffer is congested, delta always refers to
+ * the previous transmitted frame.
+ *
+ * @param   session             pointer to RpcSession descriptor
+ * @param   keyframe_interval   delta frames between keyframes, 0 for raw frames (default)
+ */
+void rpc_session_set_screen_stream_delta(RpcSession* session, uint32_t keyframe_interval);
+
+/** Get delta compressed screen streaming keyframe interval
+ *
+ * @param   session     pointer to RpcSession descriptor
+ *
+ * @return              delta frames between keyframes, 0 if raw frames are streamed
+ */
+uint32_t rpc_session_get_screen_stream_delta(RpcSession* session);
+
 /** Get number of open RPC sessions
  *
  * @param   rpc     instance
@@ -2,6 +2,7 @@
 #include <furi.h>
 #include <rpc/rpc.h>
 #include <furi_hal.h>
+#include <toolbox/args.h>
 
 #define TAG "RpcCli"
 
@@ -36,8 +37,26 @@ static void rpc_cli_session_terminated_callback(void* context) {
     furi_semaphore_release(cli_rpc->terminate_semaphore);
 }
 
+// Optional arguments: screen_delta [keyframe interval]
+static uint32_t rpc_cli_read_screen_stream_delta(FuriString* args) {
+    uint32_t keyframe_interval = 0;
+    FuriString* option = furi_string_alloc();
+
+    if(args_read_string_and_trim(args, option) &&
+       furi_string_cmp_str(option, "screen_delta") == 0) {
+        int value = 0;
+        if(args_read_int_and_trim(args, &value) && value > 0) {
+            keyframe_interval = value;
+        } else {
+            keyframe_interval = RPC_SCREEN_STREAM_KEYFRAME_INTERVAL;
+        }
+    }
+
+    furi_string_free(option);
+    return keyframe_interval;
+}
+
 void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
-    UNUSED(args);
     furi_assert(cli);
     furi_assert(context);
     Rpc* rpc = context;
@@ -53,6 +72,8 @@ void rpc_cli_command_start_session(Cli* cli, FuriString* args, void* context) {
         return;
     }
 
+    rpc_session_set_screen_stream_delta(rpc_session, rpc_cli_read_screen_stream_delta(args));
+
     CliRpc cli_rpc = {.cli = cli, .session_close_request = false};
     cli_rpc.terminate_semaphore = furi_semaphore_alloc(1, 0);
     rpc_session_set_context(rpc_session, &cli_rpc);
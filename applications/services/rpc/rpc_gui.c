@@ -1,6 +1,7 @@
 #include "rpc_i.h"
 #include <gui/gui_i.h>
 #include <assets_icons.h>
+#include <toolbox/compress.h>
 
 #include <flipper.pb.h>
 #include <gui.pb.h>
@@ -51,6 +52,32 @@ typedef enum {
 
 #define RPC_GUI_INPUT_RESET (0u)
 
+/** Delta frames are held back while less than this is free in session buffer */
+#define RPC_GUI_SCREEN_DELTA_CONGESTION (RPC_BUFFER_SIZE / 4)
+/** Held back frame is retried after this many ticks */
+#define RPC_GUI_SCREEN_DELTA_RETRY (50)
+
+typedef enum {
+    RpcGuiScreenFrameKey = 0x00,
+    RpcGuiScreenFrameDelta = 0x01,
+} RpcGuiScreenFrameType;
+
+typedef struct {
+    FuriMutex* mutex;
+    uint32_t keyframe_interval;
+    uint32_t frames_since_keyframe;
+    bool is_pending;
+
+    // Latest frame from GUI, guarded by mutex
+    uint8_t* frame;
+    CanvasOrientation orientation;
+
+    // Transmit thread only
+    uint8_t* reference;
+    uint8_t* delta;
+    Compress* compress;
+} RpcGuiScreenDelta;
+
 typedef struct {
     RpcSession* session;
     Gui* gui;
@@ -62,6 +89,7 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    RpcGuiScreenDelta* screen_delta;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -99,17 +127,114 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
 
+static void rpc_system_gui_screen_delta_frame_callback(
+    uint8_t* data,
+    size_t size,
+    CanvasOrientation orientation,
+    void* context) {
+    furi_assert(data);
+    furi_assert(context);
+
+    RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
+    RpcGuiScreenDelta* screen_delta = rpc_gui->screen_delta;
+
+    furi_check(furi_mutex_acquire(screen_delta->mutex, FuriWaitForever) == FuriStatusOk);
+    memcpy(screen_delta->frame, data, size);
+    screen_delta->orientation = orientation;
+    furi_check(furi_mutex_release(screen_delta->mutex) == FuriStatusOk);
+
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
+}
+
+static RpcGuiScreenDelta* rpc_system_gui_screen_delta_alloc(size_t size, uint32_t interval) {
+    RpcGuiScreenDelta* screen_delta = malloc(sizeof(RpcGuiScreenDelta));
+    screen_delta->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    screen_delta->keyframe_interval = interval;
+    // First frame is always a keyframe
+    screen_delta->frames_since_keyframe = interval;
+    screen_delta->is_pending = false;
+    screen_delta->frame = malloc(size);
+    screen_delta->orientation = CanvasOrientationHorizontal;
+    screen_delta->reference = malloc(size);
+    screen_delta->delta = malloc(size);
+    screen_delta->compress = compress_alloc(size);
+    return screen_delta;
+}
+
+static void rpc_system_gui_screen_delta_free(RpcGuiScreenDelta* screen_delta) {
+    compress_free(screen_delta->compress);
+    free(screen_delta->delta);
+    free(screen_delta->reference);
+    free(screen_delta->frame);
+    furi_mutex_free(screen_delta->mutex);
+    free(screen_delta);
+}
+
+/* Fill transmit frame with the next delta frame, false if it must wait */
+static bool rpc_system_gui_screen_delta_encode(RpcGuiSystem* rpc_gui) {
+    RpcGuiScreenDelta* screen_delta = rpc_gui->screen_delta;
+    PB_Gui_ScreenFrame* screen_frame = &rpc_gui->transmit_frame->content.gui_screen_frame;
+    const size_t size = gui_get_framebuffer_size(rpc_gui->gui);
+
+    if(rpc_session_get_available_size(rpc_gui->session) < RPC_GUI_SCREEN_DELTA_CONGESTION) {
+        screen_delta->is_pending = true;
+        return false;
+    }
+    screen_delta->is_pending = false;
+
+    const bool is_keyframe =
+        (screen_delta->frames_since_keyframe >= screen_delta->keyframe_interval);
+    if(is_keyframe) {
+        screen_delta->frames_since_keyframe = 1;
+    } else {
+        screen_delta->frames_since_keyframe++;
+    }
+
+    furi_check(furi_mutex_acquire(screen_delta->mutex, FuriWaitForever) == FuriStatusOk);
+    for(size_t i = 0; i < size; i++) {
+        const uint8_t reference = is_keyframe ? 0 : screen_delta->reference[i];
+        screen_delta->delta[i] = screen_delta->frame[i] ^ reference;
+    }
+    memcpy(screen_delta->reference, screen_delta->frame, size);
+    screen_frame->orientation = rpc_system_gui_screen_orientation_map[screen_delta->orientation];
+    furi_check(furi_mutex_release(screen_delta->mutex) == FuriStatusOk);
+
+    size_t encoded_size = 0;
+    screen_frame->data->bytes[0] = is_keyframe ? RpcGuiScreenFrameKey : RpcGuiScreenFrameDelta;
+    furi_check(compress_encode(
+        screen_delta->compress,
+        screen_delta->delta,
+        size,
+        &screen_frame->data->bytes[1],
+        size * 2,
+        &encoded_size));
+    screen_frame->data->size = encoded_size + 1;
+
+    return true;
+}
+
 static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context) {
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
+    RpcGuiScreenDelta* screen_delta = rpc_gui->screen_delta;
 
     uint32_t transmit_time = 0;
     while(true) {
-        uint32_t flags =
-            furi_thread_flags_wait(RpcGuiWorkerFlagAny, FuriFlagWaitAny, FuriWaitForever);
+        const bool is_pending = screen_delta && screen_delta->is_pending;
+        uint32_t flags = furi_thread_flags_wait(
+            RpcGuiWorkerFlagAny,
+            FuriFlagWaitAny,
+            is_pending ? RPC_GUI_SCREEN_DELTA_RETRY : FuriWaitForever);
+        if(flags == (unsigned)FuriFlagErrorTimeout) {
+            flags = RpcGuiWorkerFlagTransmit;
+        }
 
         if(flags & RpcGuiWorkerFlagTransmit) {
+            if(screen_delta && !rpc_system_gui_screen_delta_encode(rpc_gui)) {
+                continue;
+            }
+
             transmit_time = furi_get_tick();
             rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
             transmit_time = furi_get_tick() - transmit_time;
@@ -146,20 +271,30 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
 
         rpc_gui->is_streaming = true;
         size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
+        uint32_t keyframe_interval = rpc_session_get_screen_stream_delta(session);
+        // Frame type and compressed data, heatshrink output never exceeds twice the input
+        size_t data_size = keyframe_interval ? (1 + framebuffer_size * 2) : framebuffer_size;
         // Reusable Frame
         rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
         rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
         rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
         rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
+            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(data_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
+        if(keyframe_interval) {
+            rpc_gui->screen_delta =
+                rpc_system_gui_screen_delta_alloc(framebuffer_size, keyframe_interval);
+        }
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
             "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
         furi_thread_start(rpc_gui->transmit_thread);
         // GUI framebuffer callback
         gui_add_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
+            rpc_gui->gui,
+            keyframe_interval ? rpc_system_gui_screen_delta_frame_callback :
+                                rpc_system_gui_screen_stream_frame_callback,
+            context);
     }
 }
 
@@ -177,11 +312,18 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
         rpc_gui->is_streaming = false;
         // Remove GUI framebuffer callback
         gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
+            rpc_gui->gui,
+            rpc_gui->screen_delta ? rpc_system_gui_screen_delta_frame_callback :
+                                    rpc_system_gui_screen_stream_frame_callback,
+            context);
         // Stop and release worker thread
         furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
         furi_thread_join(rpc_gui->transmit_thread);
         furi_thread_free(rpc_gui->transmit_thread);
+        if(rpc_gui->screen_delta) {
+            rpc_system_gui_screen_delta_free(rpc_gui->screen_delta);
+            rpc_gui->screen_delta = NULL;
+        }
         // Release frame
         pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
         free(rpc_gui->transmit_frame);
@@ -452,11 +594,18 @@ void rpc_system_gui_free(void* context) {
         rpc_gui->is_streaming = false;
         // Remove GUI framebuffer callback
         gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
+            rpc_gui->gui,
+            rpc_gui->screen_delta ? rpc_system_gui_screen_delta_frame_callback :
+                                    rpc_system_gui_screen_stream_frame_callback,
+            context);
         // Stop and release worker thread
         furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
         furi_thread_join(rpc_gui->transmit_thread);
         furi_thread_free(rpc_gui->transmit_thread);
+        if(rpc_gui->screen_delta) {
+            rpc_system_gui_screen_delta_free(rpc_gui->screen_delta);
+            rpc_gui->screen_delta = NULL;
+        }
         // Release frame
         pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
         free(rpc_gui->transmit_frame);
@@ -19,6 +19,14 @@ typedef struct {
 
 void rpc_send(RpcSession* session, PB_Main* main_message);
 
+/* Same as rpc_send, encodes into buffer and grows it when message doesn't fit.
+ * Buffer is owned by caller, for a series of messages without allocation per message */
+void rpc_send_with_buffer(
+    RpcSession* session,
+    PB_Main* main_message,
+    uint8_t** buffer,
+    size_t* buffer_size);
+
 void rpc_send_and_release(RpcSession* session, PB_Main* main_message);
 
 void rpc_send_and_release_empty(RpcSession* session, uint32_t command_id, PB_CommandStatus status);
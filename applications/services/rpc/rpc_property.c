@@ -11,6 +11,9 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_THREAD_INFO "threadinfo"
+
+#define PROPERTY_THREAD_INFO_THREADS_MAX 32
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +44,55 @@ static void
     }
 }
 
+/* Counters are cumulative: client derives CPU load from two samples and their ticks */
+static void rpc_system_property_thread_info_get(PropertyValueCallback out, void* context) {
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+
+    FuriThreadId thread_ids[PROPERTY_THREAD_INFO_THREADS_MAX];
+    const uint32_t count = furi_thread_enumerate(thread_ids, PROPERTY_THREAD_INFO_THREADS_MAX);
+
+    property_value_out(&property_context, "%lu", 1, "tick", furi_get_tick());
+    property_value_out(
+        &property_context,
+        "%lu",
+        2,
+        "cycles",
+        "per_us",
+        furi_hal_cortex_instructions_per_microsecond());
+    property_context.last = (count == 0);
+    property_value_out(&property_context, "%lu", 1, "count", count);
+
+    char index[11];
+    for(uint32_t i = 0; i < count; i++) {
+        FuriThreadId thread_id = thread_ids[i];
+        const char* name = furi_thread_get_name(thread_id);
+        snprintf(index, sizeof(index), "%lu", i);
+
+        property_value_out(&property_context, NULL, 2, index, "name", name ? name : "");
+        property_value_out(
+            &property_context, NULL, 2, index, "appid", furi_thread_get_appid(thread_id));
+        property_value_out(
+            &property_context, "%llu", 2, index, "cpu", furi_thread_get_cpu_time(thread_id));
+        property_value_out(
+            &property_context, "%ld", 2, index, "heap", furi_thread_get_heap_balance(thread_id));
+        property_context.last = (i == count - 1);
+        property_value_out(
+            &property_context,
+            "%lu",
+            3,
+            index,
+            "stack",
+            "free",
+            furi_thread_get_stack_space(thread_id));
+    }
+
+    furi_string_free(key);
+    furi_string_free(value);
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +133,8 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_THREAD_INFO)) {
+        rpc_system_property_thread_info_get(rpc_system_property_get_callback, &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
@@ -1,5 +1,6 @@
 #include <core/common_defines.h>
 #include <core/memmgr.h>
+#include <core/memmgr_heap.h>
 #include <core/record.h>
 #include <rpc/rpc.h>
 #include <rpc/rpc_i.h>
@@ -18,6 +19,8 @@
 #define MAX_NAME_LENGTH 254
 
 static const size_t MAX_DATA_SIZE = 512;
+// Read responses over USB carry more data, BLE and UART peers keep 512 byte messages
+static const size_t USB_READ_DATA_SIZE = 4096;
 
 typedef enum {
     RpcStorageStateIdle = 0,
@@ -354,6 +357,19 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+static size_t rpc_system_storage_get_read_chunk_size(RpcSession* session) {
+    size_t chunk_size = MAX_DATA_SIZE;
+
+    if(rpc_session_get_owner(session) == RpcOwnerUsb) {
+        // Two chunks in flight and encoded message, keep the rest of heap usable
+        if(memmgr_heap_get_max_free_block() > USB_READ_DATA_SIZE * 8) {
+            chunk_size = USB_READ_DATA_SIZE;
+        }
+    }
+
+    return chunk_size;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -376,37 +392,50 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
+        size_t chunk_size = rpc_system_storage_get_read_chunk_size(session);
+
+        // Chunk N is sent while chunk N + 1 is read, buffers are reused for the whole file
+        uint8_t* encode_buffer = NULL;
+        size_t encode_buffer_size = 0;
+        pb_bytes_array_t* chunks[2];
+        StorageIoVector vectors[2];
+        for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+            chunks[i] = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(chunk_size));
+            vectors[i].buff = &chunks[i]->bytes[0];
+        }
+
+        size_t current = 0;
+        vectors[current].size = MIN(size_left, chunk_size);
+        StorageFileRequest* pending = storage_file_readv_start(file, &vectors[current], 1);
+
         do {
+            size_t read_size = vectors[current].size;
+            fs_operation_success = (storage_file_request_wait(pending) == read_size);
+            if(!fs_operation_success) break;
+            size_left -= read_size;
+
+            if(size_left) {
+                size_t next = current ^ 1;
+                vectors[next].size = MIN(size_left, chunk_size);
+                pending = storage_file_readv_start(file, &vectors[next], 1);
+            }
+
+            chunks[current]->size = read_size;
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->content.storage_read_response.has_file = true;
+            response->content.storage_read_response.file.data = chunks[current];
+            response->has_next = (size_left > 0);
+            rpc_send_with_buffer(session, response, &encode_buffer, &encode_buffer_size);
 
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
-            }
+            current ^= 1;
+        } while(size_left != 0);
 
-            if(fs_operation_success) {
-                rpc_send_and_release(session, response);
-            }
-        } while((size_left != 0) && fs_operation_success);
+        for(size_t i = 0; i < COUNT_OF(chunks); i++) {
+            free(chunks[i]);
+        }
+        free(encode_buffer);
     }
 
     if(!fs_operation_success) {
@@ -6,6 +6,7 @@
 #include "storages/storage_int.h"
 #include "storages/storage_ext.h"
 #include <assets_icons.h>
+#include <toolbox/trace.h>
 
 #define STORAGE_TICK 1000
 
@@ -105,7 +106,13 @@ int32_t storage_srv(void* p) {
     StorageMessage message;
     while(1) {
         if(furi_message_queue_get(app->message_queue, &message, STORAGE_TICK) == FuriStatusOk) {
+            if(trace_is_running()) {
+                trace_counter(
+                    TraceProbeStorageQueue, furi_message_queue_get_count(app->message_queue));
+            }
+            trace_begin(TraceProbeStorageMessage);
             storage_process_message(app, &message);
+            trace_end(TraceProbeStorageMessage);
         } else {
             storage_tick(app);
         }
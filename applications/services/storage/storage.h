@@ -137,6 +137,61 @@ size_t storage_file_read(File* file, void* buff, size_t bytes_to_read);
  */
 size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write);
 
+/** Buffer of a vectored file operation */
+typedef struct {
+    void* buff; /**< data buffer, not modified by storage_file_writev() */
+    size_t size; /**< buffer size in bytes */
+} StorageIoVector;
+
+/**
+ * @brief Read bytes from a file into several buffers with a single storage request.
+ *
+ * Buffers are filled in order, reading stops at the end of file or on error.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param vectors pointer to the array of buffers to be filled with read data.
+ * @param count number of buffers in the array.
+ * @return actual number of bytes read in total (may be fewer than requested).
+ */
+size_t storage_file_readv(File* file, const StorageIoVector* vectors, size_t count);
+
+/**
+ * @brief Write bytes from several buffers to a file with a single storage request.
+ *
+ * Buffers are written in order, writing stops on error.
+ *
+ * @param file pointer to the file instance to write into.
+ * @param vectors pointer to the array of buffers containing the data to be written.
+ * @param count number of buffers in the array.
+ * @return actual number of bytes written in total (may be fewer than requested).
+ */
+size_t storage_file_writev(File* file, const StorageIoVector* vectors, size_t count);
+
+/** Vectored read in progress, see storage_file_readv_start() */
+typedef struct StorageFileRequest StorageFileRequest;
+
+/**
+ * @brief Start reading a file into several buffers without waiting for the result.
+ *
+ * Lets the caller process previous data while the storage thread reads. The file
+ * and the buffers must stay untouched until storage_file_request_wait() returns.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param vectors pointer to the array of buffers to be filled with read data.
+ * @param count number of buffers in the array.
+ * @return pointer to the request, must be passed to storage_file_request_wait().
+ */
+StorageFileRequest*
+    storage_file_readv_start(File* file, const StorageIoVector* vectors, size_t count);
+
+/**
+ * @brief Wait for a started request to complete and free it.
+ *
+ * @param request pointer to the request instance.
+ * @return actual number of bytes transferred in total.
+ */
+size_t storage_file_request_wait(StorageFileRequest* request);
+
 /**
  * @brief Change the current access position in a file.
  *
@@ -82,6 +82,17 @@ static void storage_cli_info(Cli* cli, FuriString* path) {
                 sd_info.product_serial_number,
                 sd_info.manufacturing_month,
                 sd_info.manufacturing_year);
+
+            SectorCacheStats cache_stats;
+            furi_hal_sd_cache_get_stats(&cache_stats);
+            printf(
+                "Cache: %lu hits, %lu misses, %lu evictions\r\n"
+                "Cache: %lu prefetched, %lu written back\r\n",
+                cache_stats.hits,
+                cache_stats.misses,
+                cache_stats.evictions,
+                cache_stats.prefetched,
+                cache_stats.write_backs);
         }
     } else {
         storage_cli_print_usage();
@@ -40,8 +40,8 @@
         }};
 
 #define S_RETURN_BOOL (return_data.bool_value);
-#define S_RETURN_UINT16 (return_data.uint16_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
 
@@ -138,29 +138,17 @@ bool storage_file_close(File* file) {
     return S_RETURN_BOOL;
 }
 
-static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t bytes_to_read) {
-    if(bytes_to_read == 0) {
-        return 0;
+static size_t storage_file_transfer(
+    File* file,
+    StorageCommand command,
+    const StorageIoVector* vectors,
+    size_t count) {
+    size_t size = 0;
+    for(size_t i = 0; i < count; i++) {
+        size += vectors[i].size;
     }
 
-    S_FILE_API_PROLOGUE;
-    S_API_PROLOGUE;
-
-    SAData data = {
-        .fread = {
-            .file = file,
-            .buff = buff,
-            .bytes_to_read = bytes_to_read,
-        }};
-
-    S_API_MESSAGE(StorageCommandFileRead);
-    S_API_EPILOGUE;
-    return S_RETURN_UINT16;
-}
-
-static uint16_t
-    storage_file_write_underlying(File* file, const void* buff, uint16_t bytes_to_write) {
-    if(bytes_to_write == 0) {
+    if(size == 0) {
         return 0;
     }
 
@@ -168,49 +156,76 @@ static uint16_t
     S_API_PROLOGUE;
 
     SAData data = {
-        .fwrite = {
+        .fvector = {
             .file = file,
-            .buff = buff,
-            .bytes_to_write = bytes_to_write,
+            .vectors = vectors,
+            .count = count,
         }};
 
-    S_API_MESSAGE(StorageCommandFileWrite);
+    S_API_MESSAGE(command);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
 size_t storage_file_read(File* file, void* buff, size_t to_read) {
-    size_t total = 0;
+    const StorageIoVector vector = {.buff = buff, .size = to_read};
+    return storage_file_transfer(file, StorageCommandFileRead, &vector, 1);
+}
 
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_read - total), max_chunk);
-        size_t read = storage_file_read_underlying(file, buff + total, chunk);
-        total += read;
+size_t storage_file_write(File* file, const void* buff, size_t to_write) {
+    const StorageIoVector vector = {.buff = (void*)buff, .size = to_write};
+    return storage_file_transfer(file, StorageCommandFileWrite, &vector, 1);
+}
 
-        if(storage_file_get_error(file) != FSE_OK || read != chunk) {
-            break;
-        }
-    } while(total != to_read);
+size_t storage_file_readv(File* file, const StorageIoVector* vectors, size_t count) {
+    furi_check(vectors || count == 0);
+    return storage_file_transfer(file, StorageCommandFileRead, vectors, count);
+}
 
-    return total;
+size_t storage_file_writev(File* file, const StorageIoVector* vectors, size_t count) {
+    furi_check(vectors || count == 0);
+    return storage_file_transfer(file, StorageCommandFileWrite, vectors, count);
 }
 
-size_t storage_file_write(File* file, const void* buff, size_t to_write) {
-    size_t total = 0;
+struct StorageFileRequest {
+    StorageMessage message;
+    SAData data;
+    SAReturn return_data;
+};
 
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_write - total), max_chunk);
-        size_t written = storage_file_write_underlying(file, buff + total, chunk);
-        total += written;
+StorageFileRequest*
+    storage_file_readv_start(File* file, const StorageIoVector* vectors, size_t count) {
+    furi_check(vectors || count == 0);
+    S_FILE_API_PROLOGUE;
 
-        if(storage_file_get_error(file) != FSE_OK || written != chunk) {
-            break;
-        }
-    } while(total != to_write);
+    // Message data has to outlive this call
+    StorageFileRequest* request = malloc(sizeof(StorageFileRequest));
+    request->data.fvector.file = file;
+    request->data.fvector.vectors = vectors;
+    request->data.fvector.count = count;
+    request->data.fvector.index = 0;
+    request->data.fvector.offset = 0;
+    request->return_data.size_value = 0;
+    request->message.lock = api_lock_alloc_locked();
+    request->message.command = StorageCommandFileRead;
+    request->message.data = &request->data;
+    request->message.return_data = &request->return_data;
+
+    furi_check(
+        furi_message_queue_put(storage->message_queue, &request->message, FuriWaitForever) ==
+        FuriStatusOk);
+
+    return request;
+}
+
+size_t storage_file_request_wait(StorageFileRequest* request) {
+    furi_check(request);
+
+    api_lock_wait_unlock_and_free(request->message.lock);
+    size_t size = request->return_data.size_value;
+    free(request);
 
-    return total;
+    return size;
 }
 
 bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
@@ -16,15 +16,12 @@ typedef struct {
 
 typedef struct {
     File* file;
-    void* buff;
-    uint16_t bytes_to_read;
-} SADataFRead;
-
-typedef struct {
-    File* file;
-    const void* buff;
-    uint16_t bytes_to_write;
-} SADataFWrite;
+    const StorageIoVector* vectors;
+    size_t count;
+    // Progress of transfer done in several passes, zero on request
+    size_t index;
+    size_t offset;
+} SADataFVector;
 
 typedef struct {
     File* file;
@@ -106,8 +103,7 @@ typedef struct {
 
 typedef union {
     SADataFOpen fopen;
-    SADataFRead fread;
-    SADataFWrite fwrite;
+    SADataFVector fvector;
     SADataFSeek fseek;
     SADataFExpand fexpand;
 
@@ -131,8 +127,8 @@ typedef union {
 
 typedef union {
     bool bool_value;
-    uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
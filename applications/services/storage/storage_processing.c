@@ -150,36 +150,56 @@ bool storage_process_file_close(Storage* app, File* file) {
     return ret;
 }
 
-static uint16_t
-    storage_process_file_read(Storage* app, File* file, void* buff, uint16_t const bytes_to_read) {
-    uint16_t ret = 0;
-    StorageData* storage = get_storage_by_file(file, app->storage);
+// Bytes moved by one pass of a vectored request, the rest is queued again behind other clients
+#define STORAGE_FILE_TRANSFER_PASS_SIZE (8 * 1024)
 
-    if(storage == NULL) {
-        file->error_id = FSE_INVALID_PARAMETER;
-    } else {
-        FS_CALL(storage, file.read(storage, file, buff, bytes_to_read));
-    }
+_Static_assert(STORAGE_FILE_TRANSFER_PASS_SIZE <= UINT16_MAX, "Pass exceeds filesystem call");
 
-    return ret;
-}
+// Returns true when request is complete: all vectors done, error or short transfer
+static bool storage_process_file_transfer(Storage* app, StorageMessage* message) {
+    SADataFVector* fvector = &message->data->fvector;
+    File* file = fvector->file;
+    const bool is_write = (message->command == StorageCommandFileWrite);
+    if(fvector->index == 0 && fvector->offset == 0) {
+        message->return_data->size_value = 0;
+    }
 
-static uint16_t storage_process_file_write(
-    Storage* app,
-    File* file,
-    const void* buff,
-    uint16_t const bytes_to_write) {
-    uint16_t ret = 0;
     StorageData* storage = get_storage_by_file(file, app->storage);
-
     if(storage == NULL) {
         file->error_id = FSE_INVALID_PARAMETER;
-    } else {
+        return true;
+    }
+
+    if(is_write) {
         storage_data_timestamp(storage);
-        FS_CALL(storage, file.write(storage, file, buff, bytes_to_write));
     }
 
-    return ret;
+    size_t pass_left = STORAGE_FILE_TRANSFER_PASS_SIZE;
+    while(fvector->index < fvector->count) {
+        const StorageIoVector* vector = &fvector->vectors[fvector->index];
+        if(fvector->offset == vector->size) {
+            fvector->index++;
+            fvector->offset = 0;
+            continue;
+        }
+        if(!pass_left) return false;
+
+        uint16_t ret = 0;
+        uint8_t* buff = (uint8_t*)vector->buff + fvector->offset;
+        const uint16_t chunk = MIN(vector->size - fvector->offset, pass_left);
+        if(is_write) {
+            FS_CALL(storage, file.write(storage, file, buff, chunk));
+        } else {
+            FS_CALL(storage, file.read(storage, file, buff, chunk));
+        }
+        message->return_data->size_value += ret;
+
+        if(file->error_id != FSE_OK || ret != chunk) break;
+        fvector->offset += chunk;
+        pass_left -= chunk;
+    }
+
+    return true;
 }
 
 static bool storage_process_file_seek(
@@ -638,18 +658,11 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
             storage_process_file_close(app, message->data->fopen.file);
         break;
     case StorageCommandFileRead:
-        message->return_data->uint16_value = storage_process_file_read(
-            app,
-            message->data->fread.file,
-            message->data->fread.buff,
-            message->data->fread.bytes_to_read);
-        break;
     case StorageCommandFileWrite:
-        message->return_data->uint16_value = storage_process_file_write(
-            app,
-            message->data->fwrite.file,
-            message->data->fwrite.buff,
-            message->data->fwrite.bytes_to_write);
+        while(!storage_process_file_transfer(app, message)) {
+            // Caller stays locked, GUI and other clients are served between passes
+            if(furi_message_queue_put(app->message_queue, message, 0) == FuriStatusOk) return;
+        }
         break;
     case StorageCommandFileSeek:
         message->return_data->bool_value = storage_process_file_seek(
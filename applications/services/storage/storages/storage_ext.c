@@ -50,6 +50,11 @@ static bool sd_mount_card_internal(StorageData* storage, bool notify) {
         } else {
             SDError status = f_mount(sd_data->fs, sd_data->path, 1);
 
+            if(status == FR_OK) {
+                // Allocation table and FAT16 root directory are hit on every file operation
+                furi_hal_sd_cache_set_priority_range(sd_data->fs->fatbase, sd_data->fs->database);
+            }
+
             if(status == FR_OK || status == FR_NO_FILESYSTEM) {
 #ifndef FURI_RAM_EXEC
                 FATFS* fs;
@@ -101,6 +106,10 @@ FS_Error sd_unmount_card(StorageData* storage) {
     error = FR_DISK_ERR;
 
     // TODO FL-3522: do i need to close the files?
+    // Card may be gone already, then there is nothing to write cached sectors to
+    if(furi_hal_sd_is_present() && furi_hal_sd_sync() != FuriStatusOk) {
+        FURI_LOG_E(TAG, "cache sync failed");
+    }
     f_mount(0, sd_data->path, 0);
 
     return storage_ext_parse_error(error);
@@ -43,12 +43,23 @@ FURI_NORETURN void __furi_crash_implementation();
 FURI_NORETURN void __furi_halt_implementation();
 
 /** Crash system with message. Show message after reboot. */
+#ifndef FURI_HOST
 #define __furi_crash(message)                                 \
     do {                                                      \
         register const void* r12 asm("r12") = (void*)message; \
         asm volatile("sukima%=:" : : "r"(r12));               \
         __furi_crash_implementation();                        \
     } while(0)
+#else
+/* No r12 trick on host, message is passed through global */
+extern const char* __furi_check_message;
+
+#define __furi_crash(message)                           \
+    do {                                                \
+        __furi_check_message = (const char*)(message); \
+        __furi_crash_implementation();                  \
+    } while(0)
+#endif
 
 /** Crash system
  *
@@ -57,12 +68,20 @@ FURI_NORETURN void __furi_halt_implementation();
 #define furi_crash(...) M_APPLY(__furi_crash, M_IF_EMPTY(__VA_ARGS__)((NULL), (__VA_ARGS__)))
 
 /** Halt system with message. */
+#ifndef FURI_HOST
 #define __furi_halt(message)                                  \
     do {                                                      \
         register const void* r12 asm("r12") = (void*)message; \
         asm volatile("sukima%=:" : : "r"(r12));               \
         __furi_halt_implementation();                         \
     } while(0)
+#else
+#define __furi_halt(message)                            \
+    do {                                                \
+        __furi_check_message = (const char*)(message); \
+        __furi_halt_implementation();                   \
+    } while(0)
+#endif
 
 /** Halt system
  *
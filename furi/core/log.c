@@ -1,6 +1,8 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
+#include "kernel.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
@@ -8,10 +10,48 @@ LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+/* Deferred mode ring buffer, power of 2 */
+#define FURI_LOG_RING_SIZE 4096
+#define FURI_LOG_RING_MASK (FURI_LOG_RING_SIZE - 1)
+/* Record with arguments, longer strings are truncated. Multiple of 4 */
+#define FURI_LOG_RECORD_SIZE_MAX 192
+/* Marks the unused end of ring, next record starts from the beginning */
+#define FURI_LOG_RECORD_PADDING (1UL << 31)
+#define FURI_LOG_RECORD_FLAG_TRUNCATED (1 << 0)
+#define FURI_LOG_RECORD_ALIGN(size) (((size) + 3) & ~3UL)
+
+#define FURI_LOG_THREAD_STACK_SIZE 2048
+#define FURI_LOG_THREAD_FLAG_PENDING (1UL << 0)
+
+/* Binary mode frame: magic followed by record */
+#define FURI_LOG_BINARY_MAGIC "\xF1\x06"
+
+/* Deferred record, followed by arguments in the order of format conversions:
+ * 8 bytes for integers, pointers and floats, zero-terminated 4-byte aligned strings */
+typedef struct {
+    uint32_t size; /* Record size, written last: record is complete when it's not 0 */
+    uint32_t tick;
+    const char* tag; /* NULL for raw records */
+    const char* format;
+    uint8_t level;
+    uint8_t flags;
+    uint16_t args_size;
+} FuriLogRecord;
+
+typedef struct {
+    uint32_t read;
+    uint32_t write;
+    uint32_t dropped;
+    uint8_t* data;
+} FuriLogRing;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    FuriLogMode mode;
+    FuriLogRing ring;
+    FuriThread* thread;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,38 +147,528 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+static const char* furi_log_level_letter(FuriLogLevel level, const char** color) {
+    switch(level) {
+    case FuriLogLevelError:
+        *color = _FURI_LOG_CLR_E;
+        return "E";
+    case FuriLogLevelWarn:
+        *color = _FURI_LOG_CLR_W;
+        return "W";
+    case FuriLogLevelInfo:
+        *color = _FURI_LOG_CLR_I;
+        return "I";
+    case FuriLogLevelDebug:
+        *color = _FURI_LOG_CLR_D;
+        return "D";
+    case FuriLogLevelTrace:
+        *color = _FURI_LOG_CLR_T;
+        return "T";
+    default:
+        *color = _FURI_LOG_CLR_RESET;
+        return " ";
+    }
+}
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
+typedef enum {
+    FuriLogArgLengthDefault,
+    FuriLogArgLengthChar,
+    FuriLogArgLengthShort,
+    FuriLogArgLengthLong,
+    FuriLogArgLengthLongLong,
+    FuriLogArgLengthIntMax,
+    FuriLogArgLengthSize,
+    FuriLogArgLengthPtrDiff,
+    FuriLogArgLengthLongDouble,
+} FuriLogArgLength;
+
+/* Printf conversion specification */
+typedef struct {
+    const char* start; /* Points to '%' */
+    size_t length; /* Including '%' and conversion character */
+    FuriLogArgLength arg_length;
+    char conversion;
+    bool is_width_arg;
+    bool is_precision_arg;
+    int precision; /* Written in format, -1 if there is none */
+} FuriLogConversion;
+
+static bool furi_log_is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/* Find next conversion in format, false if there is none */
+static bool furi_log_conversion_next(const char* format, FuriLogConversion* conversion) {
+    const char* p = strchr(format, '%');
+    if(!p) return false;
+
+    conversion->start = p++;
+    while(*p && strchr("-+ #0", *p)) p++;
+    conversion->is_width_arg = (*p == '*');
+    if(conversion->is_width_arg) p++;
+    while(furi_log_is_digit(*p)) p++;
+    conversion->is_precision_arg = false;
+    conversion->precision = -1;
+    if(*p == '.') {
+        p++;
+        conversion->is_precision_arg = (*p == '*');
+        if(conversion->is_precision_arg) p++;
+        if(!conversion->is_precision_arg) conversion->precision = 0;
+        while(furi_log_is_digit(*p)) {
+            conversion->precision = conversion->precision * 10 + (*p - '0');
+            p++;
+        }
+    }
+
+    conversion->arg_length = FuriLogArgLengthDefault;
+    if(p[0] == 'h' && p[1] == 'h') {
+        conversion->arg_length = FuriLogArgLengthChar;
+        p += 2;
+    } else if(p[0] == 'l' && p[1] == 'l') {
+        conversion->arg_length = FuriLogArgLengthLongLong;
+        p += 2;
+    } else if(*p == 'h') {
+        conversion->arg_length = FuriLogArgLengthShort;
+        p++;
+    } else if(*p == 'l') {
+        conversion->arg_length = FuriLogArgLengthLong;
+        p++;
+    } else if(*p == 'j') {
+        conversion->arg_length = FuriLogArgLengthIntMax;
+        p++;
+    } else if(*p == 'z') {
+        conversion->arg_length = FuriLogArgLengthSize;
+        p++;
+    } else if(*p == 't') {
+        conversion->arg_length = FuriLogArgLengthPtrDiff;
+        p++;
+    } else if(*p == 'L') {
+        conversion->arg_length = FuriLogArgLengthLongDouble;
+        p++;
+    }
+
+    conversion->conversion = *p;
+    if(*p) p++;
+    conversion->length = p - conversion->start;
+    return true;
+}
+
+static bool furi_log_conversion_is_signed(const FuriLogConversion* conversion) {
+    return conversion->conversion == 'd' || conversion->conversion == 'i';
+}
+
+static bool furi_log_conversion_is_integer(const FuriLogConversion* conversion) {
+    return conversion->conversion && strchr("diouxXc", conversion->conversion);
+}
+
+static bool furi_log_conversion_is_float(const FuriLogConversion* conversion) {
+    return conversion->conversion && strchr("fFeEgGaA", conversion->conversion);
+}
+
+static uint64_t furi_log_arg_integer(const FuriLogConversion* conversion, va_list* args) {
+    const bool is_signed = furi_log_conversion_is_signed(conversion);
+    switch(conversion->arg_length) {
+    case FuriLogArgLengthLong:
+        return is_signed ? (uint64_t)va_arg(*args, long) : va_arg(*args, unsigned long);
+    case FuriLogArgLengthLongLong:
+        return is_signed ? (uint64_t)va_arg(*args, long long) :
+                           va_arg(*args, unsigned long long);
+    case FuriLogArgLengthIntMax:
+        return is_signed ? (uint64_t)va_arg(*args, intmax_t) : va_arg(*args, uintmax_t);
+    case FuriLogArgLengthSize:
+        return va_arg(*args, size_t);
+    case FuriLogArgLengthPtrDiff:
+        return (uint64_t)va_arg(*args, ptrdiff_t);
+    default:
+        return is_signed ? (uint64_t)va_arg(*args, int) : va_arg(*args, unsigned int);
+    }
+}
+
+static bool
+    furi_log_record_push(uint8_t* record, size_t* offset, const void* data, size_t size) {
+    if(*offset + size > FURI_LOG_RECORD_SIZE_MAX) return false;
+    memcpy(&record[*offset], data, size);
+    *offset += size;
+    return true;
+}
+
+/* Copy string with terminator, as much as fits, at most precision characters if it is not
+ * negative: string with precision may have no terminator */
+static bool furi_log_record_push_string(
+    uint8_t* record,
+    size_t* offset,
+    const char* str,
+    int precision) {
+    if(!str) str = "(null)";
+    const size_t space = FURI_LOG_RECORD_SIZE_MAX - *offset;
+    if(!space) return false;
+
+    const bool is_limited = (precision >= 0 && (size_t)precision < space);
+    size_t length = strnlen(str, is_limited ? (size_t)precision : space);
+    const bool is_fit = is_limited || (length < space);
+    if(!is_fit) length = space - 1;
+    memcpy(&record[*offset], str, length);
+    record[*offset + length] = '\0';
+    *offset = FURI_LOG_RECORD_ALIGN(*offset + length + 1);
+    return is_fit;
+}
+
+/* Fill record, returns its size */
+static size_t furi_log_record_capture(
+    uint8_t* record,
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    FuriLogRecord* header = (FuriLogRecord*)record;
+    header->tick = furi_get_tick();
+    header->tag = tag;
+    header->format = format;
+    header->level = level;
+    header->flags = 0;
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    size_t offset = sizeof(FuriLogRecord);
+    bool is_complete = true;
+    FuriLogConversion conversion;
+    for(const char* p = format; is_complete && furi_log_conversion_next(p, &conversion);
+        p = conversion.start + conversion.length) {
+        if(conversion.is_width_arg) {
+            const int64_t value = va_arg(args_copy, int);
+            is_complete = furi_log_record_push(record, &offset, &value, sizeof(value));
+        }
+        int precision = conversion.precision;
+        if(is_complete && conversion.is_precision_arg) {
+            const int64_t value = va_arg(args_copy, int);
+            is_complete = furi_log_record_push(record, &offset, &value, sizeof(value));
+            // Negative precision is taken as if it was omitted
+            precision = (value < 0) ? -1 : (int)value;
+        }
+        if(!is_complete) break;
+
+        if(furi_log_conversion_is_integer(&conversion)) {
+            const uint64_t value = furi_log_arg_integer(&conversion, &args_copy);
+            is_complete = furi_log_record_push(record, &offset, &value, sizeof(value));
+        } else if(furi_log_conversion_is_float(&conversion)) {
+            const double value = (conversion.arg_length == FuriLogArgLengthLongDouble) ?
+                                     (double)va_arg(args_copy, long double) :
+                                     va_arg(args_copy, double);
+            is_complete = furi_log_record_push(record, &offset, &value, sizeof(value));
+        } else if(conversion.conversion == 'p') {
+            const uint64_t value = (uintptr_t)va_arg(args_copy, void*);
+            is_complete = furi_log_record_push(record, &offset, &value, sizeof(value));
+        } else if(conversion.conversion == 's') {
+            is_complete = furi_log_record_push_string(
+                record, &offset, va_arg(args_copy, const char*), precision);
+        } else if(conversion.conversion == 'n') {
+            // Not supported, nothing is written
+            va_arg(args_copy, void*);
+        } else if(conversion.conversion != '%') {
+            // Unknown conversion, following arguments can't be located
+            is_complete = false;
+        }
+    }
+    va_end(args_copy);
+
+    if(!is_complete) header->flags |= FURI_LOG_RECORD_FLAG_TRUNCATED;
+    offset = FURI_LOG_RECORD_ALIGN(offset);
+    header->args_size = offset - sizeof(FuriLogRecord);
+    header->size = offset;
+    return offset;
+}
+
+static size_t furi_log_record_make(
+    uint8_t* record,
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    ...) {
+    va_list args;
+    va_start(args, format);
+    size_t size = furi_log_record_capture(record, level, tag, format, args);
+    va_end(args);
+    return size;
+}
+
+static void furi_log_record_format_conversion(
+    FuriString* string,
+    const FuriLogConversion* conversion,
+    const uint8_t* arg,
+    int width,
+    int precision) {
+    // Conversion with star arguments replaced by values
+    char format[32];
+    size_t length = 0;
+    bool is_precision = false;
+    for(size_t i = 0; i < conversion->length && length < sizeof(format) - 12; i++) {
+        const char c = conversion->start[i];
+        if(c == '*') {
+            length += snprintf(
+                &format[length], sizeof(format) - length, "%d", is_precision ? precision : width);
+        } else {
+            is_precision |= (c == '.');
+            format[length++] = c;
+        }
+    }
+    format[length] = '\0';
+
+    const bool is_signed = furi_log_conversion_is_signed(conversion);
+    if(furi_log_conversion_is_integer(conversion)) {
+        uint64_t value;
+        memcpy(&value, arg, sizeof(value));
+        switch(conversion->arg_length) {
+        case FuriLogArgLengthLong:
+            if(is_signed) {
+                furi_string_cat_printf(string, format, (long)value);
+            } else {
+                furi_string_cat_printf(string, format, (unsigned long)value);
+            }
             break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
+        case FuriLogArgLengthLongLong:
+        case FuriLogArgLengthIntMax:
+            if(is_signed) {
+                furi_string_cat_printf(string, format, (long long)value);
+            } else {
+                furi_string_cat_printf(string, format, (unsigned long long)value);
+            }
             break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
+        case FuriLogArgLengthSize:
+        case FuriLogArgLengthPtrDiff:
+            furi_string_cat_printf(string, format, (size_t)value);
             break;
         default:
+            if(is_signed) {
+                furi_string_cat_printf(string, format, (int)value);
+            } else {
+                furi_string_cat_printf(string, format, (unsigned int)value);
+            }
             break;
         }
+    } else if(furi_log_conversion_is_float(conversion)) {
+        double value;
+        memcpy(&value, arg, sizeof(value));
+        if(conversion->arg_length == FuriLogArgLengthLongDouble) {
+            furi_string_cat_printf(string, format, (long double)value);
+        } else {
+            furi_string_cat_printf(string, format, value);
+        }
+    } else if(conversion->conversion == 'p') {
+        uint64_t value;
+        memcpy(&value, arg, sizeof(value));
+        furi_string_cat_printf(string, format, (void*)(uintptr_t)value);
+    } else if(conversion->conversion == 's') {
+        furi_string_cat_printf(string, format, (const char*)arg);
+    }
+}
+
+/* Format record the same way as sync mode does */
+static void furi_log_record_format(FuriString* string, const FuriLogRecord* record) {
+    if(record->tag) {
+        const char* color;
+        const char* letter = furi_log_level_letter(record->level, &color);
+        furi_string_printf(
+            string,
+            "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET,
+            record->tick,
+            color,
+            letter,
+            record->tag);
+    } else {
+        furi_string_reset(string);
+    }
+
+    const uint8_t* args = (const uint8_t*)record + sizeof(FuriLogRecord);
+    const uint8_t* args_end = args + record->args_size;
+    const char* p = record->format;
+    FuriLogConversion conversion;
+    while(furi_log_conversion_next(p, &conversion)) {
+        furi_string_cat_printf(string, "%.*s", (int)(conversion.start - p), p);
+        p = conversion.start + conversion.length;
+
+        int star[2] = {0, 0};
+        const size_t star_count = conversion.is_width_arg + conversion.is_precision_arg;
+        for(size_t i = 0; i < star_count && args + sizeof(int64_t) <= args_end; i++) {
+            int64_t value;
+            memcpy(&value, args, sizeof(value));
+            star[i] = value;
+            args += sizeof(value);
+        }
+        const int width = conversion.is_width_arg ? star[0] : 0;
+        const int precision = conversion.is_width_arg ? star[1] : star[0];
+
+        if(conversion.conversion == '%') {
+            furi_string_push_back(string, '%');
+        } else if(conversion.conversion == 's') {
+            if(args >= args_end) break;
+            furi_log_record_format_conversion(string, &conversion, args, width, precision);
+            args += FURI_LOG_RECORD_ALIGN(strlen((const char*)args) + 1);
+        } else if(conversion.conversion == 'n') {
+            continue;
+        } else {
+            if(args + sizeof(uint64_t) > args_end) break;
+            furi_log_record_format_conversion(string, &conversion, args, width, precision);
+            args += sizeof(uint64_t);
+        }
+    }
+    if(record->flags & FURI_LOG_RECORD_FLAG_TRUNCATED) {
+        furi_string_cat_str(string, "...");
+    } else {
+        furi_string_cat_str(string, p);
+    }
+
+    if(record->tag) furi_string_cat_str(string, "\r\n");
+}
+
+static bool furi_log_ring_push(const uint8_t* record, uint32_t size) {
+    FuriLogRing* ring = &furi_log.ring;
+    uint32_t write;
+    uint32_t padding;
+
+    // Reserve space, producers may interrupt each other
+    do {
+        write = __atomic_load_n(&ring->write, __ATOMIC_RELAXED);
+        const uint32_t read = __atomic_load_n(&ring->read, __ATOMIC_ACQUIRE);
+        const uint32_t space_to_end = FURI_LOG_RING_SIZE - (write & FURI_LOG_RING_MASK);
+        padding = (space_to_end < size) ? space_to_end : 0;
+        if(write + padding + size - read > FURI_LOG_RING_SIZE) {
+            __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+    } while(!__atomic_compare_exchange_n(
+        &ring->write, &write, write + padding + size, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    if(padding) {
+        uint32_t* padding_header = (uint32_t*)&ring->data[write & FURI_LOG_RING_MASK];
+        __atomic_store_n(padding_header, padding | FURI_LOG_RECORD_PADDING, __ATOMIC_RELEASE);
+    }
+
+    uint8_t* data = &ring->data[(write + padding) & FURI_LOG_RING_MASK];
+    memcpy(data + sizeof(uint32_t), record + sizeof(uint32_t), size - sizeof(uint32_t));
+    __atomic_store_n((uint32_t*)data, size, __ATOMIC_RELEASE);
+    return true;
+}
+
+static void furi_log_defer(FuriLogLevel level, const char* tag, const char* format, va_list args) {
+    uint8_t record[FURI_LOG_RECORD_SIZE_MAX] ALIGN(4);
+    const size_t size = furi_log_record_capture(record, level, tag, format, args);
+    if(furi_log_ring_push(record, size)) {
+        furi_thread_flags_set(furi_thread_get_id(furi_log.thread), FURI_LOG_THREAD_FLAG_PENDING);
+    }
+}
+
+static void furi_log_record_transmit(FuriString* string, const FuriLogRecord* record) {
+    if(furi_log.mode == FuriLogModeBinary) {
+        furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+        furi_log_puts(FURI_LOG_BINARY_MAGIC);
+        furi_log_tx((const uint8_t*)record, record->size);
+        furi_mutex_release(furi_log.mutex);
+    } else {
+        furi_log_record_format(string, record);
+        furi_log_tx((const uint8_t*)furi_string_get_cstr(string), furi_string_size(string));
+    }
+}
+
+static int32_t furi_log_thread(void* context) {
+    UNUSED(context);
+    FuriLogRing* ring = &furi_log.ring;
+    FuriString* string = furi_string_alloc();
+    uint32_t dropped_reported = 0;
+
+    while(true) {
+        furi_thread_flags_wait(FURI_LOG_THREAD_FLAG_PENDING, FuriFlagWaitAny, FuriWaitForever);
+
+        // Reported before queued records, so flush waits for it
+        const uint32_t dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+        if(dropped != dropped_reported) {
+            uint8_t record[FURI_LOG_RECORD_SIZE_MAX] ALIGN(4);
+            furi_log_record_make(
+                record,
+                FuriLogLevelWarn,
+                "FuriLog",
+                "%lu records dropped",
+                dropped - dropped_reported);
+            furi_log_record_transmit(string, (const FuriLogRecord*)record);
+            dropped_reported = dropped;
+        }
+
+        while(true) {
+            const uint32_t read = ring->read;
+            uint8_t* data = &ring->data[read & FURI_LOG_RING_MASK];
+            const uint32_t header = __atomic_load_n((uint32_t*)data, __ATOMIC_ACQUIRE);
+            if(!header) break;
+
+            const uint32_t size = header & ~FURI_LOG_RECORD_PADDING;
+            if(!(header & FURI_LOG_RECORD_PADDING)) {
+                furi_log_record_transmit(string, (const FuriLogRecord*)data);
+            }
+            // Space is given back only after transmission, so flush waits for it
+            memset(data, 0, size);
+            __atomic_store_n(&ring->read, read + size, __ATOMIC_RELEASE);
+        }
+    }
+
+    furi_string_free(string);
+    return 0;
+}
+
+void furi_log_set_mode(FuriLogMode mode) {
+    furi_check(!FURI_IS_ISR());
+
+    // Ring and thread are never freed: ISR may be pushing a record while mode changes
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+    if(mode != FuriLogModeSync && !furi_log.thread) {
+        furi_log.ring.data = malloc(FURI_LOG_RING_SIZE);
+        furi_log.thread = furi_thread_alloc_ex(
+            "FuriLog", FURI_LOG_THREAD_STACK_SIZE, furi_log_thread, NULL);
+        furi_thread_set_priority(furi_log.thread, FuriThreadPriorityLow);
+        furi_thread_start(furi_log.thread);
+    }
+    furi_mutex_release(furi_log.mutex);
+
+    if(mode == FuriLogModeSync) {
+        // Records already queued go out in the current mode
+        furi_log_flush();
+    }
+    __atomic_store_n(&furi_log.mode, mode, __ATOMIC_RELEASE);
+}
+
+FuriLogMode furi_log_get_mode(void) {
+    return furi_log.mode;
+}
+
+void furi_log_flush(void) {
+    furi_check(!FURI_IS_ISR());
+    if(!furi_log.thread || furi_thread_get_current() == furi_log.thread) return;
+
+    while(__atomic_load_n(&furi_log.ring.read, __ATOMIC_ACQUIRE) !=
+          __atomic_load_n(&furi_log.ring.write, __ATOMIC_ACQUIRE)) {
+        furi_thread_flags_set(furi_thread_get_id(furi_log.thread), FURI_LOG_THREAD_FLAG_PENDING);
+        furi_delay_tick(1);
+    }
+}
+
+uint32_t furi_log_get_dropped_count(void) {
+    return __atomic_load_n(&furi_log.ring.dropped, __ATOMIC_RELAXED);
+}
+
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level <= furi_log.log_level && furi_log.mode != FuriLogModeSync) {
+        va_list args;
+        va_start(args, format);
+        furi_log_defer(level, tag, format, args);
+        va_end(args);
+        return;
+    }
+
+    if(level <= furi_log.log_level &&
+       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+        FuriString* string;
+        string = furi_string_alloc();
+
+        const char* color;
+        const char* log_letter = furi_log_level_letter(level, &color);
 
         // Timestamp
         furi_string_printf(
@@ -161,6 +691,14 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
+    if(level <= furi_log.log_level && furi_log.mode != FuriLogModeSync) {
+        va_list args;
+        va_start(args, format);
+        furi_log_defer(level, NULL, format, args);
+        va_end(args);
+        return;
+    }
+
     if(level <= furi_log.log_level &&
        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
@@ -39,6 +39,12 @@ typedef enum {
 #define _FURI_LOG_CLR_D _FURI_LOG_CLR(_FURI_LOG_CLR_BLUE)
 #define _FURI_LOG_CLR_T _FURI_LOG_CLR(_FURI_LOG_CLR_PURPLE)
 
+typedef enum {
+    FuriLogModeSync, /**< Format and transmit on caller's thread, default */
+    FuriLogModeDeferred, /**< Queue records, format and transmit on log thread */
+    FuriLogModeBinary, /**< Queue records, transmit them unformatted, see scripts/log_decode.py */
+} FuriLogMode;
+
 typedef void (*FuriLogHandlerCallback)(const uint8_t* data, size_t size, void* context);
 
 typedef struct {
@@ -126,6 +132,42 @@ bool furi_log_level_to_string(FuriLogLevel level, const char** str);
  */
 bool furi_log_level_from_string(const char* str, FuriLogLevel* level);
 
+/** Set log mode
+ *
+ * In deferred modes log calls only put a record into a ring buffer: tick,
+ * level, tag and format pointers and copied arguments, strings included.
+ * It's safe to log from ISR. Records are formatted and transmitted by a low
+ * priority thread, they are dropped when the ring is full. Tag and format
+ * must stay valid till the record is transmitted, see furi_log_flush().
+ * Binary mode transmits raw records, strings are resolved on host with
+ * firmware ELF file.
+ *
+ * First switch to a deferred mode allocates a 4 KiB ring and a log thread with
+ * 2 KiB stack. They stay allocated after returning to sync mode.
+ *
+ * @param[in]  mode  The mode
+ */
+void furi_log_set_mode(FuriLogMode mode);
+
+/** Get log mode
+ *
+ * @return     The furi log mode.
+ */
+FuriLogMode furi_log_get_mode(void);
+
+/** Wait until all deferred records are transmitted
+ *
+ * Must be called before unloading code that owns tag or format strings.
+ * Does nothing in sync mode, must not be called from ISR.
+ */
+void furi_log_flush(void);
+
+/** Get count of deferred records dropped because ring buffer was full
+ *
+ * @return     Dropped records count since boot
+ */
+uint32_t furi_log_get_dropped_count(void);
+
 /** Log methods
  *
  * @param      tag     The application tag
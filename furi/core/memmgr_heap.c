@@ -35,7 +35,9 @@
  */
 
 #include "memmgr_heap.h"
+#include "memmgr_slab.h"
 #include "check.h"
+#include "thread_i.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <stm32wbxx.h>
@@ -132,6 +134,26 @@ DICT_DEF2( //-V1048
 static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
 static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
 
+/* Pages reserved at heap start for small allocations, so they don't split heap blocks.
+ * They are never given back to heap: free heap and max free block shrink by their size.
+ * Default is one page per size class, 2KiB; classes that run out fall back to heap. */
+#ifndef MEMMGR_HEAP_SLAB_PAGES
+#define MEMMGR_HEAP_SLAB_PAGES (MEMMGR_SLAB_CLASS_COUNT)
+#endif
+
+_Static_assert(MEMMGR_HEAP_SLAB_PAGES <= MEMMGR_SLAB_PAGES_MAX, "Too many slab pages");
+
+static MemmgrSlab memmgr_heap_slab = {0};
+
+/* Allocated size including overhead: slab slot or heap block with its header */
+static size_t memmgr_heap_get_block_size(void* pointer) {
+    if(memmgr_slab_contains(&memmgr_heap_slab, pointer)) {
+        return memmgr_slab_get_size(&memmgr_heap_slab, pointer);
+    }
+    const BlockLink_t* link = (void*)((uint8_t*)pointer - xHeapStructSize);
+    return link->xBlockSize & ~xBlockAllocatedBit;
+}
+
 /* Initialize tracing storage on start */
 void memmgr_heap_init() {
     MemmgrHeapThreadDict_init(memmgr_heap_thread_dict);
@@ -175,7 +197,12 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
                 !MemmgrHeapAllocDict_end_p(alloc_dict_it);
                 MemmgrHeapAllocDict_next(alloc_dict_it)) {
                 MemmgrHeapAllocDict_itref_t* data = MemmgrHeapAllocDict_ref(alloc_dict_it);
-                if(data->key != 0) {
+                if(data->key != 0 &&
+                   memmgr_slab_contains(&memmgr_heap_slab, (void*)data->key)) {
+                    if(memmgr_slab_get_size(&memmgr_heap_slab, (void*)data->key)) {
+                        leftovers += data->value;
+                    }
+                } else if(data->key != 0) {
                     uint8_t* puc = (uint8_t*)data->key;
                     puc -= xHeapStructSize;
                     BlockLink_t* pxLink = (void*)puc;
@@ -193,9 +220,21 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
     return leftovers;
 }
 
+/* Scheduler is suspended in hooks, thread local storage of current thread is safe to update */
+static inline void memmgr_heap_thread_balance_add(FuriThreadId thread_id, int32_t size) {
+    intptr_t balance =
+        (intptr_t)pvTaskGetThreadLocalStoragePointer(thread_id, FURI_THREAD_TLS_HEAP_BALANCE);
+    vTaskSetThreadLocalStoragePointer(
+        thread_id, FURI_THREAD_TLS_HEAP_BALANCE, (void*)(balance + size));
+}
+
 #undef traceMALLOC
 static inline void traceMALLOC(void* pointer, size_t size) {
     FuriThreadId thread_id = furi_thread_get_current_id();
+    if(pointer && thread_id) {
+        // Block may be bigger than requested: slab slot or unsplit heap remainder
+        memmgr_heap_thread_balance_add(thread_id, memmgr_heap_get_block_size(pointer));
+    }
     if(thread_id && memmgr_heap_thread_trace_depth == 0) {
         memmgr_heap_thread_trace_depth++;
         MemmgrHeapAllocDict_t* alloc_dict =
@@ -209,8 +248,10 @@ static inline void traceMALLOC(void* pointer, size_t size) {
 
 #undef traceFREE
 static inline void traceFREE(void* pointer, size_t size) {
-    UNUSED(size);
     FuriThreadId thread_id = furi_thread_get_current_id();
+    if(thread_id) {
+        memmgr_heap_thread_balance_add(thread_id, -(int32_t)size);
+    }
     if(thread_id && memmgr_heap_thread_trace_depth == 0) {
         memmgr_heap_thread_trace_depth++;
         MemmgrHeapAllocDict_t* alloc_dict =
@@ -241,18 +282,65 @@ size_t memmgr_heap_get_max_free_block() {
     return max_free_size;
 }
 
+size_t memmgr_heap_get_slab_free() {
+    size_t slab_free;
+    vTaskSuspendAll();
+    slab_free = memmgr_slab_get_free(&memmgr_heap_slab);
+    (void)xTaskResumeAll();
+    return slab_free;
+}
+
 void memmgr_heap_printf_free_blocks() {
     BlockLink_t* pxBlock;
+    size_t block_count = 0;
+    size_t free_size = 0;
+    size_t max_free_size = 0;
     //TODO enable when we can do printf with a locked scheduler
     //vTaskSuspendAll();
 
     pxBlock = xStart.pxNextFreeBlock;
     while(pxBlock->pxNextFreeBlock != NULL) {
         printf("A %p S %lu\r\n", (void*)pxBlock, (uint32_t)pxBlock->xBlockSize);
+        block_count++;
+        free_size += pxBlock->xBlockSize;
+        if(pxBlock->xBlockSize > max_free_size) {
+            max_free_size = pxBlock->xBlockSize;
+        }
         pxBlock = pxBlock->pxNextFreeBlock;
     }
 
     //xTaskResumeAll();
+
+    // Share of free heap that is not in the biggest block
+    printf(
+        "Free blocks: %zu, free: %zu, max block: %zu, fragmentation: %zu%%\r\n",
+        block_count,
+        free_size,
+        max_free_size,
+        free_size ? 100 - max_free_size * 100 / free_size : 0);
+
+    // Consistent snapshot, printed after scheduler is resumed
+    MemmgrSlabStats stats[MEMMGR_SLAB_CLASS_COUNT];
+    size_t free_pages;
+    vTaskSuspendAll();
+    {
+        for(size_t i = 0; i < MEMMGR_SLAB_CLASS_COUNT; i++) {
+            memmgr_slab_get_stats(&memmgr_heap_slab, i, &stats[i]);
+        }
+        free_pages = memmgr_slab_get_free_pages(&memmgr_heap_slab);
+    }
+    (void)xTaskResumeAll();
+
+    for(size_t i = 0; i < MEMMGR_SLAB_CLASS_COUNT; i++) {
+        printf(
+            "Slab %zu: pages %zu, slots %zu/%zu, heap fallbacks %zu\r\n",
+            stats[i].slot_size,
+            stats[i].pages,
+            stats[i].slots_used,
+            stats[i].slots_total,
+            stats[i].fallbacks);
+    }
+    printf("Slab free pages: %zu/%d\r\n", free_pages, MEMMGR_HEAP_SLAB_PAGES);
 }
 
 #ifdef HEAP_PRINT_DEBUG
@@ -321,20 +409,23 @@ static void print_heap_malloc(void* ptr, size_t size) {
     FURI_CRITICAL_EXIT();
 }
 
-static void print_heap_free(void* ptr) {
+static void print_heap_free(void* ptr, size_t size) {
     char tmp_str[33];
     const char* name = furi_thread_get_name(furi_thread_get_current_id());
     if(!name) {
         name = "";
     }
 
-    // {thread name|f|address}
+    // {thread name|f|address|size}
     FURI_CRITICAL_ENTER();
     furi_log_puts("{");
     furi_log_puts(name);
     furi_log_puts("|f|0x");
     ultoa((unsigned long)ptr, tmp_str, 16);
     furi_log_puts(tmp_str);
+    furi_log_puts("|");
+    utoa(size, tmp_str, 10);
+    furi_log_puts(tmp_str);
     furi_log_puts("}\r\n");
     FURI_CRITICAL_EXIT();
 }
@@ -351,7 +442,9 @@ void* pvPortMalloc(size_t xWantedSize) {
     }
 
 #ifdef HEAP_PRINT_DEBUG
-    BlockLink_t* print_heap_block = NULL;
+    /* Heap blocks are logged by header, slab slots have none and are logged as is */
+    void* print_heap_block = NULL;
+    size_t print_heap_size = 0;
 #endif
 
     /* If this is the first call to malloc then the heap will require
@@ -373,11 +466,20 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
+        /* Small requests are served by size class slabs, heap is the fallback. */
+        pvReturn = memmgr_slab_alloc(&memmgr_heap_slab, xWantedSize);
+#ifdef HEAP_PRINT_DEBUG
+        if(pvReturn != NULL) {
+            print_heap_block = pvReturn;
+            print_heap_size = memmgr_slab_get_size(&memmgr_heap_slab, pvReturn);
+        }
+#endif
+
         /* Check the requested block size is not so large that the top bit is
         set.  The top bit of the block size member of the BlockLink_t structure
         is used to determine who owns the block - the application or the
         kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
+        if(pvReturn == NULL && (xWantedSize & xBlockAllocatedBit) == 0) {
             /* The wanted size is increased so it can contain a BlockLink_t
             structure in addition to the requested amount of bytes. */
             if(xWantedSize > 0) {
@@ -454,6 +556,7 @@ void* pvPortMalloc(size_t xWantedSize) {
 
 #ifdef HEAP_PRINT_DEBUG
                     print_heap_block = pxBlock;
+                    print_heap_size = pxBlock->xBlockSize & ~xBlockAllocatedBit;
 #endif
                 } else {
                     mtCOVERAGE_TEST_MARKER();
@@ -470,7 +573,9 @@ void* pvPortMalloc(size_t xWantedSize) {
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
-    print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
+    if(print_heap_block != NULL) {
+        print_heap_malloc(print_heap_block, print_heap_size);
+    }
 #endif
 
 #if(configUSE_MALLOC_FAILED_HOOK == 1)
@@ -500,7 +605,21 @@ void vPortFree(void* pv) {
         furi_crash("memmgt in ISR");
     }
 
-    if(pv != NULL) {
+    if(pv != NULL && memmgr_slab_contains(&memmgr_heap_slab, pv)) {
+#ifdef HEAP_PRINT_DEBUG
+        /* Slot is still ours, its page can't change class */
+        print_heap_free(pv, memmgr_slab_get_size(&memmgr_heap_slab, pv));
+#endif
+
+        vTaskSuspendAll();
+        {
+            const size_t size = memmgr_slab_get_size(&memmgr_heap_slab, pv);
+            traceFREE(pv, size);
+            memmgr_slab_free(&memmgr_heap_slab, pv);
+            memset(pv, 0, size);
+        }
+        (void)xTaskResumeAll();
+    } else if(pv != NULL) {
         /* The memory being freed will have an BlockLink_t structure immediately
         before it. */
         puc -= xHeapStructSize;
@@ -519,7 +638,7 @@ void vPortFree(void* pv) {
                 pxLink->xBlockSize &= ~xBlockAllocatedBit;
 
 #ifdef HEAP_PRINT_DEBUG
-                print_heap_free(pxLink);
+                print_heap_free(pxLink, pxLink->xBlockSize);
 #endif
 
                 vTaskSuspendAll();
@@ -544,7 +663,7 @@ void vPortFree(void* pv) {
         }
     } else {
 #ifdef HEAP_PRINT_DEBUG
-        print_heap_free(pv);
+        print_heap_free(pv, 0);
 #endif
     }
 }
@@ -587,6 +706,12 @@ static void prvHeapInit(void) {
 
     pucAlignedHeap = (uint8_t*)uxAddress;
 
+    /* Slab pages go first, heap takes the rest. */
+    memmgr_slab_init(
+        &memmgr_heap_slab, pucAlignedHeap, MEMMGR_HEAP_SLAB_PAGES * MEMMGR_SLAB_PAGE_SIZE);
+    pucAlignedHeap += MEMMGR_HEAP_SLAB_PAGES * MEMMGR_SLAB_PAGE_SIZE;
+    xTotalHeapSize -= MEMMGR_HEAP_SLAB_PAGES * MEMMGR_SLAB_PAGE_SIZE;
+
     /* xStart is used to hold a pointer to the first item in the list of free
     blocks.  The void cast is used to prevent compiler warnings. */
     xStart.pxNextFreeBlock = (void*)pucAlignedHeap;
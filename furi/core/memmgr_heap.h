@@ -40,6 +40,15 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId taks_handle);
  */
 size_t memmgr_heap_get_max_free_block();
 
+/** Memmgr heap get free bytes in small allocation slabs
+ *
+ * Slab region is reserved at init and never given back to heap, free heap size
+ * doesn't include it.
+ *
+ * @return     size_t free slots and pages bytes
+ */
+size_t memmgr_heap_get_slab_free();
+
 /** Print the address and size of all free blocks to stdout
  */
 void memmgr_heap_printf_free_blocks();
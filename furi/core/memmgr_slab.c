@@ -0,0 +1,149 @@
+#include "memmgr_slab.h"
+#include "check.h"
+
+#define MEMMGR_SLAB_SLOT_SIZE_MIN (16)
+#define MEMMGR_SLAB_PAGE_FREE MEMMGR_SLAB_CLASS_COUNT
+
+static inline size_t memmgr_slab_slot_size(size_t size_class) {
+    return MEMMGR_SLAB_SLOT_SIZE_MIN << size_class;
+}
+
+static inline uint32_t memmgr_slab_full_mask(size_t size_class) {
+    const size_t slots = MEMMGR_SLAB_PAGE_SIZE / memmgr_slab_slot_size(size_class);
+    return slots >= 32 ? UINT32_MAX : (1UL << slots) - 1;
+}
+
+static inline size_t memmgr_slab_size_class(size_t size) {
+    size_t size_class = 0;
+    while(memmgr_slab_slot_size(size_class) < size) size_class++;
+    return size_class;
+}
+
+/* Page of class with a free slot: last used one, any partially used one, then a free one */
+static size_t memmgr_slab_find_page(MemmgrSlab* slab, size_t size_class) {
+    const uint32_t full_mask = memmgr_slab_full_mask(size_class);
+
+    const MemmgrSlabPage* current = &slab->pages[slab->current[size_class]];
+    if(current->size_class == size_class && current->used != full_mask) {
+        return slab->current[size_class];
+    }
+
+    size_t free_page = slab->page_count;
+    for(size_t i = 0; i < slab->page_count; i++) {
+        const MemmgrSlabPage* page = &slab->pages[i];
+        if(page->size_class == size_class && page->used != full_mask) return i;
+        if(page->size_class == MEMMGR_SLAB_PAGE_FREE && free_page == slab->page_count) {
+            free_page = i;
+        }
+    }
+
+    return free_page;
+}
+
+void memmgr_slab_init(MemmgrSlab* slab, void* region, size_t size) {
+    furi_check(slab);
+    furi_check(((size_t)region & 7) == 0);
+
+    slab->region = region;
+    slab->page_count = size / MEMMGR_SLAB_PAGE_SIZE;
+    furi_check(slab->page_count <= MEMMGR_SLAB_PAGES_MAX);
+    slab->free = slab->page_count * MEMMGR_SLAB_PAGE_SIZE;
+
+    for(size_t i = 0; i < MEMMGR_SLAB_PAGES_MAX; i++) {
+        slab->pages[i].used = 0;
+        slab->pages[i].size_class = MEMMGR_SLAB_PAGE_FREE;
+    }
+    for(size_t i = 0; i < MEMMGR_SLAB_CLASS_COUNT; i++) {
+        slab->current[i] = 0;
+        slab->fallbacks[i] = 0;
+    }
+}
+
+void* memmgr_slab_alloc(MemmgrSlab* slab, size_t size) {
+    if(size == 0 || size > MEMMGR_SLAB_SIZE_MAX) return NULL;
+
+    const size_t size_class = memmgr_slab_size_class(size);
+    const size_t index = memmgr_slab_find_page(slab, size_class);
+    if(index == slab->page_count) {
+        slab->fallbacks[size_class]++;
+        return NULL;
+    }
+
+    MemmgrSlabPage* page = &slab->pages[index];
+    page->size_class = size_class;
+    slab->current[size_class] = index;
+
+    const size_t slot = __builtin_ctz(~page->used);
+    page->used |= 1UL << slot;
+
+    const size_t slot_size = memmgr_slab_slot_size(size_class);
+    slab->free -= slot_size;
+    return slab->region + index * MEMMGR_SLAB_PAGE_SIZE + slot * slot_size;
+}
+
+void memmgr_slab_free(MemmgrSlab* slab, void* pointer) {
+    furi_check(memmgr_slab_contains(slab, pointer));
+
+    const size_t offset = (uint8_t*)pointer - slab->region;
+    MemmgrSlabPage* page = &slab->pages[offset / MEMMGR_SLAB_PAGE_SIZE];
+    furi_check(page->size_class != MEMMGR_SLAB_PAGE_FREE);
+
+    const size_t slot_size = memmgr_slab_slot_size(page->size_class);
+    const size_t page_offset = offset % MEMMGR_SLAB_PAGE_SIZE;
+    furi_check(page_offset % slot_size == 0);
+
+    const uint32_t slot_mask = 1UL << (page_offset / slot_size);
+    furi_check(page->used & slot_mask);
+    page->used &= ~slot_mask;
+    slab->free += slot_size;
+
+    // Empty page may serve any class
+    if(page->used == 0) page->size_class = MEMMGR_SLAB_PAGE_FREE;
+}
+
+bool memmgr_slab_contains(const MemmgrSlab* slab, const void* pointer) {
+    const uint8_t* p = pointer;
+    return p >= slab->region && p < slab->region + slab->page_count * MEMMGR_SLAB_PAGE_SIZE;
+}
+
+size_t memmgr_slab_get_size(const MemmgrSlab* slab, const void* pointer) {
+    const size_t offset = (const uint8_t*)pointer - slab->region;
+    const MemmgrSlabPage* page = &slab->pages[offset / MEMMGR_SLAB_PAGE_SIZE];
+    if(page->size_class == MEMMGR_SLAB_PAGE_FREE) return 0;
+
+    const size_t slot_size = memmgr_slab_slot_size(page->size_class);
+    const uint32_t slot_mask = 1UL << (offset % MEMMGR_SLAB_PAGE_SIZE / slot_size);
+    return (page->used & slot_mask) ? slot_size : 0;
+}
+
+size_t memmgr_slab_get_free(const MemmgrSlab* slab) {
+    return slab->free;
+}
+
+size_t memmgr_slab_get_free_pages(const MemmgrSlab* slab) {
+    size_t free_pages = 0;
+    for(size_t i = 0; i < slab->page_count; i++) {
+        if(slab->pages[i].size_class == MEMMGR_SLAB_PAGE_FREE) free_pages++;
+    }
+    return free_pages;
+}
+
+void memmgr_slab_get_stats(const MemmgrSlab* slab, size_t size_class, MemmgrSlabStats* stats) {
+    furi_check(size_class < MEMMGR_SLAB_CLASS_COUNT);
+    furi_check(stats);
+
+    stats->slot_size = memmgr_slab_slot_size(size_class);
+    stats->pages = 0;
+    stats->slots_used = 0;
+    stats->slots_total = 0;
+    stats->fallbacks = slab->fallbacks[size_class];
+
+    const size_t slots_per_page = MEMMGR_SLAB_PAGE_SIZE / stats->slot_size;
+    for(size_t i = 0; i < slab->page_count; i++) {
+        const MemmgrSlabPage* page = &slab->pages[i];
+        if(page->size_class != size_class) continue;
+        stats->pages++;
+        stats->slots_used += __builtin_popcount(page->used);
+        stats->slots_total += slots_per_page;
+    }
+}
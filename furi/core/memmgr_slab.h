@@ -0,0 +1,124 @@
+/**
+ * @file memmgr_slab.h
+ * Furi: segregated size class slabs for small allocations
+ *
+ * Region is split into equal pages, every page serves one size class while it
+ * has allocated slots and goes back to the free pages when it is empty. Slot
+ * occupancy is a bitmask per page: allocation, free and pointer lookup take
+ * constant time and slots have no headers.
+ *
+ * Not thread safe, memmgr_heap calls it with scheduler suspended.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Page size, every class has at most 32 slots in a page */
+#define MEMMGR_SLAB_PAGE_SIZE (512)
+
+/** Pages a slab can manage */
+#define MEMMGR_SLAB_PAGES_MAX (32)
+
+/** Size classes: 16, 32, 64 and 128 bytes */
+#define MEMMGR_SLAB_CLASS_COUNT (4)
+
+/** Biggest request served by slab, bigger ones go to heap */
+#define MEMMGR_SLAB_SIZE_MAX (128)
+
+typedef struct {
+    uint32_t used; /**< Allocated slots bitmask */
+    uint8_t size_class; /**< Class the page serves, MEMMGR_SLAB_CLASS_COUNT if page is free */
+} MemmgrSlabPage;
+
+typedef struct {
+    uint8_t* region;
+    size_t page_count;
+    size_t free; /**< Bytes in free slots and free pages */
+    MemmgrSlabPage pages[MEMMGR_SLAB_PAGES_MAX];
+    uint8_t current[MEMMGR_SLAB_CLASS_COUNT]; /**< Last page used by class */
+    size_t fallbacks[MEMMGR_SLAB_CLASS_COUNT];
+} MemmgrSlab;
+
+typedef struct {
+    size_t slot_size; /**< Size of class slots, bytes */
+    size_t pages; /**< Pages serving class */
+    size_t slots_used; /**< Allocated slots */
+    size_t slots_total; /**< Slots in pages serving class */
+    size_t fallbacks; /**< Requests left to heap because there were no free pages */
+} MemmgrSlabStats;
+
+/** Initialize slab over memory region
+ *
+ * @param      slab    MemmgrSlab instance
+ * @param      region  region start, aligned to 8 bytes
+ * @param      size    region size, only whole pages are used
+ */
+void memmgr_slab_init(MemmgrSlab* slab, void* region, size_t size);
+
+/** Allocate slot of the smallest class that fits
+ *
+ * @param      slab  MemmgrSlab instance
+ * @param      size  requested size
+ *
+ * @return     slot, NULL if size is 0, too big or there is no space left
+ */
+void* memmgr_slab_alloc(MemmgrSlab* slab, size_t size);
+
+/** Free slot, crashes if slot is not allocated
+ *
+ * @param      slab     MemmgrSlab instance
+ * @param      pointer  slot returned by memmgr_slab_alloc
+ */
+void memmgr_slab_free(MemmgrSlab* slab, void* pointer);
+
+/** Check if pointer is inside slab region
+ *
+ * @param      slab     MemmgrSlab instance
+ * @param      pointer  any pointer
+ *
+ * @return     true if pointer belongs to slab
+ */
+bool memmgr_slab_contains(const MemmgrSlab* slab, const void* pointer);
+
+/** Get size of allocated slot
+ *
+ * @param      slab     MemmgrSlab instance
+ * @param      pointer  pointer inside slab region
+ *
+ * @return     slot size, 0 if slot is not allocated
+ */
+size_t memmgr_slab_get_size(const MemmgrSlab* slab, const void* pointer);
+
+/** Get free bytes: free slots of all classes and free pages
+ *
+ * @param      slab  MemmgrSlab instance
+ *
+ * @return     free bytes
+ */
+size_t memmgr_slab_get_free(const MemmgrSlab* slab);
+
+/** Get free pages count
+ *
+ * @param      slab  MemmgrSlab instance
+ *
+ * @return     pages not serving any class
+ */
+size_t memmgr_slab_get_free_pages(const MemmgrSlab* slab);
+
+/** Get size class occupancy
+ *
+ * @param      slab        MemmgrSlab instance
+ * @param      size_class  class index, less than MEMMGR_SLAB_CLASS_COUNT
+ * @param      stats       stats to fill
+ */
+void memmgr_slab_get_stats(const MemmgrSlab* slab, size_t size_class, MemmgrSlabStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
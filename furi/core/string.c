@@ -1,8 +1,41 @@
 #include "string.h"
+#include "check.h"
+#include "common_defines.h"
 #include <m-string.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Whole string takes 32 bytes on device: one small slab slot, no second allocation */
+#define FURI_STRING_INLINE_SIZE (32 - 2 * sizeof(size_t) - sizeof(void*))
+
+/* Formatted appends shorter than this are done without temporary string */
+#define FURI_STRING_CAT_PRINTF_BUFFER_SIZE (64)
+
+/* Arena blocks keep pointer alignment */
+#define FURI_STRING_ARENA_ALIGN(size) (((size) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
 
 struct FuriString {
-    string_t string;
+    size_t size;
+    size_t alloc; /* Buffer size, data is inline while it is FURI_STRING_INLINE_SIZE */
+    FuriStringArena* arena; /* Arena the string and its buffer belong to, NULL for heap */
+    union {
+        char* ptr;
+        char buffer[FURI_STRING_INLINE_SIZE];
+    } data;
+};
+
+typedef struct FuriStringArenaChunk {
+    struct FuriStringArenaChunk* next;
+    size_t size;
+    size_t used;
+    uint8_t data[];
+} FuriStringArenaChunk;
+
+struct FuriStringArena {
+    FuriStringArenaChunk* chunks; /* Current chunk first */
+    size_t chunk_size;
 };
 
 #undef furi_string_alloc_set
@@ -22,23 +55,149 @@ struct FuriString {
 #undef furi_string_trim
 #undef furi_string_cat
 
+static inline bool furi_string_is_inline(const FuriString* s) {
+    return s->alloc <= FURI_STRING_INLINE_SIZE;
+}
+
+static inline char* furi_string_ptr(FuriString* s) {
+    return furi_string_is_inline(s) ? s->data.buffer : s->data.ptr;
+}
+
+static inline const char* furi_string_cptr(const FuriString* s) {
+    return furi_string_is_inline(s) ? s->data.buffer : s->data.ptr;
+}
+
+static void* furi_string_arena_get(FuriStringArena* arena, size_t size) {
+    size = FURI_STRING_ARENA_ALIGN(size);
+    FuriStringArenaChunk* chunk = arena->chunks;
+    if(!chunk || chunk->size - chunk->used < size) {
+        const size_t chunk_size = MAX(arena->chunk_size, size);
+        chunk = malloc(sizeof(FuriStringArenaChunk) + chunk_size);
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    void* block = &chunk->data[chunk->used];
+    chunk->used += size;
+    return block;
+}
+
+/* Last block of current chunk grows in place */
+static bool furi_string_arena_extend(
+    FuriStringArena* arena,
+    void* block,
+    size_t size,
+    size_t new_size) {
+    FuriStringArenaChunk* chunk = arena->chunks;
+    size = FURI_STRING_ARENA_ALIGN(size);
+    new_size = FURI_STRING_ARENA_ALIGN(new_size);
+    if(!chunk || (uint8_t*)block + size != &chunk->data[chunk->used]) return false;
+    if(chunk->size - chunk->used < new_size - size) return false;
+    chunk->used += new_size - size;
+    return true;
+}
+
+/* Ensure buffer holds alloc bytes, content and terminator are kept */
+static void furi_string_grow(FuriString* s, size_t alloc) {
+    if(alloc <= s->alloc) return;
+    // Geometric growth: appending char by char must not copy every time
+    const size_t new_alloc = MAX(alloc, s->alloc + s->alloc / 2);
+
+    char* ptr;
+    if(s->arena) {
+        if(!furi_string_is_inline(s) &&
+           furi_string_arena_extend(s->arena, s->data.ptr, s->alloc, new_alloc)) {
+            s->alloc = new_alloc;
+            return;
+        }
+        ptr = furi_string_arena_get(s->arena, new_alloc);
+        memcpy(ptr, furi_string_ptr(s), s->size + 1);
+    } else {
+        ptr = malloc(new_alloc);
+        memcpy(ptr, furi_string_ptr(s), s->size + 1);
+        if(!furi_string_is_inline(s)) free(s->data.ptr);
+    }
+
+    s->data.ptr = ptr;
+    s->alloc = new_alloc;
+}
+
+static inline void furi_string_set_size(FuriString* s, size_t size) {
+    s->size = size;
+    furi_string_ptr(s)[size] = '\0';
+}
+
+static void furi_string_init(FuriString* s, FuriStringArena* arena) {
+    s->size = 0;
+    s->alloc = FURI_STRING_INLINE_SIZE;
+    s->arena = arena;
+    s->data.buffer[0] = '\0';
+}
+
+/* Release buffer, string becomes empty inline one */
+static void furi_string_clear(FuriString* s) {
+    if(!furi_string_is_inline(s) && !s->arena) free(s->data.ptr);
+    furi_string_init(s, s->arena);
+}
+
+static void furi_string_set_data(FuriString* s, const char* data, size_t length) {
+    // Data may be a part of the string itself, it's never longer than the string then
+    furi_string_grow(s, length + 1);
+    memmove(furi_string_ptr(s), data, length);
+    furi_string_set_size(s, length);
+}
+
+static void furi_string_append(FuriString* s, const char* data, size_t length) {
+    const char* ptr = furi_string_ptr(s);
+    if(data >= ptr && data < ptr + s->alloc) {
+        // Appending part of itself: buffer may move while growing
+        const size_t offset = data - ptr;
+        furi_string_grow(s, s->size + length + 1);
+        data = furi_string_ptr(s) + offset;
+    } else {
+        furi_string_grow(s, s->size + length + 1);
+    }
+    memcpy(furi_string_ptr(s) + s->size, data, length);
+    furi_string_set_size(s, s->size + length);
+}
+
+/* Format at offset, string is cut to offset first */
+static int
+    furi_string_vprintf_at(FuriString* s, size_t offset, const char format[], va_list args) {
+    furi_string_set_size(s, offset);
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int size = vsnprintf(furi_string_ptr(s) + offset, s->alloc - offset, format, args);
+    if(size > 0 && offset + size >= s->alloc) {
+        furi_string_set_size(s, offset);
+        furi_string_grow(s, offset + size + 1);
+        size = vsnprintf(furi_string_ptr(s) + offset, s->alloc - offset, format, args_copy);
+    }
+    va_end(args_copy);
+
+    furi_string_set_size(s, offset + MAX(size, 0));
+    return size;
+}
+
 FuriString* furi_string_alloc() {
     FuriString* string = malloc(sizeof(FuriString));
-    string_init(string->string);
+    furi_string_init(string, NULL);
     return string;
 }
 
 FuriString* furi_string_alloc_set(const FuriString* s) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, s->string);
+    FuriString* string = furi_string_alloc();
+    furi_string_set_data(string, furi_string_cptr(s), s->size);
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_set_str(const char cstr[]) {
-    FuriString* string = malloc(sizeof(FuriString)); //-V799
-    string_init_set(string->string, cstr);
+    FuriString* string = furi_string_alloc();
+    furi_string_set_data(string, cstr, strlen(cstr));
     return string;
-} //-V773
+}
 
 FuriString* furi_string_alloc_printf(const char format[], ...) {
     va_list args;
@@ -49,107 +208,176 @@ FuriString* furi_string_alloc_printf(const char format[], ...) {
 }
 
 FuriString* furi_string_alloc_vprintf(const char format[], va_list args) {
-    FuriString* string = malloc(sizeof(FuriString));
-    string_init_vprintf(string->string, format, args);
+    FuriString* string = furi_string_alloc();
+    furi_string_vprintf_at(string, 0, format, args);
     return string;
 }
 
 FuriString* furi_string_alloc_move(FuriString* s) {
-    FuriString* string = malloc(sizeof(FuriString));
-    string_init_move(string->string, s->string);
-    free(s);
+    FuriString* string = furi_string_alloc();
+    furi_string_move(string, s);
     return string;
 }
 
 void furi_string_free(FuriString* s) {
-    string_clear(s->string);
+    // Arena strings are released with the arena
+    if(s->arena) return;
+    furi_string_clear(s);
     free(s);
 }
 
+FuriStringArena* furi_string_arena_alloc(size_t chunk_size) {
+    FuriStringArena* arena = malloc(sizeof(FuriStringArena));
+    arena->chunks = NULL;
+    arena->chunk_size = chunk_size ? chunk_size : FURI_STRING_ARENA_CHUNK_SIZE_DEFAULT;
+    return arena;
+}
+
+void furi_string_arena_free(FuriStringArena* arena) {
+    furi_string_arena_reset(arena);
+    free(arena);
+}
+
+void furi_string_arena_reset(FuriStringArena* arena) {
+    while(arena->chunks) {
+        FuriStringArenaChunk* chunk = arena->chunks;
+        arena->chunks = chunk->next;
+        free(chunk);
+    }
+}
+
+FuriString* furi_string_alloc_arena(FuriStringArena* arena) {
+    furi_check(arena);
+    FuriString* string = furi_string_arena_get(arena, sizeof(FuriString));
+    furi_string_init(string, arena);
+    return string;
+}
+
 void furi_string_reserve(FuriString* s, size_t alloc) {
-    string_reserve(s->string, alloc);
+    furi_string_grow(s, alloc);
 }
 
 void furi_string_reset(FuriString* s) {
-    string_reset(s->string);
+    furi_string_set_size(s, 0);
 }
 
 void furi_string_swap(FuriString* v1, FuriString* v2) {
-    string_swap(v1->string, v2->string);
+    if(v1->arena == v2->arena) {
+        // Inline data is a part of the struct, buffers stay with the same owner
+        FuriString tmp = *v1;
+        *v1 = *v2;
+        *v2 = tmp;
+    } else {
+        FuriString* tmp = furi_string_alloc_set(v1);
+        furi_string_set(v1, v2);
+        furi_string_set(v2, tmp);
+        furi_string_free(tmp);
+    }
 }
 
 void furi_string_move(FuriString* v1, FuriString* v2) {
-    string_clear(v1->string);
-    string_init_move(v1->string, v2->string);
-    free(v2);
+    if(v1->arena == v2->arena) {
+        furi_string_clear(v1);
+        v1->size = v2->size;
+        v1->alloc = v2->alloc;
+        v1->data = v2->data;
+        // Buffer now belongs to v1
+        furi_string_init(v2, v2->arena);
+    } else {
+        furi_string_set(v1, v2);
+    }
+    furi_string_free(v2);
 }
 
 size_t furi_string_hash(const FuriString* v) {
-    return string_hash(v->string);
+    return m_core_hash(furi_string_cptr(v), v->size);
 }
 
 char furi_string_get_char(const FuriString* v, size_t index) {
-    return string_get_char(v->string, index);
+    furi_check(index < v->size);
+    return furi_string_cptr(v)[index];
 }
 
 const char* furi_string_get_cstr(const FuriString* s) {
-    return string_get_cstr(s->string);
+    return furi_string_cptr(s);
 }
 
 void furi_string_set(FuriString* s, FuriString* source) {
-    string_set(s->string, source->string);
+    furi_string_set_data(s, furi_string_cptr(source), source->size);
 }
 
 void furi_string_set_str(FuriString* s, const char cstr[]) {
-    string_set(s->string, cstr);
+    furi_string_set_data(s, cstr, strlen(cstr));
 }
 
 void furi_string_set_strn(FuriString* s, const char str[], size_t n) {
-    string_set_strn(s->string, str, n);
+    furi_string_set_data(s, str, strnlen(str, n));
 }
 
 void furi_string_set_char(FuriString* s, size_t index, const char c) {
-    string_set_char(s->string, index, c);
+    furi_check(index < s->size);
+    furi_string_ptr(s)[index] = c;
+}
+
+/* Difference of the first differing characters on any libc */
+static int furi_string_compare(const char* p1, const char* p2, bool is_case_insensitive) {
+    int c1, c2;
+    do {
+        c1 = (unsigned char)*p1++;
+        c2 = (unsigned char)*p2++;
+        if(is_case_insensitive) {
+            c1 = toupper(c1);
+            c2 = toupper(c2);
+        }
+    } while(c1 == c2 && c1 != '\0');
+    return c1 - c2;
 }
 
 int furi_string_cmp(const FuriString* s1, const FuriString* s2) {
-    return string_cmp(s1->string, s2->string);
+    return furi_string_compare(furi_string_cptr(s1), furi_string_cptr(s2), false);
 }
 
 int furi_string_cmp_str(const FuriString* s1, const char str[]) {
-    return string_cmp(s1->string, str);
+    return furi_string_compare(furi_string_cptr(s1), str, false);
 }
 
 int furi_string_cmpi(const FuriString* v1, const FuriString* v2) {
-    return string_cmpi(v1->string, v2->string);
+    return furi_string_compare(furi_string_cptr(v1), furi_string_cptr(v2), true);
 }
 
 int furi_string_cmpi_str(const FuriString* v1, const char p2[]) {
-    return string_cmpi_str(v1->string, p2);
+    return furi_string_compare(furi_string_cptr(v1), p2, true);
 }
 
 size_t furi_string_search(const FuriString* v, const FuriString* needle, size_t start) {
-    return string_search(v->string, needle->string, start);
+    return furi_string_search_str(v, furi_string_cptr(needle), start);
 }
 
 size_t furi_string_search_str(const FuriString* v, const char needle[], size_t start) {
-    return string_search(v->string, needle, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cptr(v);
+    const char* found = strstr(ptr + start, needle);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 bool furi_string_equal(const FuriString* v1, const FuriString* v2) {
-    return string_equal_p(v1->string, v2->string);
+    return v1->size == v2->size &&
+           memcmp(furi_string_cptr(v1), furi_string_cptr(v2), v1->size) == 0;
 }
 
 bool furi_string_equal_str(const FuriString* v1, const char v2[]) {
-    return string_equal_p(v1->string, v2);
+    return strcmp(furi_string_cptr(v1), v2) == 0;
 }
 
 void furi_string_push_back(FuriString* v, char c) {
-    string_push_back(v->string, c);
+    furi_string_grow(v, v->size + 2);
+    char* ptr = furi_string_ptr(v);
+    ptr[v->size++] = c;
+    ptr[v->size] = '\0';
 }
 
 size_t furi_string_size(const FuriString* s) {
-    return string_size(s->string);
+    return s->size;
 }
 
 int furi_string_printf(FuriString* v, const char format[], ...) {
@@ -161,7 +389,7 @@ int furi_string_printf(FuriString* v, const char format[], ...) {
 }
 
 int furi_string_vprintf(FuriString* v, const char format[], va_list args) {
-    return string_vprintf(v->string, format, args);
+    return furi_string_vprintf_at(v, 0, format, args);
 }
 
 int furi_string_cat_printf(FuriString* v, const char format[], ...) {
@@ -173,96 +401,179 @@ int furi_string_cat_printf(FuriString* v, const char format[], ...) {
 }
 
 int furi_string_cat_vprintf(FuriString* v, const char format[], va_list args) {
-    FuriString* string = furi_string_alloc();
-    int ret = furi_string_vprintf(string, format, args);
-    furi_string_cat(v, string);
-    furi_string_free(string);
+    // Arguments may point to the string itself, format out of it
+    va_list args_copy;
+    va_copy(args_copy, args);
+    char buffer[FURI_STRING_CAT_PRINTF_BUFFER_SIZE];
+    int ret = vsnprintf(buffer, sizeof(buffer), format, args);
+    if(ret >= (int)sizeof(buffer)) {
+        FuriString* string = furi_string_alloc();
+        ret = furi_string_vprintf_at(string, 0, format, args_copy);
+        furi_string_cat(v, string);
+        furi_string_free(string);
+    } else if(ret > 0) {
+        furi_string_append(v, buffer, ret);
+    }
+    va_end(args_copy);
     return ret;
 }
 
 bool furi_string_empty(const FuriString* v) {
-    return string_empty_p(v->string);
+    return v->size == 0;
 }
 
 void furi_string_replace_at(FuriString* v, size_t pos, size_t len, const char str2[]) {
-    string_replace_at(v->string, pos, len, str2);
+    furi_check(pos <= v->size && len <= v->size - pos);
+    const size_t str2_size = strlen(str2);
+    const size_t tail = v->size - pos - len;
+
+    furi_string_grow(v, v->size - len + str2_size + 1);
+    char* ptr = furi_string_ptr(v);
+    memmove(ptr + pos + str2_size, ptr + pos + len, tail);
+    memcpy(ptr + pos, str2, str2_size);
+    furi_string_set_size(v, pos + str2_size + tail);
 }
 
 size_t
     furi_string_replace(FuriString* string, FuriString* needle, FuriString* replace, size_t start) {
-    return string_replace(string->string, needle->string, replace->string, start);
+    return furi_string_replace_str(
+        string, furi_string_cptr(needle), furi_string_cptr(replace), start);
 }
 
 size_t furi_string_replace_str(FuriString* v, const char str1[], const char str2[], size_t start) {
-    return string_replace_str(v->string, str1, str2, start);
+    const size_t position = furi_string_search_str(v, str1, start);
+    if(position != FURI_STRING_FAILURE) {
+        furi_string_replace_at(v, position, strlen(str1), str2);
+    }
+    return position;
 }
 
 void furi_string_replace_all_str(FuriString* v, const char str1[], const char str2[]) {
-    string_replace_all_str(v->string, str1, str2);
+    const size_t str1_size = strlen(str1);
+    const size_t str2_size = strlen(str2);
+    if(!str1_size) return;
+
+    size_t position = furi_string_search_str(v, str1, 0);
+    while(position != FURI_STRING_FAILURE) {
+        furi_string_replace_at(v, position, str1_size, str2);
+        position = furi_string_search_str(v, str1, position + str2_size);
+    }
 }
 
 void furi_string_replace_all(FuriString* v, const FuriString* str1, const FuriString* str2) {
-    string_replace_all(v->string, str1->string, str2->string);
+    furi_string_replace_all_str(v, furi_string_cptr(str1), furi_string_cptr(str2));
 }
 
 bool furi_string_start_with(const FuriString* v, const FuriString* v2) {
-    return string_start_with_string_p(v->string, v2->string);
+    return v->size >= v2->size &&
+           memcmp(furi_string_cptr(v), furi_string_cptr(v2), v2->size) == 0;
 }
 
 bool furi_string_start_with_str(const FuriString* v, const char str[]) {
-    return string_start_with_str_p(v->string, str);
+    return strncmp(furi_string_cptr(v), str, strlen(str)) == 0;
 }
 
 bool furi_string_end_with(const FuriString* v, const FuriString* v2) {
-    return string_end_with_string_p(v->string, v2->string);
+    return v->size >= v2->size &&
+           memcmp(furi_string_cptr(v) + v->size - v2->size, furi_string_cptr(v2), v2->size) == 0;
 }
 
 bool furi_string_end_with_str(const FuriString* v, const char str[]) {
-    return string_end_with_str_p(v->string, str);
+    const size_t str_size = strlen(str);
+    return v->size >= str_size &&
+           memcmp(furi_string_cptr(v) + v->size - str_size, str, str_size) == 0;
 }
 
 size_t furi_string_search_char(const FuriString* v, char c, size_t start) {
-    return string_search_char(v->string, c, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cptr(v);
+    const char* found = strchr(ptr + start, c);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 size_t furi_string_search_rchar(const FuriString* v, char c, size_t start) {
-    return string_search_rchar(v->string, c, start);
+    if(start > v->size) return FURI_STRING_FAILURE;
+    const char* ptr = furi_string_cptr(v);
+    const char* found = strrchr(ptr + start, c);
+    return found ? (size_t)(found - ptr) : FURI_STRING_FAILURE;
 }
 
 void furi_string_left(FuriString* v, size_t index) {
-    string_left(v->string, index);
+    if(index < v->size) furi_string_set_size(v, index);
 }
 
 void furi_string_right(FuriString* v, size_t index) {
-    string_right(v->string, index);
+    index = MIN(index, v->size);
+    char* ptr = furi_string_ptr(v);
+    memmove(ptr, ptr + index, v->size - index);
+    furi_string_set_size(v, v->size - index);
 }
 
 void furi_string_mid(FuriString* v, size_t index, size_t size) {
-    string_mid(v->string, index, size);
+    furi_string_right(v, index);
+    furi_string_left(v, size);
 }
 
 void furi_string_trim(FuriString* v, const char charac[]) {
-    string_strim(v->string, charac);
+    const char* ptr = furi_string_ptr(v);
+    size_t end = v->size;
+    while(end > 0 && strchr(charac, ptr[end - 1])) end--;
+    size_t begin = 0;
+    while(begin < end && strchr(charac, ptr[begin])) begin++;
+
+    furi_string_left(v, end);
+    furi_string_right(v, begin);
 }
 
 void furi_string_cat(FuriString* v, const FuriString* v2) {
-    string_cat(v->string, v2->string);
+    furi_string_append(v, furi_string_cptr(v2), v2->size);
 }
 
 void furi_string_cat_str(FuriString* v, const char str[]) {
-    string_cat(v->string, str);
+    furi_string_append(v, str, strlen(str));
 }
 
 void furi_string_set_n(FuriString* v, const FuriString* ref, size_t offset, size_t length) {
-    string_set_n(v->string, ref->string, offset, length);
+    furi_check(offset <= ref->size);
+    furi_string_set_data(v, furi_string_cptr(ref) + offset, MIN(length, ref->size - offset));
 }
 
 size_t furi_string_utf8_length(FuriString* str) {
-    return string_length_u(str->string);
+    const char* ptr = furi_string_cptr(str);
+    m_str1ng_utf8_state_e state = M_STRING_UTF8_STARTING;
+    string_unicode_t unicode = 0;
+    size_t length = 0;
+    for(size_t i = 0; i < str->size; i++) {
+        m_str1ng_utf8_decode(ptr[i], &state, &unicode);
+        if(state == M_STRING_UTF8_ERROR) return SIZE_MAX;
+        if(state == M_STRING_UTF8_STARTING) length++;
+    }
+    return length;
 }
 
 void furi_string_utf8_push(FuriString* str, FuriStringUnicodeValue u) {
-    string_push_u(str->string, u);
+    char utf8[4];
+    size_t size;
+    if(u < 0x80) {
+        utf8[0] = u;
+        size = 1;
+    } else if(u < 0x800) {
+        utf8[0] = 0xC0 | (u >> 6);
+        utf8[1] = 0x80 | (u & 0x3F);
+        size = 2;
+    } else if(u < 0x10000) {
+        utf8[0] = 0xE0 | (u >> 12);
+        utf8[1] = 0x80 | ((u >> 6) & 0x3F);
+        utf8[2] = 0x80 | (u & 0x3F);
+        size = 3;
+    } else {
+        utf8[0] = 0xF0 | ((u >> 18) & 0x07);
+        utf8[1] = 0x80 | ((u >> 12) & 0x3F);
+        utf8[2] = 0x80 | ((u >> 6) & 0x3F);
+        utf8[3] = 0x80 | (u & 0x3F);
+        size = 4;
+    }
+    furi_string_append(str, utf8, size);
 }
 
 static m_str1ng_utf8_state_e furi_state_to_state(FuriStringUTF8State state) {
@@ -83,10 +83,54 @@ FuriString* furi_string_alloc_move(FuriString* source);
 
 /**
  * @brief Free FuriString.
+ * Strings allocated in arena are released with the arena, this call does nothing for them.
  * @param string 
  */
 void furi_string_free(FuriString* string);
 
+//---------------------------------------------------------------------------
+//                                  Arena
+//---------------------------------------------------------------------------
+
+/**
+ * @brief Arena chunk size used when 0 is passed to furi_string_arena_alloc.
+ */
+#define FURI_STRING_ARENA_CHUNK_SIZE_DEFAULT (512)
+
+/**
+ * @brief Furi string arena.
+ * Strings allocated in arena take memory from its chunks and are released all at once,
+ * useful for parsers that make many temporary strings. Not thread safe.
+ */
+typedef struct FuriStringArena FuriStringArena;
+
+/**
+ * @brief Allocate new FuriStringArena.
+ * @param chunk_size bytes taken from heap at once, 0 for default
+ * @return FuriStringArena* 
+ */
+FuriStringArena* furi_string_arena_alloc(size_t chunk_size);
+
+/**
+ * @brief Free FuriStringArena and all its strings.
+ * @param arena 
+ */
+void furi_string_arena_free(FuriStringArena* arena);
+
+/**
+ * @brief Release all strings of the arena, arena can be used again.
+ * @param arena 
+ */
+void furi_string_arena_reset(FuriStringArena* arena);
+
+/**
+ * @brief Allocate new FuriString in arena.
+ * String is valid until arena is reset or freed, it can be used with any FuriString function.
+ * @param arena 
+ * @return FuriString* 
+ */
+FuriString* furi_string_alloc_arena(FuriStringArena* arena);
+
 //---------------------------------------------------------------------------
 //                         String memory management
 //---------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #include <timers.h>
 #include "log.h"
 #include <furi_hal_rtc.h>
+#include <furi_hal_cortex.h>
 
 #include <FreeRTOS.h>
 #include <task.h>
@@ -32,6 +33,24 @@ __attribute__((__noreturn__)) void furi_thread_catch() { //-V1082
     __builtin_unreachable();
 }
 
+/** FreeRTOS run time stats clock: cycle counter extended to 64 bits
+ *
+ * Called by scheduler only, on every context switch: that is serialized and
+ * often enough to never miss a counter wrap.
+ */
+uint64_t furi_thread_runtime_counter() {
+    static uint32_t last = 0;
+    static uint64_t high = 0;
+
+    const uint32_t now = furi_hal_cortex_get_cycle_count();
+    if(now < last) {
+        high += 1ULL << 32;
+    }
+    last = now;
+
+    return high | now;
+}
+
 static void furi_thread_set_state(FuriThread* thread, FuriThreadState state) {
     furi_assert(thread);
     thread->state = state;
@@ -538,6 +557,31 @@ uint32_t furi_thread_get_stack_space(FuriThreadId thread_id) {
     return (sz);
 }
 
+uint64_t furi_thread_get_cpu_time(FuriThreadId thread_id) {
+    TaskHandle_t hTask = (TaskHandle_t)thread_id;
+    uint64_t cpu_time = 0;
+
+    if(!FURI_IS_IRQ_MODE() && (hTask != NULL)) {
+        TaskStatus_t status;
+        vTaskGetInfo(hTask, &status, pdFALSE, eInvalid);
+        cpu_time = status.ulRunTimeCounter;
+    }
+
+    return cpu_time;
+}
+
+int32_t furi_thread_get_heap_balance(FuriThreadId thread_id) {
+    TaskHandle_t hTask = (TaskHandle_t)thread_id;
+    int32_t balance = 0;
+
+    if(!FURI_IS_IRQ_MODE() && (hTask != NULL)) {
+        void* value = pvTaskGetThreadLocalStoragePointer(hTask, FURI_THREAD_TLS_HEAP_BALANCE);
+        balance = (int32_t)(intptr_t)value;
+    }
+
+    return balance;
+}
+
 static size_t __furi_thread_stdout_write(FuriThread* thread, const char* data, size_t size) {
     if(thread->output.write_callback != NULL) {
         thread->output.write_callback(data, size);
@@ -285,6 +285,29 @@ const char* furi_thread_get_appid(FuriThreadId thread_id);
  */
 uint32_t furi_thread_get_stack_space(FuriThreadId thread_id);
 
+/**
+ * @brief Get thread CPU time
+ * 
+ * Core cycles spent by the thread, accounted by scheduler on context switch:
+ * time slice of the running thread is added when it is switched out.
+ * 
+ * @param thread_id thread id
+ * @return uint64_t cycles, see furi_hal_cortex_instructions_per_microsecond
+ */
+uint64_t furi_thread_get_cpu_time(FuriThreadId thread_id);
+
+/**
+ * @brief Get thread heap balance
+ * 
+ * Bytes allocated minus bytes freed by the thread, heap block headers included.
+ * Memory is subtracted from the thread that frees it, so balance of a thread
+ * that frees memory of others may go negative.
+ * 
+ * @param thread_id thread id
+ * @return int32_t balance in bytes
+ */
+int32_t furi_thread_get_heap_balance(FuriThreadId thread_id);
+
 /** Get STDOUT callback for thead
  *
  * @return STDOUT callback
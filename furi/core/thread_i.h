@@ -6,6 +6,9 @@
 #include <FreeRTOS.h>
 #include <task.h>
 
+/** Thread local storage slot with heap balance of the thread, maintained by memmgr_heap */
+#define FURI_THREAD_TLS_HEAP_BALANCE 1
+
 typedef struct {
     FuriThreadStdoutWriteCallback write_callback;
     FuriString* buffer;
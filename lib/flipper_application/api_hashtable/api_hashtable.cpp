@@ -32,6 +32,37 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    const PerfectHashApiInterface* perfect_hash_interface =
+        static_cast<const PerfectHashApiInterface*>(interface);
+
+    if(perfect_hash_interface->table_size == 0) {
+        return false;
+    }
+
+    const int16_t displacement =
+        perfect_hash_interface->displacements
+            [api_perfect_hash_mix(hash, 0) % perfect_hash_interface->displacements_size];
+    const uint32_t slot = (displacement < 0) ?
+                              (uint32_t)(-displacement - 1) :
+                              api_perfect_hash_mix(hash, displacement) %
+                                  perfect_hash_interface->table_size;
+
+    // Every hash lands somewhere, absent symbols are caught by comparing it
+    const sym_entry* entry = &perfect_hash_interface->table[slot];
+    if(entry->hash != hash) {
+        FURI_LOG_W(
+            TAG, "Can't find symbol with hash %lx @ %p!", hash, perfect_hash_interface->table);
+        return false;
+    }
+
+    *address = entry->address;
+    return true;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     return elf_gnu_hash(s);
 }
\ No newline at end of file
@@ -28,6 +28,18 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Resolver for API entries using a minimal perfect hash table, O(1)
+ * @param interface pointer to PerfectHashApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_perfect_hash(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
@@ -45,6 +57,34 @@ struct HashtableApiInterface : public ElfApiInterface {
     const sym_entry *table_cbegin, *table_cend;
 };
 
+/**
+ * @brief  PerfectHashApiInterface is an implementation of ElfApiInterface
+ * that uses a minimal perfect hash table built by perfect_hash() from compilehash.hpp.
+ */
+struct PerfectHashApiInterface : public ElfApiInterface {
+    const sym_entry* table;
+    const int16_t* displacements;
+    uint16_t table_size;
+    uint16_t displacements_size;
+};
+
+/**
+ * @brief Mix symbol hash with seed, shared by perfect hash builder and resolver
+ * @param hash symbol hash
+ * @param seed 0 for bucket selection, displacement for slot selection
+ * @return mixed hash
+ */
+constexpr uint32_t api_perfect_hash_mix(uint32_t hash, uint32_t seed) {
+    // murmur3 finalizer
+    uint32_t h = hash ^ (seed * 0x9E3779B9);
+    h ^= h >> 16;
+    h *= 0x85EBCA6B;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
 #define API_METHOD(x, ret_type, args_type)                                                     \
     sym_entry {                                                                                \
         .hash = elf_gnu_hash(#x), .address = (uint32_t)(static_cast<ret_type(*) args_type>(x)) \
@@ -0,0 +1,116 @@
+/**
+ * Implementation of compile-time minimal perfect hash for symbol table entries.
+ *
+ * Hash and displace: entries are split into buckets by hash, then every
+ * bucket, largest first, gets a displacement that moves all its entries into
+ * free slots. Single entry buckets take the remaining slots directly.
+ * Table has exactly one slot per entry.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* Entries per bucket on average, more makes the table smaller and the build slower */
+#define API_PERFECT_HASH_BUCKET_LOAD 2
+/* Bucket may not be bigger than this, otherwise table is not built */
+#define API_PERFECT_HASH_BUCKET_SIZE_MAX 32
+/* Displacements tried for a bucket before giving up */
+#define API_PERFECT_HASH_DISPLACEMENT_MAX 0x7FFF
+
+template <std::size_t N, std::size_t B>
+struct ApiPerfectHashTable {
+    std::array<sym_entry, N> table;
+    std::array<int16_t, B> displacements;
+    bool is_valid;
+};
+
+constexpr std::size_t api_perfect_hash_bucket_count(std::size_t entries) {
+    return entries / API_PERFECT_HASH_BUCKET_LOAD + 1;
+}
+
+/* Build minimal perfect hash table, is_valid is false if entries have duplicate hashes.
+ * Uses sym_entry and api_perfect_hash_mix from api_hashtable.h */
+template <std::size_t N>
+constexpr auto perfect_hash(const std::array<sym_entry, N>& entries)
+    -> ApiPerfectHashTable<N, api_perfect_hash_bucket_count(N)> {
+    constexpr std::size_t B = api_perfect_hash_bucket_count(N);
+    ApiPerfectHashTable<N, B> result{};
+    result.is_valid = false;
+    // Direct slots are stored in displacements
+    if(N > API_PERFECT_HASH_DISPLACEMENT_MAX) return result;
+
+    // Group entries by bucket: counts, then start offsets, then members
+    std::array<std::size_t, B + 1> bucket_start{};
+    for(std::size_t i = 0; i < N; i++) {
+        bucket_start[api_perfect_hash_mix(entries[i].hash, 0) % B + 1]++;
+    }
+    std::size_t bucket_size_max = 0;
+    for(std::size_t b = 0; b < B; b++) {
+        if(bucket_start[b + 1] > bucket_size_max) bucket_size_max = bucket_start[b + 1];
+        bucket_start[b + 1] += bucket_start[b];
+    }
+    if(bucket_size_max > API_PERFECT_HASH_BUCKET_SIZE_MAX) return result;
+
+    std::array<std::size_t, N> members{};
+    std::array<std::size_t, B> bucket_fill{};
+    for(std::size_t i = 0; i < N; i++) {
+        std::size_t b = api_perfect_hash_mix(entries[i].hash, 0) % B;
+        members[bucket_start[b] + bucket_fill[b]++] = i;
+    }
+
+    std::array<bool, N> is_used{};
+    std::size_t free_slot = 0;
+    for(std::size_t size = bucket_size_max; size > 0; size--) {
+        for(std::size_t b = 0; b < B; b++) {
+            if(bucket_start[b + 1] - bucket_start[b] != size) continue;
+            const std::size_t* bucket = &members[bucket_start[b]];
+
+            if(size == 1) {
+                // Direct slot, stored as negative displacement
+                while(is_used[free_slot]) free_slot++;
+                is_used[free_slot] = true;
+                result.table[free_slot] = entries[bucket[0]];
+                result.displacements[b] = -static_cast<int16_t>(free_slot + 1);
+                continue;
+            }
+
+            // Same hash never gets separated
+            for(std::size_t i = 0; i < size; i++) {
+                for(std::size_t j = i + 1; j < size; j++) {
+                    if(entries[bucket[i]].hash == entries[bucket[j]].hash) return result;
+                }
+            }
+
+            std::array<std::size_t, API_PERFECT_HASH_BUCKET_SIZE_MAX> slots{};
+            int16_t displacement = 1;
+            for(; displacement < API_PERFECT_HASH_DISPLACEMENT_MAX; displacement++) {
+                bool is_placed = true;
+                for(std::size_t i = 0; i < size && is_placed; i++) {
+                    slots[i] = api_perfect_hash_mix(entries[bucket[i]].hash, displacement) % N;
+                    is_placed = !is_used[slots[i]];
+                    for(std::size_t j = 0; j < i && is_placed; j++) {
+                        is_placed = slots[i] != slots[j];
+                    }
+                }
+                if(is_placed) break;
+            }
+            if(displacement == API_PERFECT_HASH_DISPLACEMENT_MAX) return result;
+
+            for(std::size_t i = 0; i < size; i++) {
+                is_used[slots[i]] = true;
+                result.table[slots[i]] = entries[bucket[i]];
+            }
+            result.displacements[b] = displacement;
+        }
+    }
+
+    result.is_valid = true;
+    return result;
+}
+
+#endif
@@ -0,0 +1,263 @@
+#include "application_meta_cache.h"
+#include "flipper_application.h"
+
+#include <m-dict.h>
+
+#define TAG "FapMetaCache"
+
+#define FLIPPER_APPLICATION_META_CACHE_MAGIC (0x4D504146)
+#define FLIPPER_APPLICATION_META_CACHE_VERSION (1)
+
+/** Entries saved at most, ones not used in this session are dropped first */
+#define FLIPPER_APPLICATION_META_CACHE_MAX_ENTRIES (256)
+
+/** Cache files bigger than this are considered broken */
+#define FLIPPER_APPLICATION_META_CACHE_MAX_FILE_SIZE (64 * 1024)
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+} FlipperApplicationMetaCacheHeader;
+
+/* Followed by path_length bytes of path, without terminator */
+typedef struct {
+    uint32_t timestamp;
+    uint64_t size;
+    FlipperApplicationManifest manifest;
+    uint16_t path_length;
+} FlipperApplicationMetaCacheRecord;
+
+#pragma pack(pop)
+
+typedef struct {
+    uint32_t timestamp;
+    uint64_t size;
+    FlipperApplicationManifest manifest;
+    bool is_used;
+} FlipperApplicationMetaCacheEntry;
+
+DICT_DEF2(
+    FlipperApplicationMetaCacheDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    FlipperApplicationMetaCacheEntry,
+    M_POD_OPLIST)
+
+struct FlipperApplicationMetaCache {
+    Storage* storage;
+    FlipperApplicationMetaCacheDict_t entries;
+    bool is_dirty;
+};
+
+static bool flipper_application_meta_cache_parse(
+    FlipperApplicationMetaCache* cache,
+    const uint8_t* data,
+    size_t size) {
+    FlipperApplicationMetaCacheHeader header;
+    if(size < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+    if(header.magic != FLIPPER_APPLICATION_META_CACHE_MAGIC ||
+       header.version != FLIPPER_APPLICATION_META_CACHE_VERSION) {
+        return false;
+    }
+
+    size_t offset = sizeof(header);
+    FuriString* path = furi_string_alloc();
+    for(uint32_t i = 0; i < header.count; i++) {
+        FlipperApplicationMetaCacheRecord record;
+        if(size - offset < sizeof(record)) break;
+        memcpy(&record, &data[offset], sizeof(record));
+        offset += sizeof(record);
+        if(size - offset < record.path_length) break;
+        furi_string_set_strn(path, (const char*)&data[offset], record.path_length);
+        offset += record.path_length;
+
+        FlipperApplicationMetaCacheEntry entry = {
+            .timestamp = record.timestamp,
+            .size = record.size,
+            .manifest = record.manifest,
+            .is_used = false,
+        };
+        FlipperApplicationMetaCacheDict_set_at(cache->entries, path, entry);
+    }
+    furi_string_free(path);
+
+    // Truncated file: drop everything, nothing can be trusted
+    if(offset != size || FlipperApplicationMetaCacheDict_size(cache->entries) != header.count) {
+        FlipperApplicationMetaCacheDict_reset(cache->entries);
+        return false;
+    }
+
+    return true;
+}
+
+static void flipper_application_meta_cache_load(FlipperApplicationMetaCache* cache) {
+    File* file = storage_file_alloc(cache->storage);
+    uint8_t* data = NULL;
+    bool is_loaded = false;
+
+    do {
+        if(!storage_file_open(
+               file, FLIPPER_APPLICATION_META_CACHE_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            // First run, nothing to report
+            is_loaded = true;
+            break;
+        }
+        size_t size = storage_file_size(file);
+        if(size > FLIPPER_APPLICATION_META_CACHE_MAX_FILE_SIZE) break;
+        data = malloc(size);
+        if(storage_file_read(file, data, size) != size) break;
+        is_loaded = flipper_application_meta_cache_parse(cache, data, size);
+    } while(false);
+
+    if(!is_loaded) {
+        FURI_LOG_W(TAG, "Cache is broken, rebuilding");
+        cache->is_dirty = true;
+    }
+
+    free(data);
+    storage_file_free(file);
+}
+
+FlipperApplicationMetaCache* flipper_application_meta_cache_alloc(Storage* storage) {
+    furi_assert(storage);
+
+    FlipperApplicationMetaCache* cache = malloc(sizeof(FlipperApplicationMetaCache));
+    cache->storage = storage;
+    cache->is_dirty = false;
+    FlipperApplicationMetaCacheDict_init(cache->entries);
+    flipper_application_meta_cache_load(cache);
+
+    return cache;
+}
+
+void flipper_application_meta_cache_free(FlipperApplicationMetaCache* cache) {
+    furi_assert(cache);
+
+    flipper_application_meta_cache_save(cache);
+    FlipperApplicationMetaCacheDict_clear(cache->entries);
+    free(cache);
+}
+
+bool flipper_application_meta_cache_save(FlipperApplicationMetaCache* cache) {
+    furi_assert(cache);
+
+    if(!cache->is_dirty) return true;
+
+    const bool is_full = FlipperApplicationMetaCacheDict_size(cache->entries) >
+                         FLIPPER_APPLICATION_META_CACHE_MAX_ENTRIES;
+
+    // Whole cache goes to SD card in one write
+    FlipperApplicationMetaCacheHeader header = {
+        .magic = FLIPPER_APPLICATION_META_CACHE_MAGIC,
+        .version = FLIPPER_APPLICATION_META_CACHE_VERSION,
+        .count = 0,
+    };
+    size_t size = sizeof(header);
+    FlipperApplicationMetaCacheDict_it_t it;
+    for(FlipperApplicationMetaCacheDict_it(it, cache->entries);
+        !FlipperApplicationMetaCacheDict_end_p(it);
+        FlipperApplicationMetaCacheDict_next(it)) {
+        const FlipperApplicationMetaCacheDict_itref_t* itref =
+            FlipperApplicationMetaCacheDict_cref(it);
+        if(is_full && !itref->value.is_used) continue;
+        if(header.count == FLIPPER_APPLICATION_META_CACHE_MAX_ENTRIES) break;
+        size += sizeof(FlipperApplicationMetaCacheRecord) + furi_string_size(itref->key);
+        header.count++;
+    }
+
+    uint8_t* data = malloc(size);
+    memcpy(data, &header, sizeof(header));
+    size_t offset = sizeof(header);
+    uint32_t count = 0;
+    for(FlipperApplicationMetaCacheDict_it(it, cache->entries);
+        !FlipperApplicationMetaCacheDict_end_p(it) && count < header.count;
+        FlipperApplicationMetaCacheDict_next(it)) {
+        const FlipperApplicationMetaCacheDict_itref_t* itref =
+            FlipperApplicationMetaCacheDict_cref(it);
+        if(is_full && !itref->value.is_used) continue;
+        FlipperApplicationMetaCacheRecord record = {
+            .timestamp = itref->value.timestamp,
+            .size = itref->value.size,
+            .manifest = itref->value.manifest,
+            .path_length = furi_string_size(itref->key),
+        };
+        memcpy(&data[offset], &record, sizeof(record));
+        offset += sizeof(record);
+        memcpy(&data[offset], furi_string_get_cstr(itref->key), record.path_length);
+        offset += record.path_length;
+        count++;
+    }
+
+    bool is_saved = false;
+    File* file = storage_file_alloc(cache->storage);
+    if(storage_file_open(
+           file, FLIPPER_APPLICATION_META_CACHE_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        is_saved = (storage_file_write(file, data, size) == size);
+    }
+    storage_file_free(file);
+    free(data);
+
+    if(is_saved) {
+        cache->is_dirty = false;
+    } else {
+        FURI_LOG_E(TAG, "Failed to save cache");
+    }
+
+    return is_saved;
+}
+
+const FlipperApplicationManifest* flipper_application_meta_cache_get_manifest(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path) {
+    furi_assert(cache);
+    furi_assert(path);
+
+    const char* path_cstr = furi_string_get_cstr(path);
+    uint32_t timestamp = 0;
+    FileInfo fileinfo;
+    if(storage_common_timestamp(cache->storage, path_cstr, &timestamp) != FSE_OK ||
+       storage_common_stat(cache->storage, path_cstr, &fileinfo) != FSE_OK) {
+        return NULL;
+    }
+
+    FlipperApplicationMetaCacheEntry* entry =
+        FlipperApplicationMetaCacheDict_get(cache->entries, path);
+    if(entry && entry->timestamp == timestamp && entry->size == fileinfo.size) {
+        entry->is_used = true;
+        return &entry->manifest;
+    }
+
+    FlipperApplicationMetaCacheEntry new_entry = {
+        .timestamp = timestamp,
+        .size = fileinfo.size,
+        .is_used = true,
+    };
+    if(!flipper_application_load_manifest(path, cache->storage, &new_entry.manifest)) {
+        // Not cached: file may be temporarily unavailable, e.g. open by running application
+        if(entry) {
+            FlipperApplicationMetaCacheDict_erase(cache->entries, path);
+            cache->is_dirty = true;
+        }
+        return NULL;
+    }
+
+    FlipperApplicationMetaCacheDict_set_at(cache->entries, path, new_entry);
+    cache->is_dirty = true;
+
+    return &FlipperApplicationMetaCacheDict_get(cache->entries, path)->manifest;
+}
+
+bool flipper_application_meta_cache_load_name_and_icon(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name) {
+    const FlipperApplicationManifest* manifest =
+        flipper_application_meta_cache_get_manifest(cache, path);
+    flipper_application_fill_name_and_icon(manifest, path, icon_ptr, item_name);
+    return manifest != NULL;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file application_meta_cache.h
+ * Flipper application metadata cache
+ *
+ * Keeps manifests of FAP files in a single file on SD card, so application
+ * lists do not have to open and parse every ELF file. Entries are validated
+ * against file timestamp and size and refreshed on demand.
+ */
+#pragma once
+
+#include "application_manifest.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLIPPER_APPLICATION_META_CACHE_PATH CFG_PATH(".fap_meta.cache")
+
+typedef struct FlipperApplicationMetaCache FlipperApplicationMetaCache;
+
+/**
+ * @brief Allocate cache and load it from SD card
+ * @param storage Storage instance
+ * @return FlipperApplicationMetaCache instance
+ */
+FlipperApplicationMetaCache* flipper_application_meta_cache_alloc(Storage* storage);
+
+/**
+ * @brief Save cache to SD card if it was changed and free it
+ * @param cache FlipperApplicationMetaCache instance
+ */
+void flipper_application_meta_cache_free(FlipperApplicationMetaCache* cache);
+
+/**
+ * @brief Save cache to SD card if it was changed
+ * @param cache FlipperApplicationMetaCache instance
+ * @return true if cache is saved or there was nothing to save
+ */
+bool flipper_application_meta_cache_save(FlipperApplicationMetaCache* cache);
+
+/**
+ * @brief Get manifest of FAP file, loading it from the file only when cached one is stale
+ * @param cache FlipperApplicationMetaCache instance
+ * @param path Path to FAP file
+ * @return Pointer to manifest, valid till next cache call, or NULL if it can't be loaded
+ */
+const FlipperApplicationManifest* flipper_application_meta_cache_get_manifest(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path);
+
+/**
+ * @brief Load name and icon from FAP file, same as flipper_application_load_name_and_icon
+ * @param cache FlipperApplicationMetaCache instance
+ * @param path Path to FAP file
+ * @param icon_ptr Icon pointer
+ * @param item_name Application name
+ * @return true if icon and name were loaded successfully
+ */
+bool flipper_application_meta_cache_load_name_and_icon(
+    FlipperApplicationMetaCache* cache,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name);
+
+#ifdef __cplusplus
+}
+#endif
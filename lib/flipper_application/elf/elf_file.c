@@ -2,6 +2,8 @@
 #include "elf_file_i.h"
 
 #include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+#include <toolbox/trace.h>
 #include <elf.h>
 #include "elf_api_interface.h"
 #include "../api_hashtable/api_hashtable.h"
@@ -13,6 +15,12 @@
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
 #define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
+#define RELOCATION_SNAPSHOT_MAGIC 0x534C4552
+#define RELOCATION_SNAPSHOT_VERSION 2
+#define RELOCATION_SNAPSHOT_MAX_ENTRIES 8192
+#define STREAM_WINDOW_SIZE 512
+/* Heap blocks are aligned to this, only stricter alignment needs aligned_malloc */
+#define HEAP_ALIGNMENT 8
 
 // #define ELF_DEBUG_LOG 1
 
@@ -55,6 +63,281 @@ static void address_cache_put(AddressCache_t cache, int symEntry, Elf32_Addr sym
     AddressCache_set_at(cache, symEntry, symAddr);
 }
 
+/**************************************************************************************************/
+/******************************************** Memory **********************************************/
+/**************************************************************************************************/
+
+static void elf_memory_add(ELFFile* elf, size_t size) {
+    elf->memory_used += size;
+    if(elf->memory_used > elf->memory_peak) {
+        elf->memory_peak = elf->memory_used;
+    }
+}
+
+static void elf_memory_remove(ELFFile* elf, size_t size) {
+    elf->memory_used -= size;
+}
+
+static size_t elf_aligned_malloc_size(size_t size, size_t alignment) {
+    // Same overhead as aligned_malloc adds
+    return size + alignment - 1 + sizeof(void*);
+}
+
+/**************************************************************************************************/
+/********************************************* Stream *********************************************/
+/**************************************************************************************************/
+
+/* Reads data sequentially, either from memory or from file through a small window */
+typedef struct {
+    File* fd;
+    uint8_t* buffer;
+    size_t length;
+    size_t position;
+    Elf32_Off file_offset;
+    size_t file_remaining;
+} ELFStream;
+
+static void elf_stream_init_memory(ELFStream* stream, const void* data, size_t size) {
+    stream->fd = NULL;
+    stream->buffer = (uint8_t*)data;
+    stream->length = size;
+    stream->position = 0;
+    stream->file_offset = 0;
+    stream->file_remaining = 0;
+}
+
+static void elf_stream_init_file(ELFFile* elf, ELFStream* stream, Elf32_Off offset, size_t size) {
+    stream->fd = elf->fd;
+    stream->buffer = malloc(STREAM_WINDOW_SIZE);
+    stream->length = 0;
+    stream->position = 0;
+    stream->file_offset = offset;
+    stream->file_remaining = size;
+    elf_memory_add(elf, STREAM_WINDOW_SIZE);
+}
+
+static void elf_stream_deinit(ELFFile* elf, ELFStream* stream) {
+    if(stream->fd) {
+        free(stream->buffer);
+        elf_memory_remove(elf, STREAM_WINDOW_SIZE);
+    }
+}
+
+static bool elf_stream_read(ELFStream* stream, void* data, size_t size) {
+    uint8_t* out = data;
+
+    while(size) {
+        if(stream->position == stream->length) {
+            if(stream->file_remaining == 0) return false;
+
+            // File position is shared with symbol reads, always seek
+            size_t window = MIN(stream->file_remaining, (size_t)STREAM_WINDOW_SIZE);
+            if(!storage_file_seek(stream->fd, stream->file_offset, true) ||
+               storage_file_read(stream->fd, stream->buffer, window) != window) {
+                return false;
+            }
+            stream->file_offset += window;
+            stream->file_remaining -= window;
+            stream->length = window;
+            stream->position = 0;
+        }
+
+        size_t chunk = MIN(size, stream->length - stream->position);
+        memcpy(out, &stream->buffer[stream->position], chunk);
+        stream->position += chunk;
+        out += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+/**************************************************************************************************/
+/************************************** Relocation snapshot ***************************************/
+/**************************************************************************************************/
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t api_hash;
+    uint32_t checksum;
+    uint32_t count;
+} FURI_PACKED ELFRelocationSnapshotHeader;
+
+static ELFSection* elf_section_of(ELFFile* elf, int index);
+static bool elf_read_section(
+    ELFFile* elf,
+    size_t section_idx,
+    Elf32_Shdr* section_header,
+    FuriString* name);
+
+static bool elf_relocation_snapshot_is_recording(ELFFile* elf) {
+    return elf->snapshot_path && !elf->snapshot_is_loaded;
+}
+
+static void elf_relocation_snapshot_put(
+    ELFFile* elf,
+    ELFRelocationSnapshotEntryType type,
+    uint32_t key,
+    uint16_t shndx,
+    Elf32_Addr value) {
+    ELFRelocationSnapshotEntry entry = {
+        .type = type,
+        .shndx = shndx,
+        .key = key,
+        .value = value,
+    };
+    ELFRelocationSnapshot_push_back(elf->snapshot, entry);
+}
+
+/* Snapshot entries are keyed by symbol index and name hash, so section sizes are not enough:
+ * symbols, their names and relocations may change while every size stays the same */
+static bool elf_relocation_snapshot_is_checksummed(const Elf32_Shdr* header, FuriString* name) {
+    return header->sh_type == SHT_SYMTAB || header->sh_type == SHT_STRTAB ||
+           header->sh_type == SHT_REL || header->sh_type == SHT_RELA ||
+           furi_string_start_with_str(name, ".fast.rel");
+}
+
+static bool elf_relocation_snapshot_checksum_data(
+    ELFFile* elf,
+    const Elf32_Shdr* header,
+    uint8_t* buffer,
+    uint32_t* checksum) {
+    if(!storage_file_seek(elf->fd, header->sh_offset, true)) return false;
+
+    size_t remaining = header->sh_size;
+    while(remaining) {
+        const size_t size = MIN(remaining, (size_t)STREAM_WINDOW_SIZE);
+        if(storage_file_read(elf->fd, buffer, size) != size) return false;
+        *checksum = crc32_calc_buffer(*checksum, buffer, size);
+        remaining -= size;
+    }
+
+    return true;
+}
+
+/* ELF header, section table, symbol, string and relocation tables: everything snapshot
+ * entries depend on. Code and data are relocated on every load and are not included. */
+static bool elf_relocation_snapshot_checksum(ELFFile* elf, uint32_t* checksum) {
+    Elf32_Ehdr header;
+    if(!storage_file_seek(elf->fd, 0, true) ||
+       storage_file_read(elf->fd, &header, sizeof(header)) != sizeof(header) ||
+       header.e_shnum == 0) {
+        return false;
+    }
+
+    *checksum = crc32_calc_buffer(0, &header, sizeof(header));
+
+    uint8_t* buffer = malloc(STREAM_WINDOW_SIZE);
+    FuriString* name = furi_string_alloc();
+    bool result = true;
+    for(size_t section_idx = 0; section_idx < header.e_shnum && result; section_idx++) {
+        Elf32_Shdr section_header;
+        furi_string_reset(name);
+        result = elf_read_section(elf, section_idx, &section_header, name);
+        if(!result) break;
+
+        *checksum = crc32_calc_buffer(*checksum, &section_header, sizeof(section_header));
+        if(elf_relocation_snapshot_is_checksummed(&section_header, name)) {
+            result = elf_relocation_snapshot_checksum_data(elf, &section_header, buffer, checksum);
+        }
+    }
+    furi_string_free(name);
+    free(buffer);
+
+    return result;
+}
+
+static bool elf_relocation_snapshot_apply(
+    ELFFile* elf,
+    const ELFRelocationSnapshotEntry* entries,
+    size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        const ELFRelocationSnapshotEntry* entry = &entries[i];
+        Elf32_Addr address = entry->value;
+        if(entry->shndx != SHN_UNDEF) {
+            ELFSection* section = elf_section_of(elf, entry->shndx);
+            if(!section || !section->data) return false;
+            address += (Elf32_Addr)section->data;
+        }
+
+        if(entry->type == ELFRelocationSnapshotEntryTypeSymbol) {
+            address_cache_put(elf->relocation_cache, entry->key, address);
+        } else if(entry->type == ELFRelocationSnapshotEntryTypeImport) {
+            address_cache_put(elf->import_cache, entry->key, address);
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool elf_relocation_snapshot_load(ELFFile* elf) {
+    File* file = storage_file_alloc(elf->storage);
+    bool result = false;
+
+    do {
+        if(!storage_file_open(
+               file, furi_string_get_cstr(elf->snapshot_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        ELFRelocationSnapshotHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != RELOCATION_SNAPSHOT_MAGIC ||
+           header.version != RELOCATION_SNAPSHOT_VERSION ||
+           header.api_hash != elf->snapshot_api_hash ||
+           header.checksum != elf->snapshot_checksum ||
+           header.count > RELOCATION_SNAPSHOT_MAX_ENTRIES) {
+            FURI_LOG_D(TAG, "Relocation snapshot is stale");
+            break;
+        }
+
+        size_t size = header.count * sizeof(ELFRelocationSnapshotEntry);
+        ELFRelocationSnapshotEntry* entries = malloc(size);
+        if(storage_file_read(file, entries, size) == size) {
+            result = elf_relocation_snapshot_apply(elf, entries, header.count);
+        }
+        free(entries);
+    } while(false);
+
+    storage_file_free(file);
+
+    if(!result) {
+        AddressCache_reset(elf->relocation_cache);
+        AddressCache_reset(elf->import_cache);
+    }
+
+    return result;
+}
+
+static void elf_relocation_snapshot_save(ELFFile* elf) {
+    ELFRelocationSnapshotHeader header = {
+        .magic = RELOCATION_SNAPSHOT_MAGIC,
+        .version = RELOCATION_SNAPSHOT_VERSION,
+        .api_hash = elf->snapshot_api_hash,
+        .checksum = elf->snapshot_checksum,
+        .count = ELFRelocationSnapshot_size(elf->snapshot),
+    };
+    if(header.count > RELOCATION_SNAPSHOT_MAX_ENTRIES) return;
+
+    File* file = storage_file_alloc(elf->storage);
+    const char* path = furi_string_get_cstr(elf->snapshot_path);
+    bool result = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  storage_file_write(file, &header, sizeof(header)) == sizeof(header);
+    if(result && header.count) {
+        size_t size = header.count * sizeof(ELFRelocationSnapshotEntry);
+        result = storage_file_write(file, ELFRelocationSnapshot_cget(elf->snapshot, 0), size) ==
+                 size;
+    }
+    storage_file_free(file);
+
+    if(!result) {
+        FURI_LOG_W(TAG, "Failed to save relocation snapshot");
+    }
+}
+
 /**************************************************************************************************/
 /********************************************** ELF ***********************************************/
 /**************************************************************************************************/
@@ -80,6 +363,11 @@ static ELFSection* elf_file_get_or_put_section(ELFFile* elf, const char* name) {
                 .data = NULL,
                 .sec_idx = 0,
                 .size = 0,
+                .data_is_aligned = false,
+                .data_offset = 0,
+                .data_align = 0,
+                .fast_rel_offset = 0,
+                .fast_rel_size = 0,
                 .rel_count = 0,
                 .rel_offset = 0,
                 .fast_rel = NULL,
@@ -184,6 +472,8 @@ static Elf32_Addr elf_address_of(ELFFile* elf, Elf32_Sym* sym, const char* sName
         if(elf->api_interface->resolver_callback(elf->api_interface, hash, &addr)) {
             return addr;
         }
+    } else if(sym->st_shndx == SHN_ABS) {
+        return sym->st_value;
     } else {
         ELFSection* symSec = elf_section_of(elf, sym->st_shndx);
         if(symSec) {
@@ -263,6 +553,7 @@ static void elf_relocate_jmp_call(ELFFile* elf, Elf32_Addr relAddr, int type, El
             Elf32_Addr addr;
             if(!address_cache_get(elf->trampoline_cache, symAddr, &addr)) {
                 addr = (Elf32_Addr)elf_create_trampoline(symAddr);
+                elf_memory_add(elf, sizeof(JMPTrampoline));
                 address_cache_put(elf->trampoline_cache, symAddr, addr);
             }
 
@@ -356,7 +647,8 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
         Elf32_Rel rel;
         size_t relEntries = s->rel_count;
         size_t relCount;
-        (void)storage_file_seek(elf->fd, s->rel_offset, true);
+        ELFStream stream;
+        elf_stream_init_file(elf, &stream, s->rel_offset, relEntries * sizeof(Elf32_Rel));
         FURI_LOG_D(TAG, " Offset   Info     Type             Name");
 
         int relocate_result = true;
@@ -369,9 +661,10 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                 furi_delay_tick(1);
             }
 
-            if(storage_file_read(elf->fd, &rel, sizeof(Elf32_Rel)) != sizeof(Elf32_Rel)) {
+            if(!elf_stream_read(&stream, &rel, sizeof(Elf32_Rel))) {
                 FURI_LOG_E(TAG, "  reloc read fail");
                 furi_string_free(symbol_name);
+                elf_stream_deinit(elf, &stream);
                 return false;
             }
 
@@ -387,6 +680,7 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                 if(!elf_read_symbol(elf, symEntry, &sym, symbol_name)) {
                     FURI_LOG_E(TAG, "  symbol read fail");
                     furi_string_free(symbol_name);
+                    elf_stream_deinit(elf, &stream);
                     return false;
                 }
 
@@ -400,6 +694,18 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
 
                 symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
                 address_cache_put(elf->relocation_cache, symEntry, symAddr);
+
+                if(elf_relocation_snapshot_is_recording(elf) && symAddr != ELF_INVALID_ADDRESS) {
+                    // Reserved indexes like SHN_ABS have no section to add on apply
+                    bool is_relative = sym.st_shndx != SHN_UNDEF &&
+                                       sym.st_shndx < SHN_LORESERVE;
+                    elf_relocation_snapshot_put(
+                        elf,
+                        ELFRelocationSnapshotEntryTypeSymbol,
+                        symEntry,
+                        is_relative ? sym.st_shndx : SHN_UNDEF,
+                        is_relative ? sym.st_value : symAddr);
+                }
             }
 
             if(symAddr != ELF_INVALID_ADDRESS) {
@@ -417,6 +723,7 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
             }
         }
         furi_string_free(symbol_name);
+        elf_stream_deinit(elf, &stream);
 
         return relocate_result;
     } else {
@@ -445,6 +752,7 @@ typedef enum {
 static bool elf_load_debug_link(ELFFile* elf, Elf32_Shdr* section_header) {
     elf->debug_link_info.debug_link_size = section_header->sh_size;
     elf->debug_link_info.debug_link = malloc(section_header->sh_size);
+    elf_memory_add(elf, section_header->sh_size);
 
     return storage_file_seek(elf->fd, section_header->sh_offset, true) &&
            storage_file_read(elf->fd, elf->debug_link_info.debug_link, section_header->sh_size) ==
@@ -463,6 +771,10 @@ static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr*
 
     section->data = aligned_malloc(section_header->sh_size, section_header->sh_addralign);
     section->size = section_header->sh_size;
+    section->data_align = section_header->sh_addralign;
+    section->data_is_aligned = true;
+    elf_memory_add(
+        elf, elf_aligned_malloc_size(section_header->sh_size, section_header->sh_addralign));
 
     if(section_header->sh_type == SHT_NOBITS) {
         // BSS section, no data to load
@@ -480,6 +792,42 @@ static bool elf_load_section_data(ELFFile* elf, ELFSection* section, Elf32_Shdr*
     return true;
 }
 
+/* Streaming: remember where data is, it is allocated and read by elf_file_load_sections */
+static void elf_defer_section_data(ELFSection* section, Elf32_Shdr* section_header) {
+    section->size = section_header->sh_size;
+    section->data_align = section_header->sh_addralign;
+    section->data_offset = (section_header->sh_type == SHT_NOBITS) ? 0 :
+                                                                     section_header->sh_offset;
+}
+
+static bool elf_alloc_section_data(ELFFile* elf, ELFSection* section) {
+    // Exact size, alignment overhead only when heap alignment is not enough
+    section->data_is_aligned = section->data_align > HEAP_ALIGNMENT;
+    size_t size = section->data_is_aligned ?
+                      elf_aligned_malloc_size(section->size, section->data_align) :
+                      section->size;
+
+    // Fail instead of crashing on fragmented heap, header takes one more aligned unit
+    if(memmgr_heap_get_max_free_block() < size + HEAP_ALIGNMENT) {
+        return false;
+    }
+
+    section->data = section->data_is_aligned ?
+                        aligned_malloc(section->size, section->data_align) :
+                        malloc(section->size);
+    elf_memory_add(elf, size);
+    return true;
+}
+
+static bool elf_read_section_data(ELFFile* elf, ELFSection* section) {
+    if(section->data_offset == 0) {
+        return true;
+    }
+
+    return storage_file_seek(elf->fd, section->data_offset, true) &&
+           storage_file_read(elf->fd, section->data, section->size) == section->size;
+}
+
 static SectionType elf_preload_section(
     ELFFile* elf,
     size_t section_idx,
@@ -541,7 +889,10 @@ static SectionType elf_preload_section(
             elf->fini_array = section_p;
         }
 
-        if(!elf_load_section_data(elf, section_p, section_header)) {
+        if(elf->streaming) {
+            elf_defer_section_data(section_p, section_header);
+            return SectionTypeData;
+        } else if(!elf_load_section_data(elf, section_p, section_header)) {
             FURI_LOG_E(TAG, "Error loading section '%s'", name);
             return SectionTypeERROR;
         } else {
@@ -567,6 +918,12 @@ static SectionType elf_preload_section(
     if(str_prefix(name, ".fast.rel")) {
         name = name + strlen(".fast.rel");
         ELFSection* section_p = elf_file_get_or_put_section(elf, name);
+        if(elf->streaming) {
+            section_p->fast_rel_offset = section_header->sh_offset;
+            section_p->fast_rel_size = section_header->sh_size;
+            return SectionTypeFastRelData;
+        }
+
         section_p->fast_rel = malloc(sizeof(ELFSection));
 
         if(!elf_load_section_data(elf, section_p->fast_rel, section_header)) {
@@ -608,7 +965,15 @@ static SectionType elf_preload_section(
 
 static Elf32_Addr elf_address_of_by_hash(ELFFile* elf, uint32_t hash) {
     Elf32_Addr addr = 0;
+    if(address_cache_get(elf->import_cache, hash, &addr)) {
+        return addr;
+    }
     if(elf->api_interface->resolver_callback(elf->api_interface, hash, &addr)) {
+        address_cache_put(elf->import_cache, hash, addr);
+        if(elf_relocation_snapshot_is_recording(elf)) {
+            elf_relocation_snapshot_put(
+                elf, ELFRelocationSnapshotEntryTypeImport, hash, SHN_UNDEF, addr);
+        }
         return addr;
     }
     return ELF_INVALID_ADDRESS;
@@ -635,36 +1000,46 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
 }
 
 static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
-    UNUSED(elf);
-    const uint8_t* start = s->fast_rel->data;
-    const uint8_t version = *start;
+    ELFStream stream;
+    if(s->fast_rel) {
+        elf_stream_init_memory(&stream, s->fast_rel->data, s->fast_rel->size);
+    } else {
+        elf_stream_init_file(elf, &stream, s->fast_rel_offset, s->fast_rel_size);
+    }
+
+    uint8_t version = 0;
+    uint32_t records_count = 0;
     bool no_errors = true;
+    bool is_truncated = !elf_stream_read(&stream, &version, sizeof(version)) ||
+                        !elf_stream_read(&stream, &records_count, sizeof(records_count));
 
-    if(version != FAST_RELOCATION_VERSION) {
+    if(!is_truncated && version != FAST_RELOCATION_VERSION) {
         FURI_LOG_E(TAG, "Unsupported fast relocation version %d", version);
-        return false;
+        no_errors = false;
+        records_count = 0;
     }
-    start += 1;
-
-    const uint32_t records_count = *((uint32_t*)start);
-    start += 4;
     FURI_LOG_D(TAG, "Fast relocation records count: %ld", records_count);
 
-    for(uint32_t i = 0; i < records_count; i++) {
-        bool is_section = (*start & (0x1 << 7)) ? true : false;
-        uint8_t type = *start & 0x7F;
-        start += 1;
-        uint32_t hash_or_section_index = *((uint32_t*)start);
-        start += 4;
-
+    for(uint32_t i = 0; i < records_count && !is_truncated; i++) {
+        uint8_t flags = 0;
+        uint32_t hash_or_section_index = 0;
         uint32_t section_value = ELF_INVALID_ADDRESS;
-        if(is_section) {
-            section_value = *((uint32_t*)start);
-            start += 4;
+        uint32_t offsets_count = 0;
+
+        if(!elf_stream_read(&stream, &flags, sizeof(flags)) ||
+           !elf_stream_read(&stream, &hash_or_section_index, sizeof(hash_or_section_index))) {
+            is_truncated = true;
+            break;
         }
 
-        const uint32_t offsets_count = *((uint32_t*)start);
-        start += 4;
+        bool is_section = (flags & (0x1 << 7)) ? true : false;
+        uint8_t type = flags & 0x7F;
+
+        if((is_section && !elf_stream_read(&stream, &section_value, sizeof(section_value))) ||
+           !elf_stream_read(&stream, &offsets_count, sizeof(offsets_count))) {
+            is_truncated = true;
+            break;
+        }
 
         FURI_LOG_D(
             TAG,
@@ -700,28 +1075,48 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
                     hash_or_section_index);
             }
             furi_string_free(symbol_name);
+        }
 
-            no_errors = false;
-            start += 3 * offsets_count;
-        } else {
-            for(uint32_t j = 0; j < offsets_count; j++) {
-                uint32_t offset = *((uint32_t*)start) & 0x00FFFFFF;
-                start += 3;
+        // Offsets are 24 bit, skipped ones still have to be read
+        for(uint32_t j = 0; j < offsets_count; j++) {
+            uint32_t offset = 0;
+            if(!elf_stream_read(&stream, &offset, 3)) {
+                is_truncated = true;
+                break;
+            }
+            if(address != ELF_INVALID_ADDRESS) {
                 Elf32_Addr relAddr = ((Elf32_Addr)s->data) + offset;
                 elf_relocate_symbol(elf, relAddr, type, address);
             }
         }
+
+        if(address == ELF_INVALID_ADDRESS) {
+            no_errors = false;
+        }
+    }
+
+    if(is_truncated) {
+        FURI_LOG_E(TAG, "Fast relocation data read fail");
+        no_errors = false;
     }
 
-    aligned_free(s->fast_rel->data);
-    free(s->fast_rel);
-    s->fast_rel = NULL;
+    elf_stream_deinit(elf, &stream);
+
+    if(s->fast_rel) {
+        if(s->fast_rel->data) {
+            elf_memory_remove(
+                elf, elf_aligned_malloc_size(s->fast_rel->size, s->fast_rel->data_align));
+            aligned_free(s->fast_rel->data);
+        }
+        free(s->fast_rel);
+        s->fast_rel = NULL;
+    }
 
     return no_errors;
 }
 
 static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
-    if(section->fast_rel) {
+    if(section->fast_rel || section->fast_rel_size) {
         FURI_LOG_D(TAG, "Fast relocating section");
         return elf_relocate_fast(elf, section);
     } else if(section->rel_count) {
@@ -758,11 +1153,17 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
 
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
+    elf->storage = storage;
     elf->fd = storage_file_alloc(storage);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
     AddressCache_init(elf->trampoline_cache);
+    elf->snapshot_path = NULL;
+    ELFRelocationSnapshot_init(elf->snapshot);
     elf->init_array_called = false;
+    elf->streaming = false;
+    elf->memory_used = 0;
+    elf->memory_peak = 0;
     return elf;
 }
 
@@ -780,7 +1181,11 @@ void elf_file_free(ELFFile* elf) {
             ELFSectionDict_next(it)) {
             const ELFSectionDict_itref_t* itref = ELFSectionDict_cref(it);
             if(itref->value.data) {
-                aligned_free(itref->value.data);
+                if(itref->value.data_is_aligned) {
+                    aligned_free(itref->value.data);
+                } else {
+                    free(itref->value.data);
+                }
             }
             if(itref->value.fast_rel) {
                 aligned_free(itref->value.fast_rel->data);
@@ -808,6 +1213,11 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    if(elf->snapshot_path) {
+        furi_string_free(elf->snapshot_path);
+    }
+    ELFRelocationSnapshot_clear(elf->snapshot);
+
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -831,6 +1241,32 @@ bool elf_file_open(ELFFile* elf, const char* path) {
     return true;
 }
 
+void elf_file_set_relocation_snapshot(ELFFile* elf, const char* path, uint32_t api_hash) {
+    furi_check(elf->fd != NULL);
+
+    if(!elf_relocation_snapshot_checksum(elf, &elf->snapshot_checksum)) {
+        FURI_LOG_W(TAG, "Can't checksum ELF, relocation snapshot disabled");
+        return;
+    }
+
+    if(elf->snapshot_path) {
+        furi_string_set(elf->snapshot_path, path);
+    } else {
+        elf->snapshot_path = furi_string_alloc_set(path);
+    }
+    elf->snapshot_api_hash = api_hash;
+    elf->snapshot_is_loaded = false;
+}
+
+void elf_file_set_streaming(ELFFile* elf, bool enable) {
+    furi_check(ELFSectionDict_size(elf->sections) == 0);
+    elf->streaming = enable;
+}
+
+size_t elf_file_get_memory_peak(ELFFile* elf) {
+    return elf->memory_peak;
+}
+
 bool elf_file_load_section_table(ELFFile* elf) {
     SectionType loaded_sections = SectionTypeERROR;
     FuriString* name = furi_string_alloc();
@@ -900,13 +1336,44 @@ ElfProcessSectionResult elf_process_section(
 
 ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     furi_check(elf->fd != NULL);
+    trace_begin(TraceProbeElfLoadSections);
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
     ELFSectionDict_it_t it;
 
     AddressCache_init(elf->relocation_cache);
+    AddressCache_init(elf->import_cache);
 
-    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+    // Streaming: all sections must have addresses before any of them is relocated
+    if(elf->streaming) {
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+            if(itref->value.size && !elf_alloc_section_data(elf, &itref->value)) {
+                FURI_LOG_E(
+                    TAG, "No memory for section '%s', %lu bytes", itref->key, itref->value.size);
+                status = ELFFileLoadStatusNoFreeMemory;
+                break;
+            }
+        }
+    }
+
+    if(status == ELFFileLoadStatusSuccess && elf->snapshot_path) {
+        elf->snapshot_is_loaded = elf_relocation_snapshot_load(elf);
+        FURI_LOG_I(
+            TAG,
+            "Relocation snapshot %s",
+            elf->snapshot_is_loaded ? "loaded" : "not found, recording");
+    }
+
+    for(ELFSectionDict_it(it, elf->sections);
+        status != ELFFileLoadStatusNoFreeMemory && !ELFSectionDict_end_p(it);
+        ELFSectionDict_next(it)) {
         ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+        if(elf->streaming && !elf_read_section_data(elf, &itref->value)) {
+            FURI_LOG_E(TAG, "Error loading section '%s'", itref->key);
+            status = ELFFileLoadStatusUnspecifiedError;
+            continue;
+        }
         FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
         if(!elf_relocate_section(elf, &itref->value)) {
             FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
@@ -926,9 +1393,15 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
         }
     }
 
+    if(status == ELFFileLoadStatusSuccess && elf_relocation_snapshot_is_recording(elf)) {
+        elf_relocation_snapshot_save(elf);
+    }
+
     FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
     AddressCache_clear(elf->relocation_cache);
+    AddressCache_clear(elf->import_cache);
+    ELFRelocationSnapshot_reset(elf->snapshot);
 
     {
         size_t total_size = 0;
@@ -941,6 +1414,7 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     }
 
     elf_file_maybe_release_fd(elf);
+    trace_end(TraceProbeElfLoadSections);
     return status;
 }
 
@@ -74,6 +74,34 @@ bool elf_file_open(ELFFile* elf_file, const char* path);
  */
 bool elf_file_load_section_table(ELFFile* elf_file);
 
+/**
+ * @brief Enable relocation snapshot for ELF file
+ * Symbols resolved on first load are saved to the snapshot file, next loads
+ * take them from there and skip symbol resolution. Snapshot is discarded when
+ * ELF file or API table changes.
+ * @param elf_file 
+ * @param path snapshot file path
+ * @param api_hash hash of API table contents, identifies resolved addresses
+ */
+void elf_file_set_relocation_snapshot(ELFFile* elf_file, const char* path, uint32_t api_hash);
+
+/**
+ * @brief Enable streaming load, must be called before elf_file_load_section_table.
+ * Section data is allocated and read by elf_file_load_sections, one section at a time,
+ * and relocations are read from file in small windows instead of being kept in memory.
+ * Not enough memory for a section is reported as ELFFileLoadStatusNoFreeMemory.
+ * @param elf_file 
+ * @param enable 
+ */
+void elf_file_set_streaming(ELFFile* elf_file, bool enable);
+
+/**
+ * @brief Get peak memory allocated by loader for ELF file so far
+ * @param elf_file 
+ * @return size_t bytes
+ */
+size_t elf_file_get_memory_peak(ELFFile* elf_file);
+
 /**
  * @brief Load and relocate ELF file sections (load stage #2)
  * @param elf_file 
@@ -1,6 +1,7 @@
 #pragma once
 #include "elf_file.h"
 #include <m-dict.h>
+#include <m-array.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,6 +19,13 @@ typedef struct ELFSection ELFSection;
 struct ELFSection {
     void* data;
     Elf32_Word size;
+    bool data_is_aligned; /**< data is allocated with aligned_malloc */
+
+    /* Streaming load: data and fast relocations stay in file until relocation */
+    Elf32_Off data_offset; /**< 0 if there is nothing to read, e.g. .bss */
+    Elf32_Word data_align;
+    Elf32_Off fast_rel_offset;
+    Elf32_Word fast_rel_size;
 
     size_t rel_count;
     Elf32_Off rel_offset;
@@ -28,6 +36,23 @@ struct ELFSection {
 
 DICT_DEF2(ELFSectionDict, const char*, M_CSTR_OPLIST, ELFSection, M_POD_OPLIST)
 
+typedef enum {
+    ELFRelocationSnapshotEntryTypeSymbol, /**< key is symbol table index */
+    ELFRelocationSnapshotEntryTypeImport, /**< key is symbol name hash */
+} ELFRelocationSnapshotEntryType;
+
+/**
+ * Resolved symbol, section relative: section addresses change from launch to launch
+ */
+typedef struct {
+    uint8_t type;
+    uint16_t shndx; /**< section index, SHN_UNDEF for absolute address */
+    uint32_t key;
+    Elf32_Addr value; /**< offset in section or absolute address */
+} FURI_PACKED ELFRelocationSnapshotEntry;
+
+ARRAY_DEF(ELFRelocationSnapshot, ELFRelocationSnapshotEntry, M_POD_OPLIST)
+
 struct ELFFile {
     size_t sections_count;
     off_t section_table;
@@ -41,7 +66,15 @@ struct ELFFile {
 
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
+    AddressCache_t import_cache;
 
+    FuriString* snapshot_path;
+    uint32_t snapshot_api_hash;
+    uint32_t snapshot_checksum;
+    bool snapshot_is_loaded;
+    ELFRelocationSnapshot_t snapshot;
+
+    Storage* storage;
     File* fd;
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
@@ -51,6 +84,10 @@ struct ELFFile {
     ELFSection* fini_array;
 
     bool init_array_called;
+
+    bool streaming;
+    size_t memory_used;
+    size_t memory_peak;
 };
 
 #ifdef __cplusplus
@@ -4,6 +4,7 @@
 #include "application_assets.h"
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage_processing.h>
+#include <toolbox/path.h>
 
 #include <m-list.h>
 
@@ -15,6 +16,9 @@ struct FlipperApplication {
     ELFFile* elf;
     FuriThread* thread;
     void* ep_thread_args;
+    bool relocation_snapshot;
+    uint32_t load_time_read;
+    uint32_t load_time_relocate;
 };
 
 /********************** Debugger access to loader state **********************/
@@ -57,9 +61,22 @@ FlipperApplication*
     app->elf = elf_file_alloc(storage, api_interface);
     app->thread = NULL;
     app->ep_thread_args = NULL;
+    app->relocation_snapshot = false;
+    app->load_time_read = 0;
+    app->load_time_relocate = 0;
     return app;
 }
 
+void flipper_application_set_relocation_snapshot(FlipperApplication* app, bool enable) {
+    furi_assert(app);
+    app->relocation_snapshot = enable;
+}
+
+void flipper_application_set_streaming_load(FlipperApplication* app, bool enable) {
+    furi_assert(app);
+    elf_file_set_streaming(app->elf, enable);
+}
+
 bool flipper_application_is_plugin(FlipperApplication* app) {
     return app->manifest.stack_size == 0;
 }
@@ -82,6 +99,8 @@ void flipper_application_free(FlipperApplication* app) {
         elf_file_call_fini(app->elf);
     }
 
+    // Queued log records may point to application strings
+    furi_log_flush();
     elf_file_free(app->elf);
 
     if(app->ep_thread_args) {
@@ -148,14 +167,41 @@ static bool flipper_application_process_assets_section(
     return flipper_application_assets_load(file, preload_context->path, offset, size);
 }
 
+static void
+    flipper_application_enable_relocation_snapshot(FlipperApplication* app, const char* path) {
+    // Plugins may resolve symbols from host application heap, only firmware API is fixed
+    if(elf_file_get_api_interface(app->elf) != firmware_api_interface) {
+        return;
+    }
+
+    // Hidden file next to the application: .name.fap.reloc
+    FuriString* snapshot_path = furi_string_alloc();
+    FuriString* name = furi_string_alloc();
+    path_extract_dirname(path, snapshot_path);
+    path_extract_basename(path, name);
+    furi_string_cat_printf(snapshot_path, "/.%s.reloc", furi_string_get_cstr(name));
+
+    elf_file_set_relocation_snapshot(
+        app->elf, furi_string_get_cstr(snapshot_path), firmware_api_get_table_hash());
+
+    furi_string_free(name);
+    furi_string_free(snapshot_path);
+}
+
 static FlipperApplicationPreloadStatus
     flipper_application_load(FlipperApplication* app, const char* path, bool load_full) {
+    uint32_t start = furi_get_tick();
+
     if(!elf_file_open(app->elf, path)) {
         return FlipperApplicationPreloadStatusInvalidFile;
     }
 
     // if we are loading full file
     if(load_full) {
+        if(app->relocation_snapshot) {
+            flipper_application_enable_relocation_snapshot(app, path);
+        }
+
         // load section table
         if(!elf_file_load_section_table(app->elf)) {
             return FlipperApplicationPreloadStatusInvalidFile;
@@ -179,6 +225,8 @@ static FlipperApplicationPreloadStatus
         return FlipperApplicationPreloadStatusInvalidFile;
     }
 
+    app->load_time_read = furi_get_tick() - start;
+
     return flipper_application_validate_manifest(app);
 }
 
@@ -199,7 +247,16 @@ const FlipperApplicationManifest* flipper_application_get_manifest(FlipperApplic
 }
 
 FlipperApplicationLoadStatus flipper_application_map_to_memory(FlipperApplication* app) {
+    uint32_t start = furi_get_tick();
     ELFFileLoadStatus status = elf_file_load_sections(app->elf);
+    app->load_time_relocate = furi_get_tick() - start;
+
+    FURI_LOG_I(
+        TAG,
+        "%s: peak load memory %zu bytes, free heap %zu",
+        app->manifest.name,
+        elf_file_get_memory_peak(app->elf),
+        memmgr_get_free_heap());
 
     switch(status) {
     case ELFFileLoadStatusSuccess:
@@ -215,11 +272,24 @@ FlipperApplicationLoadStatus flipper_application_map_to_memory(FlipperApplicatio
     }
 }
 
+static void flipper_application_call_init(FlipperApplication* app) {
+    uint32_t start = furi_get_tick();
+    elf_file_call_init(app->elf);
+
+    FURI_LOG_I(
+        TAG,
+        "%s: read %lums, relocate %lums, init %lums",
+        app->manifest.name,
+        app->load_time_read,
+        app->load_time_relocate,
+        furi_get_tick() - start);
+}
+
 static int32_t flipper_application_thread(void* context) {
     furi_assert(context);
     FlipperApplication* app = (FlipperApplication*)context;
 
-    elf_file_call_init(app->elf);
+    flipper_application_call_init(app);
 
     FlipperApplicationEntryPoint entry_point = elf_file_get_entry_point(app->elf);
     int32_t ret_code = entry_point(app->ep_thread_args);
@@ -299,7 +369,7 @@ const FlipperAppPluginDescriptor*
     }
 
     if(!elf_file_is_init_complete(app->elf)) {
-        elf_file_call_init(app->elf);
+        flipper_application_call_init(app);
     }
 
     typedef const FlipperAppPluginDescriptor* (*get_lib_descriptor_t)(void);
@@ -317,44 +387,46 @@ const FlipperAppPluginDescriptor*
     return lib_descriptor;
 }
 
-bool flipper_application_load_name_and_icon(
+bool flipper_application_load_manifest(
     FuriString* path,
     Storage* storage,
-    uint8_t** icon_ptr,
-    FuriString* item_name) {
-    bool load_success = true;
-
+    FlipperApplicationManifest* manifest) {
     StorageData* storage_data;
     if(storage_get_data(storage, path, &storage_data) == FSE_OK &&
        storage_path_already_open(path, storage_data)) {
-        load_success = false;
+        return false;
     }
 
-    if(load_success) {
-        load_success = false;
-
-        FlipperApplication* app = flipper_application_alloc(storage, firmware_api_interface);
-
-        FlipperApplicationPreloadStatus preload_res =
-            flipper_application_preload_manifest(app, furi_string_get_cstr(path));
+    bool load_success = false;
+    FlipperApplication* app = flipper_application_alloc(storage, firmware_api_interface);
 
-        if(preload_res == FlipperApplicationPreloadStatusSuccess ||
-           preload_res == FlipperApplicationPreloadStatusApiTooOld ||
-           preload_res == FlipperApplicationPreloadStatusApiTooNew) {
-            const FlipperApplicationManifest* manifest = flipper_application_get_manifest(app);
-            if(manifest->has_icon && icon_ptr != NULL && *icon_ptr != NULL) {
-                memcpy(*icon_ptr, manifest->icon, FAP_MANIFEST_MAX_ICON_SIZE);
-            }
-            furi_string_set(item_name, manifest->name);
-            load_success = true;
-        } else {
-            FURI_LOG_E(TAG, "Failed to preload %s", furi_string_get_cstr(path));
-        }
+    FlipperApplicationPreloadStatus preload_res =
+        flipper_application_preload_manifest(app, furi_string_get_cstr(path));
 
-        flipper_application_free(app);
+    if(preload_res == FlipperApplicationPreloadStatusSuccess ||
+       preload_res == FlipperApplicationPreloadStatusApiTooOld ||
+       preload_res == FlipperApplicationPreloadStatusApiTooNew) {
+        *manifest = *flipper_application_get_manifest(app);
+        load_success = true;
+    } else {
+        FURI_LOG_E(TAG, "Failed to preload %s", furi_string_get_cstr(path));
     }
 
-    if(!load_success) {
+    flipper_application_free(app);
+    return load_success;
+}
+
+void flipper_application_fill_name_and_icon(
+    const FlipperApplicationManifest* manifest,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name) {
+    if(manifest) {
+        if(manifest->has_icon && icon_ptr != NULL && *icon_ptr != NULL) {
+            memcpy(*icon_ptr, manifest->icon, FAP_MANIFEST_MAX_ICON_SIZE);
+        }
+        furi_string_set(item_name, manifest->name);
+    } else {
         size_t offset = furi_string_search_rchar(path, '/');
         if(offset != FURI_STRING_FAILURE) {
             furi_string_set_n(item_name, path, offset + 1, furi_string_size(path) - offset - 1);
@@ -362,6 +434,16 @@ bool flipper_application_load_name_and_icon(
             furi_string_set(item_name, path);
         }
     }
+}
 
+bool flipper_application_load_name_and_icon(
+    FuriString* path,
+    Storage* storage,
+    uint8_t** icon_ptr,
+    FuriString* item_name) {
+    FlipperApplicationManifest manifest;
+    bool load_success = flipper_application_load_manifest(path, storage, &manifest);
+    flipper_application_fill_name_and_icon(
+        load_success ? &manifest : NULL, path, icon_ptr, item_name);
     return load_success;
 }
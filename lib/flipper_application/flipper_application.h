@@ -76,6 +76,26 @@ FlipperApplication*
  */
 void flipper_application_free(FlipperApplication* app);
 
+/**
+ * @brief Enable relocation snapshot: symbols resolved on first launch are
+ * saved next to the application file and reused on next launches.
+ * Only applications using firmware API are affected.
+ * Must be called before flipper_application_preload.
+ * @param app Application pointer
+ * @param enable true to use relocation snapshot
+ */
+void flipper_application_set_relocation_snapshot(FlipperApplication* app, bool enable);
+
+/**
+ * @brief Enable streaming load: sections are allocated and relocated one at a
+ * time by flipper_application_map_to_memory, relocation data is never kept in memory.
+ * Lowers peak memory needed to load large applications.
+ * Must be called before flipper_application_preload.
+ * @param app Application pointer
+ * @param enable true to use streaming load
+ */
+void flipper_application_set_streaming_load(FlipperApplication* app, bool enable);
+
 /**
  * @brief Validate elf file and load application metadata 
  * @param app Application pointer
@@ -150,6 +170,35 @@ typedef const FlipperAppPluginDescriptor* (*FlipperApplicationPluginEntryPoint)(
 const FlipperAppPluginDescriptor*
     flipper_application_plugin_get_descriptor(FlipperApplication* app);
 
+/**
+ * @brief Load manifest from FAP file without loading the application.
+ * 
+ * Succeeds for applications built for other API versions too.
+ * 
+ * @param path Path to FAP file.
+ * @param storage Storage instance.
+ * @param manifest Manifest to fill.
+ * @return true if manifest was loaded successfully.
+ */
+bool flipper_application_load_manifest(
+    FuriString* path,
+    Storage* storage,
+    FlipperApplicationManifest* manifest);
+
+/**
+ * @brief Fill name and icon from loaded manifest.
+ * 
+ * @param manifest Manifest, or NULL to use file name from path.
+ * @param path Path to FAP file.
+ * @param icon_ptr Icon pointer.
+ * @param item_name Application name.
+ */
+void flipper_application_fill_name_and_icon(
+    const FlipperApplicationManifest* manifest,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name);
+
 /**
  * @brief Load name and icon from FAP file.
  * 
@@ -203,6 +203,17 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Enable key index. Offsets of all keys are collected on the first key lookup,
+ * later lookups jump to the line with the key instead of parsing every line before it.
+ * Useful for big files read out of order. Takes 8 bytes of RAM per key in the file,
+ * without enough memory lookups fall back to parsing. Index is rebuilt after writes.
+ * Not used in strict mode. Disabled by default.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param enabled True to enable, false to disable and free the index
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enabled);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
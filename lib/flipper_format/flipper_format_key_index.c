@@ -0,0 +1,223 @@
+#include <furi.h>
+#include <core/memmgr_heap.h>
+#include "flipper_format_key_index.h"
+#include "flipper_format_stream_i.h"
+
+#define TAG "FlipperFormatKeyIndex"
+
+#define FLIPPER_FORMAT_KEY_INDEX_INITIAL_CAPACITY (64)
+#define FLIPPER_FORMAT_KEY_INDEX_HEAP_RESERVE (8 * 1024)
+
+#define FLIPPER_FORMAT_KEY_INDEX_HASH_BASIS (2166136261UL)
+#define FLIPPER_FORMAT_KEY_INDEX_HASH_PRIME (16777619UL)
+
+typedef enum {
+    FlipperFormatKeyIndexStateEmpty,
+    FlipperFormatKeyIndexStateReady,
+    FlipperFormatKeyIndexStateUnavailable,
+} FlipperFormatKeyIndexState;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t line_start;
+} FlipperFormatKeyIndexEntry;
+
+struct FlipperFormatKeyIndex {
+    FlipperFormatKeyIndexState state;
+    FlipperFormatKeyIndexEntry* entries;
+    size_t count;
+    size_t capacity;
+    size_t stream_size;
+};
+
+static inline uint32_t flipper_format_key_index_hash_step(uint32_t hash, uint8_t data) {
+    return (hash ^ data) * FLIPPER_FORMAT_KEY_INDEX_HASH_PRIME;
+}
+
+static uint32_t flipper_format_key_index_hash(const char* key) {
+    uint32_t hash = FLIPPER_FORMAT_KEY_INDEX_HASH_BASIS;
+    while(*key) {
+        hash = flipper_format_key_index_hash_step(hash, *key++);
+    }
+    return hash;
+}
+
+static int flipper_format_key_index_entry_cmp(const void* a, const void* b) {
+    const FlipperFormatKeyIndexEntry* entry_a = a;
+    const FlipperFormatKeyIndexEntry* entry_b = b;
+
+    if(entry_a->hash != entry_b->hash) return entry_a->hash < entry_b->hash ? -1 : 1;
+    if(entry_a->line_start != entry_b->line_start) {
+        return entry_a->line_start < entry_b->line_start ? -1 : 1;
+    }
+    return 0;
+}
+
+static bool flipper_format_key_index_add(
+    FlipperFormatKeyIndex* key_index,
+    uint32_t hash,
+    size_t line_start) {
+    if(key_index->count == key_index->capacity) {
+        size_t capacity = key_index->capacity ? key_index->capacity * 2 :
+                                                FLIPPER_FORMAT_KEY_INDEX_INITIAL_CAPACITY;
+        size_t size = capacity * sizeof(FlipperFormatKeyIndexEntry);
+        if(size + FLIPPER_FORMAT_KEY_INDEX_HEAP_RESERVE > memmgr_heap_get_max_free_block()) {
+            FURI_LOG_W(TAG, "Not enough memory to index %zu keys", capacity);
+            return false;
+        }
+
+        key_index->entries = realloc(key_index->entries, size); //-V701
+        key_index->capacity = capacity;
+    }
+
+    key_index->entries[key_index->count].hash = hash;
+    key_index->entries[key_index->count].line_start = line_start;
+    key_index->count++;
+
+    return true;
+}
+
+static bool flipper_format_key_index_build(FlipperFormatKeyIndex* key_index, Stream* stream) {
+    const size_t buffer_size = 64;
+    uint8_t buffer[buffer_size];
+
+    size_t offset = 0;
+    size_t line_start = 0;
+    uint32_t hash = FLIPPER_FORMAT_KEY_INDEX_HASH_BASIS;
+    bool accumulate = true;
+    bool new_line = true;
+    bool error = false;
+
+    // Same rules as flipper_format_stream_read_valid_key, applied to the whole stream at once
+    while(!error) {
+        size_t was_read = stream_read(stream, buffer, buffer_size);
+        if(was_read == 0) break;
+
+        for(size_t i = 0; i < was_read; i++) {
+            uint8_t data = buffer[i];
+            if(data == flipper_format_eoln) {
+                line_start = offset + i + 1;
+                hash = FLIPPER_FORMAT_KEY_INDEX_HASH_BASIS;
+                accumulate = true;
+                new_line = true;
+            } else if(data == flipper_format_eolr) {
+                // ignore
+            } else if(data == flipper_format_comment && new_line) {
+                accumulate = false;
+                new_line = false;
+            } else if(data == flipper_format_delimiter) {
+                if(!new_line && accumulate) {
+                    if(!flipper_format_key_index_add(key_index, hash, line_start)) {
+                        error = true;
+                        break;
+                    }
+                }
+                // rest of the line is a value
+                accumulate = false;
+                new_line = false;
+            } else {
+                new_line = false;
+                if(accumulate) {
+                    hash = flipper_format_key_index_hash_step(hash, data);
+                }
+            }
+        }
+
+        offset += was_read;
+    }
+
+    if(!error && offset == key_index->stream_size) {
+        if(key_index->count) {
+            qsort(
+                key_index->entries,
+                key_index->count,
+                sizeof(FlipperFormatKeyIndexEntry),
+                flipper_format_key_index_entry_cmp);
+        }
+        FURI_LOG_D(TAG, "Indexed %zu keys", key_index->count);
+        return true;
+    }
+
+    return false;
+}
+
+FlipperFormatKeyIndex* flipper_format_key_index_alloc(void) {
+    FlipperFormatKeyIndex* key_index = malloc(sizeof(FlipperFormatKeyIndex));
+    key_index->state = FlipperFormatKeyIndexStateEmpty;
+    key_index->entries = NULL;
+    key_index->count = 0;
+    key_index->capacity = 0;
+    key_index->stream_size = 0;
+    return key_index;
+}
+
+void flipper_format_key_index_free(FlipperFormatKeyIndex* key_index) {
+    furi_assert(key_index);
+    flipper_format_key_index_reset(key_index);
+    free(key_index);
+}
+
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* key_index) {
+    furi_assert(key_index);
+    free(key_index->entries);
+    key_index->entries = NULL;
+    key_index->count = 0;
+    key_index->capacity = 0;
+    key_index->state = FlipperFormatKeyIndexStateEmpty;
+}
+
+bool flipper_format_key_index_seek(
+    FlipperFormatKeyIndex* key_index,
+    Stream* stream,
+    const char* key) {
+    furi_assert(key_index);
+    furi_assert(key);
+
+    size_t position = stream_tell(stream);
+    size_t size = stream_size(stream);
+
+    // Stream was changed behind our back
+    if(key_index->state == FlipperFormatKeyIndexStateReady && key_index->stream_size != size) {
+        flipper_format_key_index_reset(key_index);
+    }
+
+    if(key_index->state == FlipperFormatKeyIndexStateEmpty) {
+        flipper_format_key_index_reset(key_index);
+        key_index->stream_size = size;
+
+        bool built = stream_rewind(stream) && flipper_format_key_index_build(key_index, stream);
+        if(built) {
+            key_index->state = FlipperFormatKeyIndexStateReady;
+        } else {
+            flipper_format_key_index_reset(key_index);
+            key_index->state = FlipperFormatKeyIndexStateUnavailable;
+        }
+
+        if(!stream_seek(stream, position, StreamOffsetFromStart)) return false;
+    }
+
+    if(key_index->state != FlipperFormatKeyIndexStateReady) return false;
+
+    // First entry with this hash at or after the current position
+    const FlipperFormatKeyIndexEntry target = {
+        .hash = flipper_format_key_index_hash(key),
+        .line_start = position,
+    };
+    size_t low = 0;
+    size_t high = key_index->count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(flipper_format_key_index_entry_cmp(&key_index->entries[middle], &target) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    // Hash collisions are harmless: seek_to_key compares the key and keeps moving forward
+    if(low < key_index->count && key_index->entries[low].hash == target.hash) {
+        return stream_seek(stream, key_index->entries[low].line_start, StreamOffsetFromStart);
+    } else {
+        return stream_seek(stream, 0, StreamOffsetFromEnd);
+    }
+}
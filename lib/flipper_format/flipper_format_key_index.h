@@ -0,0 +1,49 @@
+#pragma once
+#include <stdbool.h>
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FlipperFormatKeyIndex FlipperFormatKeyIndex;
+
+/**
+ * Allocate an empty key index. Nothing is read until the first seek.
+ * @return FlipperFormatKeyIndex*
+ */
+FlipperFormatKeyIndex* flipper_format_key_index_alloc(void);
+
+/**
+ * Free the key index.
+ * @param key_index
+ */
+void flipper_format_key_index_free(FlipperFormatKeyIndex* key_index);
+
+/**
+ * Drop indexed offsets, the index is built again on the next seek.
+ * Must be called whenever the stream content changes.
+ * @param key_index
+ */
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* key_index);
+
+/**
+ * Move the stream to the beginning of the line holding the next occurrence of the key,
+ * or to the end of the stream if there is none. Keys are indexed only at line starts,
+ * exactly as flipper_format_stream_seek_to_key() finds them when moving line by line,
+ * so the stream must be at a line start or at the end of a line, as reads leave it.
+ * Index is built with a single pass over the stream on the first call.
+ * @param key_index
+ * @param stream
+ * @param key
+ * @return true stream was moved, seek_to_key will check only one line
+ * @return false index is unavailable (not enough memory or stream error), stream is untouched
+ */
+bool flipper_format_key_index_seek(
+    FlipperFormatKeyIndex* key_index,
+    Stream* stream,
+    const char* key);
+
+#ifdef __cplusplus
+}
+#endif
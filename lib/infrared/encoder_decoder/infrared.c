@@ -13,12 +13,22 @@
 #include "kaseikyo/infrared_protocol_kaseikyo.h"
 #include "rca/infrared_protocol_rca.h"
 
+#include "nec/infrared_protocol_nec_i.h"
+#include "samsung/infrared_protocol_samsung_i.h"
+#include "rc5/infrared_protocol_rc5_i.h"
+#include "rc6/infrared_protocol_rc6_i.h"
+#include "sirc/infrared_protocol_sirc_i.h"
+#include "kaseikyo/infrared_protocol_kaseikyo_i.h"
+#include "rca/infrared_protocol_rca_i.h"
+
 typedef struct {
     InfraredAlloc alloc;
     InfraredDecode decode;
     InfraredDecoderReset reset;
     InfraredFree free;
     InfraredDecoderCheckReady check_ready;
+    /* Used to drop the decoder early in the frame, NULL to always feed it */
+    const InfraredTimings* timings;
 } InfraredDecoders;
 
 typedef struct {
@@ -28,8 +38,18 @@ typedef struct {
     InfraredFree free;
 } InfraredEncoders;
 
+/* Decoder state within a frame. Skipped decoder is rearmed by a space longer than
+ * its min_split_time, active one - by a space longer than its silence_time */
+typedef enum {
+    InfraredDecoderFrameStart, /* first mark is not checked yet */
+    InfraredDecoderFrameActive, /* first mark fits protocol, decoder gets all timings */
+    InfraredDecoderFrameSkipped, /* first mark doesn't fit, decoder is idle till frame end */
+} InfraredDecoderFrame;
+
 struct InfraredDecoderHandler {
     void** ctx;
+    InfraredDecoderFrame* frame;
+    bool prefilter;
 };
 
 struct InfraredEncoderHandler {
@@ -50,7 +70,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_nec_decode,
              .reset = infrared_decoder_nec_reset,
              .check_ready = infrared_decoder_nec_check_ready,
-             .free = infrared_decoder_nec_free},
+             .free = infrared_decoder_nec_free,
+             .timings = &infrared_protocol_nec.timings},
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
              .encode = infrared_encoder_nec_encode,
@@ -64,7 +85,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_samsung32_decode,
              .reset = infrared_decoder_samsung32_reset,
              .check_ready = infrared_decoder_samsung32_check_ready,
-             .free = infrared_decoder_samsung32_free},
+             .free = infrared_decoder_samsung32_free,
+             .timings = &infrared_protocol_samsung32.timings},
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
              .encode = infrared_encoder_samsung32_encode,
@@ -78,7 +100,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc5_decode,
              .reset = infrared_decoder_rc5_reset,
              .check_ready = infrared_decoder_rc5_check_ready,
-             .free = infrared_decoder_rc5_free},
+             .free = infrared_decoder_rc5_free,
+             .timings = &infrared_protocol_rc5.timings},
         .encoder =
             {.alloc = infrared_encoder_rc5_alloc,
              .encode = infrared_encoder_rc5_encode,
@@ -92,7 +115,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc6_decode,
              .reset = infrared_decoder_rc6_reset,
              .check_ready = infrared_decoder_rc6_check_ready,
-             .free = infrared_decoder_rc6_free},
+             .free = infrared_decoder_rc6_free,
+             .timings = &infrared_protocol_rc6.timings},
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
              .encode = infrared_encoder_rc6_encode,
@@ -106,7 +130,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_sirc_decode,
              .reset = infrared_decoder_sirc_reset,
              .check_ready = infrared_decoder_sirc_check_ready,
-             .free = infrared_decoder_sirc_free},
+             .free = infrared_decoder_sirc_free,
+             .timings = &infrared_protocol_sirc.timings},
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
              .encode = infrared_encoder_sirc_encode,
@@ -120,7 +145,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_kaseikyo_decode,
              .reset = infrared_decoder_kaseikyo_reset,
              .check_ready = infrared_decoder_kaseikyo_check_ready,
-             .free = infrared_decoder_kaseikyo_free},
+             .free = infrared_decoder_kaseikyo_free,
+             .timings = &infrared_protocol_kaseikyo.timings},
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
              .encode = infrared_encoder_kaseikyo_encode,
@@ -134,7 +160,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rca_decode,
              .reset = infrared_decoder_rca_reset,
              .check_ready = infrared_decoder_rca_check_ready,
-             .free = infrared_decoder_rca_free},
+             .free = infrared_decoder_rca_free,
+             .timings = &infrared_protocol_rca.timings},
         .encoder =
             {.alloc = infrared_encoder_rca_alloc,
              .encode = infrared_encoder_rca_encode,
@@ -147,6 +174,59 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
 static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolVariant* infrared_get_variant_by_protocol(InfraredProtocol protocol);
 
+/* Mark is too short to be a part of any frame of the protocol, let decoder handle it */
+static bool infrared_prefilter_is_glitch(const InfraredTimings* timings, uint32_t duration) {
+    uint32_t shortest_mark = timings->bit1_mark;
+    if(timings->bit0_mark && (timings->bit0_mark < shortest_mark)) {
+        shortest_mark = timings->bit0_mark;
+    }
+    return (duration + timings->bit_tolerance) <= shortest_mark;
+}
+
+/* First mark of a frame: preamble, or one or two half-bits for protocols without it */
+static bool infrared_prefilter_is_frame_start(const InfraredTimings* timings, uint32_t duration) {
+    if(timings->preamble_mark) {
+        return MATCH_TIMING(duration, timings->preamble_mark, timings->preamble_tolerance);
+    }
+    return MATCH_TIMING(duration, timings->bit1_mark, timings->bit_tolerance) ||
+           MATCH_TIMING(duration, 2 * timings->bit1_mark, timings->bit_tolerance);
+}
+
+/* Check whether decoder can still recognize current frame, so it has to get the timing.
+ * Active decoders are not reset on frame end, as repeats are decoded from previous state. */
+static bool infrared_prefilter_is_viable(
+    InfraredDecoderHandler* handler,
+    size_t index,
+    bool level,
+    uint32_t duration) {
+    const InfraredDecoders* decoder = &infrared_encoder_decoder[index].decoder;
+    InfraredDecoderFrame* frame = &handler->frame[index];
+
+    if(!handler->prefilter || !decoder->timings) return true;
+
+    if(!level) {
+        if(*frame == InfraredDecoderFrameSkipped) {
+            if(duration <= decoder->timings->min_split_time) return false;
+            *frame = InfraredDecoderFrameStart;
+        } else if(*frame == InfraredDecoderFrameActive) {
+            if(duration > decoder->timings->silence_time) *frame = InfraredDecoderFrameStart;
+        }
+        return true;
+    }
+
+    if(*frame == InfraredDecoderFrameStart) {
+        if(infrared_prefilter_is_glitch(decoder->timings, duration)) return true;
+        if(infrared_prefilter_is_frame_start(decoder->timings, duration)) {
+            *frame = InfraredDecoderFrameActive;
+        } else {
+            *frame = InfraredDecoderFrameSkipped;
+            decoder->reset(handler->ctx[index]);
+        }
+    }
+
+    return *frame != InfraredDecoderFrameSkipped;
+}
+
 const InfraredMessage*
     infrared_decode(InfraredDecoderHandler* handler, bool level, uint32_t duration) {
     furi_assert(handler);
@@ -155,7 +235,8 @@ const InfraredMessage*
     InfraredMessage* result = NULL;
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.decode) {
+        if(infrared_encoder_decoder[i].decoder.decode &&
+           infrared_prefilter_is_viable(handler, i, level, duration)) {
             message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
             if(!result && message) {
                 result = message;
@@ -169,6 +250,8 @@ const InfraredMessage*
 InfraredDecoderHandler* infrared_alloc_decoder(void) {
     InfraredDecoderHandler* handler = malloc(sizeof(InfraredDecoderHandler));
     handler->ctx = malloc(sizeof(void*) * COUNT_OF(infrared_encoder_decoder));
+    handler->frame = malloc(sizeof(InfraredDecoderFrame) * COUNT_OF(infrared_encoder_decoder));
+    handler->prefilter = true;
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         handler->ctx[i] = 0;
@@ -190,6 +273,7 @@ void infrared_free_decoder(InfraredDecoderHandler* handler) {
     }
 
     free(handler->ctx);
+    free(handler->frame);
     free(handler);
 }
 
@@ -197,6 +281,16 @@ void infrared_reset_decoder(InfraredDecoderHandler* handler) {
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         if(infrared_encoder_decoder[i].decoder.reset)
             infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+        handler->frame[i] = InfraredDecoderFrameStart;
+    }
+}
+
+void infrared_set_decoder_prefilter(InfraredDecoderHandler* handler, bool enable) {
+    furi_assert(handler);
+
+    if(handler->prefilter != enable) {
+        handler->prefilter = enable;
+        infrared_reset_decoder(handler);
     }
 }
 
@@ -207,6 +301,7 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
     InfraredMessage* result = NULL;
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        if(handler->frame[i] == InfraredDecoderFrameSkipped) continue;
         if(infrared_encoder_decoder[i].decoder.check_ready) {
             message = infrared_encoder_decoder[i].decoder.check_ready(handler->ctx[i]);
             if(!result && message) {
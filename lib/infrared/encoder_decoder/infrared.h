@@ -104,6 +104,17 @@ void infrared_free_decoder(InfraredDecoderHandler* handler);
  */
 void infrared_reset_decoder(InfraredDecoderHandler* handler);
 
+/**
+ * Enable or disable protocol timing prefilter of INFRARED decoder. Enabled by default.
+ * With prefilter each decoder checks the first mark of a frame against its protocol
+ * timings, and decoders which don't match don't get timings till the frame ends.
+ * Decoder is reset when setting changes.
+ *
+ * \param[in]   handler     - handler to INFRARED decoders. Should be acquired with \c infrared_alloc_decoder().
+ * \param[in]   enable      - true to enable prefilter, false to feed every decoder with every timing.
+ */
+void infrared_set_decoder_prefilter(InfraredDecoderHandler* handler, bool enable);
+
 /**
  * Get protocol name by protocol enum.
  *
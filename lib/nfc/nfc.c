@@ -4,6 +4,7 @@
 
 #include <furi_hal_nfc.h>
 #include <furi/furi.h>
+#include <toolbox/trace.h>
 
 #define TAG "Nfc"
 
@@ -119,6 +120,7 @@ static int32_t nfc_worker_listener(void* context) {
 
     while(true) {
         FuriHalNfcEvent event = furi_hal_nfc_listener_wait_event(FURI_HAL_NFC_EVENT_WAIT_FOREVER);
+        trace_begin(TraceProbeNfcListenerEvent);
         if(event & FuriHalNfcEventAbortRequest) {
             nfc_event.type = NfcEventTypeUserAbort;
             instance->callback(nfc_event, instance->context);
@@ -153,7 +155,10 @@ static int32_t nfc_worker_listener(void* context) {
                 furi_hal_nfc_listener_idle();
             }
         }
+        trace_end(TraceProbeNfcListenerEvent);
     }
+    // Loop is left by break, event is not closed yet
+    trace_end(TraceProbeNfcListenerEvent);
 
     furi_hal_nfc_reset_mode();
     instance->config_state = NfcConfigurationStateIdle;
@@ -229,7 +234,9 @@ static int32_t nfc_worker_poller(void* context) {
 
     bool exit = false;
     while(!exit) {
+        trace_begin(TraceProbeNfcPollerState);
         exit = nfc_worker_poller_state_handlers[instance->poller_state](instance);
+        trace_end(TraceProbeNfcPollerState);
     }
 
     return 0;
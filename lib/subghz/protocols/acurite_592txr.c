@@ -37,6 +37,13 @@ static const SubGhzBlockConst ws_protocol_acurite_592txr_const = {
     .min_count_bit_for_found = 56,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_592txr_start = {
+    .timing = &ws_protocol_acurite_592txr_const,
+    .level = true,
+    .te_mult = 3,
+    .delta_mult = 2,
+};
+
 struct WSProtocolDecoderAcurite_592TXR {
     SubGhzProtocolDecoderBase base;
 
@@ -71,6 +78,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_592txr_decoder = {
     .serialize = ws_protocol_decoder_acurite_592txr_serialize,
     .deserialize = ws_protocol_decoder_acurite_592txr_deserialize,
     .get_string = ws_protocol_decoder_acurite_592txr_get_string,
+
+    .start = &ws_protocol_acurite_592txr_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_592txr_encoder = {
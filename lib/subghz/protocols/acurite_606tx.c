@@ -23,6 +23,13 @@ static const SubGhzBlockConst ws_protocol_acurite_606tx_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_606tx_start = {
+    .timing = &ws_protocol_acurite_606tx_const,
+    .level = false,
+    .te_mult = 17,
+    .delta_mult = 8,
+};
+
 struct WSProtocolDecoderAcurite_606TX {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_606tx_decoder = {
     .serialize = ws_protocol_decoder_acurite_606tx_serialize,
     .deserialize = ws_protocol_decoder_acurite_606tx_deserialize,
     .get_string = ws_protocol_decoder_acurite_606tx_get_string,
+
+    .start = &ws_protocol_acurite_606tx_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_606tx_encoder = {
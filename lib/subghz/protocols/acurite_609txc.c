@@ -24,6 +24,13 @@ static const SubGhzBlockConst ws_protocol_acurite_609txc_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_609txc_start = {
+    .timing = &ws_protocol_acurite_609txc_const,
+    .level = false,
+    .te_mult = 17,
+    .delta_mult = 8,
+};
+
 struct WSProtocolDecoderAcurite_609TXC {
     SubGhzProtocolDecoderBase base;
 
@@ -55,6 +62,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_609txc_decoder = {
     .serialize = ws_protocol_decoder_acurite_609txc_serialize,
     .deserialize = ws_protocol_decoder_acurite_609txc_deserialize,
     .get_string = ws_protocol_decoder_acurite_609txc_get_string,
+
+    .start = &ws_protocol_acurite_609txc_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_609txc_encoder = {
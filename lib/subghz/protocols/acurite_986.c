@@ -27,6 +27,14 @@ static const SubGhzBlockConst ws_protocol_acurite_986_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_acurite_986_start = {
+    .timing = &ws_protocol_acurite_986_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 1,
+    .delta_mult = 15,
+};
+
 struct WSProtocolDecoderAcurite_986 {
     SubGhzProtocolDecoderBase base;
 
@@ -61,6 +69,8 @@ const SubGhzProtocolDecoder ws_protocol_acurite_986_decoder = {
     .serialize = ws_protocol_decoder_acurite_986_serialize,
     .deserialize = ws_protocol_decoder_acurite_986_deserialize,
     .get_string = ws_protocol_decoder_acurite_986_get_string,
+
+    .start = &ws_protocol_acurite_986_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_acurite_986_encoder = {
@@ -18,6 +18,13 @@ static const SubGhzBlockConst subghz_protocol_alutech_at_4n_const = {
     .min_count_bit_for_found = 72,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_alutech_at_4n_start = {
+    .timing = &subghz_protocol_alutech_at_4n_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderAlutech_at_4n {
     SubGhzProtocolDecoderBase base;
 
@@ -58,6 +65,8 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
+
+    .start = &subghz_protocol_alutech_at_4n_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_ansonic_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_ansonic_start = {
+    .timing = &subghz_protocol_ansonic_const,
+    .level = false,
+    .te_mult = 35,
+    .delta_mult = 35,
+};
+
 struct SubGhzProtocolDecoderAnsonic {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+
+    .start = &subghz_protocol_ansonic_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
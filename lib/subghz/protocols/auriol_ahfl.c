@@ -35,6 +35,13 @@ static const SubGhzBlockConst ws_protocol_auriol_ahfl_const = {
     .min_count_bit_for_found = 42,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_auriol_ahfl_start = {
+    .timing = &ws_protocol_auriol_ahfl_const,
+    .level = false,
+    .te_mult = 18,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderAuriol_AHFL {
     SubGhzProtocolDecoderBase base;
 
@@ -66,6 +73,8 @@ const SubGhzProtocolDecoder ws_protocol_auriol_ahfl_decoder = {
     .serialize = ws_protocol_decoder_auriol_ahfl_serialize,
     .deserialize = ws_protocol_decoder_auriol_ahfl_deserialize,
     .get_string = ws_protocol_decoder_auriol_ahfl_get_string,
+
+    .start = &ws_protocol_auriol_ahfl_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_auriol_ahfl_encoder = {
@@ -34,6 +34,13 @@ static const SubGhzBlockConst ws_protocol_auriol_th_const = {
     .min_count_bit_for_found = 37,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_auriol_th_start = {
+    .timing = &ws_protocol_auriol_th_const,
+    .level = false,
+    .te_mult = 8,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderAuriol_TH {
     SubGhzProtocolDecoderBase base;
 
@@ -65,6 +72,8 @@ const SubGhzProtocolDecoder ws_protocol_auriol_th_decoder = {
     .serialize = ws_protocol_decoder_auriol_th_serialize,
     .deserialize = ws_protocol_decoder_auriol_th_deserialize,
     .get_string = ws_protocol_decoder_auriol_th_get_string,
+
+    .start = &ws_protocol_auriol_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_auriol_th_encoder = {
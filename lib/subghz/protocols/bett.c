@@ -32,6 +32,13 @@ static const SubGhzBlockConst subghz_protocol_bett_const = {
     .min_count_bit_for_found = 18,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_bett_start = {
+    .timing = &subghz_protocol_bett_const,
+    .level = false,
+    .te_mult = 44,
+    .delta_mult = 15,
+};
+
 struct SubGhzProtocolDecoderBETT {
     SubGhzProtocolDecoderBase base;
 
@@ -63,6 +70,8 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+
+    .start = &subghz_protocol_bett_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
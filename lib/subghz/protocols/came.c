@@ -27,6 +27,13 @@ static const SubGhzBlockConst subghz_protocol_came_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_start = {
+    .timing = &subghz_protocol_came_const,
+    .level = false,
+    .te_mult = 56,
+    .delta_mult = 47,
+};
+
 struct SubGhzProtocolDecoderCame {
     SubGhzProtocolDecoderBase base;
 
@@ -59,6 +66,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+
+    .start = &subghz_protocol_came_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
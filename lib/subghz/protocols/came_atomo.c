@@ -18,6 +18,14 @@ static const SubGhzBlockConst subghz_protocol_came_atomo_const = {
     .min_count_bit_for_found = 62,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_atomo_start = {
+    .timing = &subghz_protocol_came_atomo_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 60,
+    .delta_mult = 40,
+};
+
 struct SubGhzProtocolDecoderCameAtomo {
     SubGhzProtocolDecoderBase base;
 
@@ -50,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
     .deserialize = subghz_protocol_decoder_came_atomo_deserialize,
     .get_string = subghz_protocol_decoder_came_atomo_get_string,
+
+    .start = &subghz_protocol_came_atomo_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder = {
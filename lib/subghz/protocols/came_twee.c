@@ -50,6 +50,14 @@ static const SubGhzBlockConst subghz_protocol_came_twee_const = {
     .min_count_bit_for_found = 54,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_came_twee_start = {
+    .timing = &subghz_protocol_came_twee_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 51,
+    .delta_mult = 20,
+};
+
 struct SubGhzProtocolDecoderCameTwee {
     SubGhzProtocolDecoderBase base;
 
@@ -81,6 +89,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .serialize = subghz_protocol_decoder_came_twee_serialize,
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
+
+    .start = &subghz_protocol_came_twee_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
@@ -45,6 +45,13 @@ static const SubGhzBlockConst subghz_protocol_chamb_code_const = {
     .min_count_bit_for_found = 10,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_chamb_code_start = {
+    .timing = &subghz_protocol_chamb_code_const,
+    .level = false,
+    .te_mult = 39,
+    .delta_mult = 20,
+};
+
 struct SubGhzProtocolDecoderChamb_Code {
     SubGhzProtocolDecoderBase base;
 
@@ -77,6 +84,8 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
     .deserialize = subghz_protocol_decoder_chamb_code_deserialize,
     .get_string = subghz_protocol_decoder_chamb_code_get_string,
+
+    .start = &subghz_protocol_chamb_code_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder = {
@@ -31,6 +31,13 @@ static const SubGhzBlockConst subghz_protocol_clemsa_const = {
     .min_count_bit_for_found = 18,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_clemsa_start = {
+    .timing = &subghz_protocol_clemsa_const,
+    .level = false,
+    .te_mult = 51,
+    .delta_mult = 25,
+};
+
 struct SubGhzProtocolDecoderClemsa {
     SubGhzProtocolDecoderBase base;
 
@@ -62,6 +69,8 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .serialize = subghz_protocol_decoder_clemsa_serialize,
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
+
+    .start = &subghz_protocol_clemsa_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_doitrand_const = {
     .min_count_bit_for_found = 37,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_doitrand_start = {
+    .timing = &subghz_protocol_doitrand_const,
+    .level = false,
+    .te_mult = 62,
+    .delta_mult = 30,
+};
+
 struct SubGhzProtocolDecoderDoitrand {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .serialize = subghz_protocol_decoder_doitrand_serialize,
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
+
+    .start = &subghz_protocol_doitrand_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
@@ -16,6 +16,14 @@ static const SubGhzBlockConst subghz_protocol_dooya_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_dooya_start = {
+    .timing = &subghz_protocol_dooya_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 12,
+    .delta_mult = 20,
+};
+
 struct SubGhzProtocolDecoderDooya {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+
+    .start = &subghz_protocol_dooya_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
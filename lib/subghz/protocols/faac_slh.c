@@ -1,5 +1,5 @@
 #include "faac_slh.h"
-#include "../subghz_keystore.h"
+#include "../subghz_keystore_i.h"
 #include <m-array.h>
 #include "keeloq_common.h"
 #include "../blocks/const.h"
@@ -19,6 +19,14 @@ static const SubGhzBlockConst subghz_protocol_faac_slh_const = {
     .min_count_bit_for_found = 64,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_faac_slh_start = {
+    .timing = &subghz_protocol_faac_slh_const,
+    .level = true,
+    .te_long = true,
+    .te_mult = 2,
+    .delta_mult = 3,
+};
+
 static uint32_t temp_fix_backup = 0;
 static uint32_t temp_counter_backup = 0;
 static bool faac_prog_mode = false;
@@ -69,6 +77,8 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
+
+    .start = &subghz_protocol_faac_slh_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
@@ -551,18 +561,19 @@ static void subghz_protocol_faac_slh_check_remote_controller(
         faac_prog_mode = false;
     }
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_FAAC:
-                // FAAC Learning
-                man = subghz_protocol_keeloq_common_faac_learning(
-                    instance->seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
-                *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                break;
-            }
-        }
+    // There is no decrypt check, the last FAAC key in keystore is used
+    const SubGhzKey* manufacture_code = NULL;
+    const SubGhzKey* key = NULL;
+    size_t cursor = 0;
+    while((key = subghz_keystore_get_next_key_by_type(keystore, KEELOQ_LEARNING_FAAC, &cursor))) {
+        manufacture_code = key;
+    }
+    if(manufacture_code) {
+        // FAAC Learning
+        man = subghz_protocol_keeloq_common_faac_learning(instance->seed, manufacture_code->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(code_hop, man);
+        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+    }
     instance->cnt = decrypt & 0xFFFFF;
     // Backup counter in case when we need to use programming mode
     if(code_fix != 0x0) {
@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_gate_tx_const = {
     .min_count_bit_for_found = 24,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_gate_tx_start = {
+    .timing = &subghz_protocol_gate_tx_const,
+    .level = false,
+    .te_mult = 47,
+    .delta_mult = 47,
+};
+
 struct SubGhzProtocolDecoderGateTx {
     SubGhzProtocolDecoderBase base;
 
@@ -47,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
     .deserialize = subghz_protocol_decoder_gate_tx_deserialize,
     .get_string = subghz_protocol_decoder_gate_tx_get_string,
+
+    .start = &subghz_protocol_gate_tx_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder = {
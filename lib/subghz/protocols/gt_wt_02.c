@@ -37,6 +37,13 @@ static const SubGhzBlockConst ws_protocol_gt_wt_02_const = {
     .min_count_bit_for_found = 37,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_gt_wt_02_start = {
+    .timing = &ws_protocol_gt_wt_02_const,
+    .level = false,
+    .te_mult = 18,
+    .delta_mult = 8,
+};
+
 struct WSProtocolDecoderGT_WT02 {
     SubGhzProtocolDecoderBase base;
 
@@ -68,6 +75,8 @@ const SubGhzProtocolDecoder ws_protocol_gt_wt_02_decoder = {
     .serialize = ws_protocol_decoder_gt_wt_02_serialize,
     .deserialize = ws_protocol_decoder_gt_wt_02_deserialize,
     .get_string = ws_protocol_decoder_gt_wt_02_get_string,
+
+    .start = &ws_protocol_gt_wt_02_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_gt_wt_02_encoder = {
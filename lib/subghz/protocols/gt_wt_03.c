@@ -60,6 +60,13 @@ static const SubGhzBlockConst ws_protocol_gt_wt_03_const = {
     .min_count_bit_for_found = 41,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_gt_wt_03_start = {
+    .timing = &ws_protocol_gt_wt_03_const,
+    .level = true,
+    .te_mult = 3,
+    .delta_mult = 2,
+};
+
 struct WSProtocolDecoderGT_WT03 {
     SubGhzProtocolDecoderBase base;
 
@@ -94,6 +101,8 @@ const SubGhzProtocolDecoder ws_protocol_gt_wt_03_decoder = {
     .serialize = ws_protocol_decoder_gt_wt_03_serialize,
     .deserialize = ws_protocol_decoder_gt_wt_03_deserialize,
     .get_string = ws_protocol_decoder_gt_wt_03_get_string,
+
+    .start = &ws_protocol_gt_wt_03_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_gt_wt_03_encoder = {
@@ -25,6 +25,13 @@ static const SubGhzBlockConst subghz_protocol_holtek_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_holtek_start = {
+    .timing = &subghz_protocol_holtek_const,
+    .level = false,
+    .te_mult = 36,
+    .delta_mult = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek {
     SubGhzProtocolDecoderBase base;
 
@@ -57,6 +64,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .serialize = subghz_protocol_decoder_holtek_serialize,
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
+
+    .start = &subghz_protocol_holtek_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
@@ -27,6 +27,13 @@ static const SubGhzBlockConst subghz_protocol_holtek_th12x_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_holtek_th12x_start = {
+    .timing = &subghz_protocol_holtek_th12x_const,
+    .level = false,
+    .te_mult = 36,
+    .delta_mult = 36,
+};
+
 struct SubGhzProtocolDecoderHoltek_HT12X {
     SubGhzProtocolDecoderBase base;
 
@@ -64,6 +71,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
+
+    .start = &subghz_protocol_holtek_th12x_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_honeywell_wdb_const = {
     .min_count_bit_for_found = 48,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_honeywell_wdb_start = {
+    .timing = &subghz_protocol_honeywell_wdb_const,
+    .level = false,
+    .te_mult = 3,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderHoneywell_WDB {
     SubGhzProtocolDecoderBase base;
 
@@ -58,6 +65,8 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_wdb_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_wdb_get_string,
+
+    .start = &subghz_protocol_honeywell_wdb_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder = {
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_hormann_const = {
     .min_count_bit_for_found = 44,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_hormann_start = {
+    .timing = &subghz_protocol_hormann_const,
+    .level = true,
+    .te_mult = 24,
+    .delta_mult = 24,
+};
+
 struct SubGhzProtocolDecoderHormann {
     SubGhzProtocolDecoderBase base;
 
@@ -51,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .serialize = subghz_protocol_decoder_hormann_serialize,
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
+
+    .start = &subghz_protocol_hormann_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_ido_const = {
     .min_count_bit_for_found = 48,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_ido_start = {
+    .timing = &subghz_protocol_ido_const,
+    .level = true,
+    .te_mult = 10,
+    .delta_mult = 5,
+};
+
 struct SubGhzProtocolDecoderIDo {
     SubGhzProtocolDecoderBase base;
 
@@ -47,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .deserialize = subghz_protocol_decoder_ido_deserialize,
     .serialize = subghz_protocol_decoder_ido_serialize,
     .get_string = subghz_protocol_decoder_ido_get_string,
+
+    .start = &subghz_protocol_ido_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ido_encoder = {
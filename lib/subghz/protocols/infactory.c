@@ -45,6 +45,13 @@ static const SubGhzBlockConst ws_protocol_infactory_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_infactory_start = {
+    .timing = &ws_protocol_infactory_const,
+    .level = true,
+    .te_mult = 2,
+    .delta_mult = 2,
+};
+
 struct WSProtocolDecoderInfactory {
     SubGhzProtocolDecoderBase base;
 
@@ -79,6 +86,8 @@ const SubGhzProtocolDecoder ws_protocol_infactory_decoder = {
     .serialize = ws_protocol_decoder_infactory_serialize,
     .deserialize = ws_protocol_decoder_infactory_deserialize,
     .get_string = ws_protocol_decoder_infactory_get_string,
+
+    .start = &ws_protocol_infactory_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_infactory_encoder = {
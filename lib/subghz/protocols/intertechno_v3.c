@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_intertechno_v3_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_intertechno_v3_start = {
+    .timing = &subghz_protocol_intertechno_v3_const,
+    .level = false,
+    .te_mult = 37,
+    .delta_mult = 15,
+};
+
 struct SubGhzProtocolDecoderIntertechno_V3 {
     SubGhzProtocolDecoderBase base;
 
@@ -56,6 +63,8 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
     .deserialize = subghz_protocol_decoder_intertechno_v3_deserialize,
     .get_string = subghz_protocol_decoder_intertechno_v3_get_string,
+
+    .start = &subghz_protocol_intertechno_v3_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_intertechno_v3_encoder = {
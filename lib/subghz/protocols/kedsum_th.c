@@ -31,6 +31,13 @@ static const SubGhzBlockConst ws_protocol_kedsum_th_const = {
     .min_count_bit_for_found = 42,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_kedsum_th_start = {
+    .timing = &ws_protocol_kedsum_th_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderKedsumTH {
     SubGhzProtocolDecoderBase base;
 
@@ -65,6 +72,8 @@ const SubGhzProtocolDecoder ws_protocol_kedsum_th_decoder = {
     .serialize = ws_protocol_decoder_kedsum_th_serialize,
     .deserialize = ws_protocol_decoder_kedsum_th_deserialize,
     .get_string = ws_protocol_decoder_kedsum_th_get_string,
+
+    .start = &ws_protocol_kedsum_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_kedsum_th_encoder = {
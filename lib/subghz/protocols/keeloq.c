@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_keeloq_start = {
+    .timing = &subghz_protocol_keeloq_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -65,6 +72,8 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+
+    .start = &subghz_protocol_keeloq_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -763,13 +772,53 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
     return false;
 }
 
-/** 
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint8_t btn;
+    uint16_t end_serial;
+} SubGhzProtocolKeeloqSearchContext;
+
+static bool subghz_protocol_keeloq_search_check(
+    const SubGhzKey* key,
+    SubGhzKeeloqVariant variant,
+    uint32_t decrypt,
+    void* context) {
+    UNUSED(variant);
+    SubGhzProtocolKeeloqSearchContext* search = context;
+
+    if(key->type == KEELOQ_LEARNING_NORMAL &&
+       strcmp(furi_string_get_cstr(key->name), "Centurion") == 0) {
+        return subghz_protocol_keeloq_check_decrypt_centurion(
+            search->instance, decrypt, search->btn);
+    }
+    return subghz_protocol_keeloq_check_decrypt(
+        search->instance, decrypt, search->btn, search->end_serial);
+}
+
+// Derivations tried for each learning type, unknown type is probed with all common ones
+static const uint16_t subghz_protocol_keeloq_search_variants[KEELOQ_LEARNING_TYPE_COUNT] = {
+    [KEELOQ_LEARNING_UNKNOWN] =
+        SubGhzKeeloqVariantSimple | SubGhzKeeloqVariantSimpleMirrored |
+        SubGhzKeeloqVariantNormal | SubGhzKeeloqVariantNormalMirrored |
+        SubGhzKeeloqVariantSecure | SubGhzKeeloqVariantSecureMirrored |
+        SubGhzKeeloqVariantMagicXorType1 | SubGhzKeeloqVariantMagicXorType1Mirrored,
+    [KEELOQ_LEARNING_SIMPLE] = SubGhzKeeloqVariantSimple,
+    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+    [KEELOQ_LEARNING_NORMAL] = SubGhzKeeloqVariantNormal,
+    [KEELOQ_LEARNING_SECURE] = SubGhzKeeloqVariantSecure,
+    [KEELOQ_LEARNING_MAGIC_XOR_TYPE_1] = SubGhzKeeloqVariantMagicXorType1,
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1] = SubGhzKeeloqVariantMagicSerialType1,
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2] = SubGhzKeeloqVariantMagicSerialType2,
+    [KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3] = SubGhzKeeloqVariantMagicSerialType3,
+};
+
+/**
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
  * @param keystore Pointer to a SubGhzKeystore* instance
- * @param manufacture_name 
+ * @param manufacture_name
  * @return true on successful search
  */
 static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
@@ -782,11 +831,11 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
 
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
-    bool mf_not_set = false;
+    SubGhzProtocolKeeloqSearchContext search = {
+        .instance = instance,
+        .btn = (uint8_t)(fix >> 28),
+        .end_serial = (uint16_t)(fix & 0xFF),
+    };
     // TODO:
     // if(mfname == 0x0) {
     //     mfname = "";
@@ -797,188 +846,29 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     if(strcmp(mfname, "Unknown") == 0) {
         return 1;
     } else if(strcmp(mfname, "") == 0) {
-        mf_not_set = true;
+        // Not set, search over all keys
+        mfname = NULL;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if((strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0)) {
-                        if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    } else {
-                        if(subghz_protocol_keeloq_check_decrypt(
-                               instance, decrypt, btn, end_serial)) {
-                            *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                            keystore->mfname = *manufacture_name;
-                            return 1;
-                        }
-                    }
-                    break;
-                case KEELOQ_LEARNING_SECURE:
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                    man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                    man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                    man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-
-                    // Secure Learning
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
 
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_secure_learning(
-                        fix, instance->seed, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 3;
-                        return 1;
-                    }
-
-                    // Magic xor type1 learning
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                        fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
-
-                    // Check for mirrored man
-                    man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 4;
-                        return 1;
-                    }
-
-                    break;
-                }
-            }
+    SubGhzKeeloqVariant variant;
+    const SubGhzKey* manufacture_code = subghz_protocol_keeloq_common_search(
+        keystore,
+        mfname,
+        subghz_protocol_keeloq_search_variants,
+        fix,
+        instance->seed,
+        hop,
+        subghz_protocol_keeloq_search_check,
+        &search,
+        &variant);
+    if(manufacture_code) {
+        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+        keystore->mfname = *manufacture_name;
+        if(manufacture_code->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = subghz_protocol_keeloq_common_get_learning_type(variant);
         }
+        return 1;
+    }
 
     // MF not found
     *manufacture_name = "Unknown";
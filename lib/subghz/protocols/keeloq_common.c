@@ -1,4 +1,5 @@
 #include "keeloq_common.h"
+#include "../subghz_keystore_i.h"
 
 #include <furi.h>
 
@@ -35,6 +36,56 @@ inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const
     return x;
 }
 
+/* Below this number of items bit-slicing overhead is bigger than the gain */
+#define KEELOQ_BATCH_MIN_SLICED 4u
+
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t* data,
+    const uint64_t* key,
+    uint32_t* result,
+    size_t count) {
+    furi_assert(count <= KEELOQ_BATCH_SIZE);
+
+    if(count < KEELOQ_BATCH_MIN_SLICED) {
+        for(size_t i = 0; i < count; i++) {
+            result[i] = subghz_protocol_keeloq_common_decrypt(data[i], key[i]);
+        }
+        return;
+    }
+
+    // Bit planes: bit N of item I is bit I of x[N] and k[N]
+    uint32_t x[32] = {0};
+    uint32_t k[64] = {0};
+    for(size_t i = 0; i < count; i++) {
+        for(size_t n = 0; n < 32; n++) x[n] |= (uint32_t)bit(data[i], n) << i;
+        for(size_t n = 0; n < 64; n++) k[n] |= (uint32_t)bit(key[i], n) << i;
+    }
+
+    // Register bit N is x[(N + shift) & 31]: shift left only moves the origin
+    uint32_t shift = 0;
+#define plane(n) x[((n) + shift) & 31]
+    for(uint32_t r = 0; r < 528; r++) {
+        uint32_t a = plane(0);
+        uint32_t b = plane(8);
+        uint32_t c = plane(19);
+        uint32_t d = plane(25);
+        uint32_t e = plane(30);
+        // KEELOQ_NLF in algebraic normal form
+        uint32_t nlf = a ^ b ^ (a & b) ^ (b & c) ^ (a & d) ^ (c & d) ^
+                       (e & (a ^ (a & b) ^ c ^ (a & c) ^ (b & d) ^ (c & d)));
+        uint32_t next = plane(31) ^ plane(15) ^ k[(15 - r) & 63] ^ nlf;
+        shift = (shift - 1) & 31;
+        x[shift] = next;
+    }
+
+    for(size_t i = 0; i < count; i++) {
+        uint32_t value = 0;
+        for(size_t n = 0; n < 32; n++) value |= (uint32_t)bit(plane(n), i) << n;
+        result[i] = value;
+    }
+#undef plane
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
@@ -140,3 +191,208 @@ inline uint64_t
     subghz_protocol_keeloq_common_magic_serial_type3_learning(uint32_t data, uint64_t man) {
     return (man & 0xFFFFFFFFFF000000) | (data & 0xFFFFFF);
 }
+
+uint8_t subghz_protocol_keeloq_common_get_learning_type(SubGhzKeeloqVariant variant) {
+    switch(variant) {
+    case SubGhzKeeloqVariantSimple:
+    case SubGhzKeeloqVariantSimpleMirrored:
+        return KEELOQ_LEARNING_SIMPLE;
+    case SubGhzKeeloqVariantNormal:
+    case SubGhzKeeloqVariantNormalMirrored:
+        return KEELOQ_LEARNING_NORMAL;
+    case SubGhzKeeloqVariantSecure:
+    case SubGhzKeeloqVariantSecureMirrored:
+        return KEELOQ_LEARNING_SECURE;
+    case SubGhzKeeloqVariantMagicXorType1:
+    case SubGhzKeeloqVariantMagicXorType1Mirrored:
+        return KEELOQ_LEARNING_MAGIC_XOR_TYPE_1;
+    case SubGhzKeeloqVariantMagicSerialType1:
+        return KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1;
+    case SubGhzKeeloqVariantMagicSerialType2:
+        return KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2;
+    case SubGhzKeeloqVariantMagicSerialType3:
+        return KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3;
+    }
+    return KEELOQ_LEARNING_UNKNOWN;
+}
+
+#define KEELOQ_VARIANT_MIRRORED                                              \
+    (SubGhzKeeloqVariantSimpleMirrored | SubGhzKeeloqVariantNormalMirrored | \
+     SubGhzKeeloqVariantSecureMirrored | SubGhzKeeloqVariantMagicXorType1Mirrored)
+
+typedef struct {
+    const SubGhzKey* key;
+    SubGhzKeeloqVariant variant;
+} SubGhzKeeloqCandidate;
+
+// Too big for decoder thread stack, allocated once per search
+typedef struct {
+    SubGhzKeeloqCandidate candidate[KEELOQ_BATCH_SIZE];
+    size_t count;
+
+    uint64_t man[KEELOQ_BATCH_SIZE];
+    uint32_t hop[KEELOQ_BATCH_SIZE];
+    uint32_t decrypt[KEELOQ_BATCH_SIZE];
+
+    // Normal and secure learning decrypt twice to get manufacture for serial
+    size_t learning_index[KEELOQ_BATCH_SIZE];
+    uint32_t learning_data[2][KEELOQ_BATCH_SIZE];
+    uint64_t learning_key[KEELOQ_BATCH_SIZE];
+    uint32_t learning_result[2][KEELOQ_BATCH_SIZE];
+} SubGhzKeeloqSearchBatch;
+
+static bool subghz_protocol_keeloq_common_search_batch(
+    SubGhzKeeloqSearchBatch* batch,
+    uint32_t fix,
+    uint32_t seed,
+    uint32_t hop,
+    SubGhzKeeloqSearchCheck check,
+    void* context,
+    SubGhzKeeloqCandidate* found) {
+    size_t learning_count = 0;
+
+    for(size_t i = 0; i < batch->count; i++) {
+        SubGhzKeeloqVariant variant = batch->candidate[i].variant;
+        uint64_t key = batch->candidate[i].key->key;
+        if(variant & KEELOQ_VARIANT_MIRRORED) key = __builtin_bswap64(key);
+
+        switch(variant) {
+        case SubGhzKeeloqVariantSimple:
+        case SubGhzKeeloqVariantSimpleMirrored:
+            batch->man[i] = key;
+            break;
+        case SubGhzKeeloqVariantNormal:
+        case SubGhzKeeloqVariantNormalMirrored:
+            batch->learning_index[learning_count] = i;
+            batch->learning_data[0][learning_count] = (fix & 0x0FFFFFFF) | 0x20000000;
+            batch->learning_data[1][learning_count] = (fix & 0x0FFFFFFF) | 0x60000000;
+            batch->learning_key[learning_count++] = key;
+            break;
+        case SubGhzKeeloqVariantSecure:
+        case SubGhzKeeloqVariantSecureMirrored:
+            batch->learning_index[learning_count] = i;
+            batch->learning_data[0][learning_count] = fix & 0x0FFFFFFF;
+            batch->learning_data[1][learning_count] = seed;
+            batch->learning_key[learning_count++] = key;
+            break;
+        case SubGhzKeeloqVariantMagicXorType1:
+        case SubGhzKeeloqVariantMagicXorType1Mirrored:
+            batch->man[i] = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, key);
+            break;
+        case SubGhzKeeloqVariantMagicSerialType1:
+            batch->man[i] = subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, key);
+            break;
+        case SubGhzKeeloqVariantMagicSerialType2:
+            batch->man[i] = subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, key);
+            break;
+        case SubGhzKeeloqVariantMagicSerialType3:
+            batch->man[i] = subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, key);
+            break;
+        }
+        batch->hop[i] = hop;
+    }
+
+    if(learning_count) {
+        for(size_t n = 0; n < 2; n++) {
+            subghz_protocol_keeloq_common_decrypt_batch(
+                batch->learning_data[n],
+                batch->learning_key,
+                batch->learning_result[n],
+                learning_count);
+        }
+        for(size_t j = 0; j < learning_count; j++) {
+            size_t i = batch->learning_index[j];
+            uint64_t k1 = batch->learning_result[0][j];
+            uint64_t k2 = batch->learning_result[1][j];
+            if(batch->candidate[i].variant &
+               (SubGhzKeeloqVariantNormal | SubGhzKeeloqVariantNormalMirrored)) {
+                batch->man[i] = (k2 << 32) | k1;
+            } else {
+                batch->man[i] = (k1 << 32) | k2;
+            }
+        }
+    }
+
+    subghz_protocol_keeloq_common_decrypt_batch(
+        batch->hop, batch->man, batch->decrypt, batch->count);
+
+    // Checks may have side effects: call them in order, stop on the first match
+    size_t count = batch->count;
+    batch->count = 0;
+    for(size_t i = 0; i < count; i++) {
+        const SubGhzKeeloqCandidate* candidate = &batch->candidate[i];
+        if(check(candidate->key, candidate->variant, batch->decrypt[i], context)) {
+            *found = *candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const SubGhzKey* subghz_protocol_keeloq_common_search(
+    SubGhzKeystore* keystore,
+    const char* name,
+    const uint16_t* variants,
+    uint32_t fix,
+    uint32_t seed,
+    uint32_t hop,
+    SubGhzKeeloqSearchCheck check,
+    void* context,
+    SubGhzKeeloqVariant* variant) {
+    furi_assert(keystore);
+    furi_assert(variants);
+    furi_assert(check);
+
+    // Search for a single learning type goes over type index, other keys are not touched
+    int32_t single_type = -1;
+    if(!name) {
+        for(uint16_t type = 0; type < KEELOQ_LEARNING_TYPE_COUNT; type++) {
+            if(variants[type]) single_type = (single_type == -1) ? type : -2;
+        }
+    }
+
+    SubGhzKeeloqSearchBatch* batch = malloc(sizeof(SubGhzKeeloqSearchBatch));
+    batch->count = 0;
+
+    SubGhzKeeloqCandidate found = {0};
+    bool is_found = false;
+    const SubGhzKey* key = NULL;
+    size_t cursor = 0;
+    do {
+        if(single_type >= 0) {
+            key = subghz_keystore_get_next_key_by_type(keystore, single_type, &cursor);
+        } else {
+            key = subghz_keystore_get_next_key(keystore, name, &cursor);
+        }
+
+        uint16_t key_variants = 0;
+        if(key && key->type < KEELOQ_LEARNING_TYPE_COUNT) key_variants = variants[key->type];
+
+        while(key_variants && !is_found) {
+            // Lowest bit first, that is SubGhzKeeloqVariant order
+            uint16_t key_variant = key_variants & -key_variants;
+            key_variants &= ~key_variant;
+
+            batch->candidate[batch->count].key = key;
+            batch->candidate[batch->count].variant = key_variant;
+            batch->count++;
+
+            if(batch->count == KEELOQ_BATCH_SIZE) {
+                is_found = subghz_protocol_keeloq_common_search_batch(
+                    batch, fix, seed, hop, check, context, &found);
+            }
+        }
+    } while(key && !is_found);
+
+    if(!is_found && batch->count) {
+        is_found = subghz_protocol_keeloq_common_search_batch(
+            batch, fix, seed, hop, check, context, &found);
+    }
+
+    free(batch);
+
+    if(!is_found) return NULL;
+    if(variant) *variant = found.variant;
+    return found.key;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base.h"
+#include "../subghz_keystore.h"
 
 #include <furi.h>
 
@@ -25,6 +26,42 @@
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1 6u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2 7u
 #define KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3 8u
+#define KEELOQ_LEARNING_TYPE_COUNT 9u
+
+/* Max number of decryptions done at once by subghz_protocol_keeloq_common_decrypt_batch */
+#define KEELOQ_BATCH_SIZE 32u
+
+/*
+ * Manufacture key derivations tried by subghz_protocol_keeloq_common_search.
+ * Derivations of one key are tried in the order of this enum.
+ */
+typedef enum {
+    SubGhzKeeloqVariantSimple = (1 << 0),
+    SubGhzKeeloqVariantSimpleMirrored = (1 << 1),
+    SubGhzKeeloqVariantNormal = (1 << 2),
+    SubGhzKeeloqVariantNormalMirrored = (1 << 3),
+    SubGhzKeeloqVariantSecure = (1 << 4),
+    SubGhzKeeloqVariantSecureMirrored = (1 << 5),
+    SubGhzKeeloqVariantMagicXorType1 = (1 << 6),
+    SubGhzKeeloqVariantMagicXorType1Mirrored = (1 << 7),
+    SubGhzKeeloqVariantMagicSerialType1 = (1 << 8),
+    SubGhzKeeloqVariantMagicSerialType2 = (1 << 9),
+    SubGhzKeeloqVariantMagicSerialType3 = (1 << 10),
+} SubGhzKeeloqVariant;
+
+/**
+ * Decrypted hop validation callback
+ * @param key - manufacture key from keystore
+ * @param variant - derivation used to get manufacture for this serial number
+ * @param decrypt - decrypted hop
+ * @param context - callback context
+ * @return true if decrypted hop is valid, search is stopped
+ */
+typedef bool (*SubGhzKeeloqSearchCheck)(
+    const SubGhzKey* key,
+    SubGhzKeeloqVariant variant,
+    uint32_t decrypt,
+    void* context);
 
 /**
  * Simple Learning Encrypt
@@ -42,6 +79,20 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/**
+ * Decrypt several data words at once, bit-sliced: one 32 bit register holds
+ * the same bit of all words, so one round of the cipher is done for all of them.
+ * @param data - keeloq encrypt data, count items
+ * @param key - manufacture (64bit), count items
+ * @param result - decrypted data, count items
+ * @param count - number of items, KEELOQ_BATCH_SIZE max
+ */
+void subghz_protocol_keeloq_common_decrypt_batch(
+    const uint32_t* data,
+    const uint64_t* key,
+    uint32_t* result,
+    size_t count);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
@@ -98,3 +149,37 @@ uint64_t subghz_protocol_keeloq_common_magic_serial_type2_learning(uint32_t data
  */
 
 uint64_t subghz_protocol_keeloq_common_magic_serial_type3_learning(uint32_t data, uint64_t man);
+
+/** Learning type that corresponds to key derivation
+ * @param variant - key derivation
+ * @return KEELOQ_LEARNING_* learning type
+ */
+uint8_t subghz_protocol_keeloq_common_get_learning_type(SubGhzKeeloqVariant variant);
+
+/** Search keystore for the manufacture key that decrypts hop
+ * Candidates are checked in keystore order, derivations of one key in
+ * SubGhzKeeloqVariant order: the first accepted candidate is the same as with
+ * a plain loop over keys.
+ * Hops and key derivations are decrypted in batches of KEELOQ_BATCH_SIZE.
+ * @param keystore - pointer to a SubGhzKeystore instance
+ * @param name - manufacture name to search, NULL to search all keys
+ * @param variants - derivations to try for each learning type,
+ *                   SubGhzKeeloqVariant bitmask, KEELOQ_LEARNING_TYPE_COUNT items
+ * @param fix - fix part of the parcel
+ * @param seed - seed number (32bit), for secure learning
+ * @param hop - hop encrypted part of the parcel
+ * @param check - decrypted hop validation callback
+ * @param context - callback context
+ * @param[out] variant - derivation of the found key, can be NULL
+ * @return found key or NULL
+ */
+const SubGhzKey* subghz_protocol_keeloq_common_search(
+    SubGhzKeystore* keystore,
+    const char* name,
+    const uint16_t* variants,
+    uint32_t fix,
+    uint32_t seed,
+    uint32_t hop,
+    SubGhzKeeloqSearchCheck check,
+    void* context,
+    SubGhzKeeloqVariant* variant);
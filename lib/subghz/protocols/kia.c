@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_kia_const = {
     .min_count_bit_for_found = 61,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_kia_start = {
+    .timing = &subghz_protocol_kia_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderKIA {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .serialize = subghz_protocol_decoder_kia_serialize,
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
+
+    .start = &subghz_protocol_kia_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_kinggates_stylo_4k_const = {
     .min_count_bit_for_found = 89,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_kinggates_stylo_4k_start = {
+    .timing = &subghz_protocol_kinggates_stylo_4k_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderKingGates_stylo_4k {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
     .deserialize = subghz_protocol_decoder_kinggates_stylo_4k_deserialize,
     .get_string = subghz_protocol_decoder_kinggates_stylo_4k_get_string,
+
+    .start = &subghz_protocol_kinggates_stylo_4k_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kinggates_stylo_4k_encoder = {
@@ -444,6 +453,22 @@ void subghz_protocol_decoder_kinggates_stylo_4k_feed(void* context, bool level,
     }
 }
 
+static bool subghz_protocol_kinggates_stylo_4k_search_check(
+    const SubGhzKey* key,
+    SubGhzKeeloqVariant variant,
+    uint32_t decrypt,
+    void* context) {
+    UNUSED(key);
+    UNUSED(variant);
+    SubGhzBlockGeneric* instance = context;
+    if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
+       (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
+        instance->cnt = decrypt & 0xFFFF;
+        return true;
+    }
+    return false;
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -476,25 +501,24 @@ static void subghz_protocol_kinggates_stylo_4k_remote_controller(
 
     uint32_t hop = subghz_protocol_blocks_reverse_key(instance->data_2 >> 4, 32);
     uint64_t fix = subghz_protocol_blocks_reverse_key(instance->data, 53);
-    bool ret = false;
-    uint32_t decrypt = 0;
     instance->btn = (fix >> 17) & 0x0F;
     instance->serial = ((fix >> 5) & 0xFFFF0000) | (fix & 0xFFFF);
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(manufacture_code->type == KEELOQ_LEARNING_SIMPLE) {
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(((decrypt >> 28) == instance->btn) && (((decrypt >> 24) & 0x0F) == 0x0C) &&
-                   (((decrypt >> 16) & 0xFF) == (instance->serial & 0xFF))) {
-                    ret = true;
-                    break;
-                }
-            }
-        }
-    if(ret) {
-        instance->cnt = decrypt & 0xFFFF;
-    } else {
+    // Simple learning keys only, counter is set by the check
+    static const uint16_t variants[KEELOQ_LEARNING_TYPE_COUNT] = {
+        [KEELOQ_LEARNING_SIMPLE] = SubGhzKeeloqVariantSimple,
+    };
+    const SubGhzKey* manufacture_code = subghz_protocol_keeloq_common_search(
+        keystore,
+        NULL,
+        variants,
+        0,
+        0,
+        hop,
+        subghz_protocol_kinggates_stylo_4k_search_check,
+        instance,
+        NULL);
+    if(!manufacture_code) {
         instance->btn = 0;
         instance->serial = 0;
         instance->cnt = 0;
@@ -27,6 +27,13 @@ static const SubGhzBlockConst ws_protocol_lacrosse_tx141thbv2_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_lacrosse_tx141thbv2_start = {
+    .timing = &ws_protocol_lacrosse_tx141thbv2_const,
+    .level = true,
+    .te_mult = 4,
+    .delta_mult = 2,
+};
+
 struct WSProtocolDecoderLaCrosse_TX141THBv2 {
     SubGhzProtocolDecoderBase base;
 
@@ -61,6 +68,8 @@ const SubGhzProtocolDecoder ws_protocol_lacrosse_tx141thbv2_decoder = {
     .serialize = ws_protocol_decoder_lacrosse_tx141thbv2_serialize,
     .deserialize = ws_protocol_decoder_lacrosse_tx141thbv2_deserialize,
     .get_string = ws_protocol_decoder_lacrosse_tx141thbv2_get_string,
+
+    .start = &ws_protocol_lacrosse_tx141thbv2_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_lacrosse_tx141thbv2_encoder = {
@@ -22,6 +22,13 @@ static const SubGhzBlockConst subghz_protocol_linear_const = {
     .min_count_bit_for_found = 10,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_linear_start = {
+    .timing = &subghz_protocol_linear_const,
+    .level = false,
+    .te_mult = 42,
+    .delta_mult = 20,
+};
+
 struct SubGhzProtocolDecoderLinear {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .serialize = subghz_protocol_decoder_linear_serialize,
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
+
+    .start = &subghz_protocol_linear_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_linear_delta3_const = {
     .min_count_bit_for_found = 8,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_linear_delta3_start = {
+    .timing = &subghz_protocol_linear_delta3_const,
+    .level = false,
+    .te_mult = 70,
+    .delta_mult = 24,
+};
+
 struct SubGhzProtocolDecoderLinearDelta3 {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
     .deserialize = subghz_protocol_decoder_linear_delta3_deserialize,
     .get_string = subghz_protocol_decoder_linear_delta3_get_string,
+
+    .start = &subghz_protocol_linear_delta3_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_delta3_encoder = {
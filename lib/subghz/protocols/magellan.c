@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_magellan_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_magellan_start = {
+    .timing = &subghz_protocol_magellan_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderMagellan {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .serialize = subghz_protocol_decoder_magellan_serialize,
     .deserialize = subghz_protocol_decoder_magellan_deserialize,
     .get_string = subghz_protocol_decoder_magellan_get_string,
+
+    .start = &subghz_protocol_magellan_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_magellan_encoder = {
@@ -16,6 +16,14 @@ static const SubGhzBlockConst subghz_protocol_marantec_const = {
     .min_count_bit_for_found = 49,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_marantec_start = {
+    .timing = &subghz_protocol_marantec_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 5,
+    .delta_mult = 8,
+};
+
 struct SubGhzProtocolDecoderMarantec {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .serialize = subghz_protocol_decoder_marantec_serialize,
     .deserialize = subghz_protocol_decoder_marantec_deserialize,
     .get_string = subghz_protocol_decoder_marantec_get_string,
+
+    .start = &subghz_protocol_marantec_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_marantec_encoder = {
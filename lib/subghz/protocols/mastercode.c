@@ -32,6 +32,13 @@ static const SubGhzBlockConst subghz_protocol_mastercode_const = {
     .min_count_bit_for_found = 36,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_mastercode_start = {
+    .timing = &subghz_protocol_mastercode_const,
+    .level = false,
+    .te_mult = 15,
+    .delta_mult = 15,
+};
+
 struct SubGhzProtocolDecoderMastercode {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
@@ -61,6 +68,8 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
     .serialize = subghz_protocol_decoder_mastercode_serialize,
     .deserialize = subghz_protocol_decoder_mastercode_deserialize,
     .get_string = subghz_protocol_decoder_mastercode_get_string,
+
+    .start = &subghz_protocol_mastercode_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_mastercode_encoder = {
@@ -26,6 +26,13 @@ static const SubGhzBlockConst subghz_protocol_megacode_const = {
     .min_count_bit_for_found = 24,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_megacode_start = {
+    .timing = &subghz_protocol_megacode_const,
+    .level = false,
+    .te_mult = 13,
+    .delta_mult = 17,
+};
+
 struct SubGhzProtocolDecoderMegaCode {
     SubGhzProtocolDecoderBase base;
 
@@ -59,6 +66,8 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .serialize = subghz_protocol_decoder_megacode_serialize,
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
+
+    .start = &subghz_protocol_megacode_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
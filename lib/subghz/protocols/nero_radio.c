@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_nero_radio_const = {
     .min_count_bit_for_found = 56,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nero_radio_start = {
+    .timing = &subghz_protocol_nero_radio_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderNeroRadio {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
     .deserialize = subghz_protocol_decoder_nero_radio_deserialize,
     .get_string = subghz_protocol_decoder_nero_radio_get_string,
+
+    .start = &subghz_protocol_nero_radio_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder = {
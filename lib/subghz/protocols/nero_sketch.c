@@ -15,6 +15,13 @@ static const SubGhzBlockConst subghz_protocol_nero_sketch_const = {
     .min_count_bit_for_found = 40,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nero_sketch_start = {
+    .timing = &subghz_protocol_nero_sketch_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderNeroSketch {
     SubGhzProtocolDecoderBase base;
 
@@ -48,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
     .deserialize = subghz_protocol_decoder_nero_sketch_deserialize,
     .get_string = subghz_protocol_decoder_nero_sketch_get_string,
+
+    .start = &subghz_protocol_nero_sketch_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder = {
@@ -37,6 +37,13 @@ static const SubGhzBlockConst ws_protocol_nexus_th_const = {
     .min_count_bit_for_found = 36,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_nexus_th_start = {
+    .timing = &ws_protocol_nexus_th_const,
+    .level = false,
+    .te_mult = 8,
+    .delta_mult = 4,
+};
+
 struct WSProtocolDecoderNexus_TH {
     SubGhzProtocolDecoderBase base;
 
@@ -341,6 +348,8 @@ const SubGhzProtocolDecoder ws_protocol_nexus_th_decoder = {
     .serialize = ws_protocol_decoder_nexus_th_serialize,
     .deserialize = ws_protocol_decoder_nexus_th_deserialize,
     .get_string = ws_protocol_decoder_nexus_th_get_string,
+
+    .start = &ws_protocol_nexus_th_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_nexus_th_encoder = {
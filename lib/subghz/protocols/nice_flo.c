@@ -14,6 +14,13 @@ static const SubGhzBlockConst subghz_protocol_nice_flo_const = {
     .min_count_bit_for_found = 12,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nice_flo_start = {
+    .timing = &subghz_protocol_nice_flo_const,
+    .level = false,
+    .te_mult = 36,
+    .delta_mult = 36,
+};
+
 struct SubGhzProtocolDecoderNiceFlo {
     SubGhzProtocolDecoderBase base;
 
@@ -46,6 +53,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
+
+    .start = &subghz_protocol_nice_flo_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -26,6 +26,13 @@ static const SubGhzBlockConst subghz_protocol_nice_flor_s_const = {
     .min_count_bit_for_found = 52,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_nice_flor_s_start = {
+    .timing = &subghz_protocol_nice_flor_s_const,
+    .level = false,
+    .te_mult = 38,
+    .delta_mult = 38,
+};
+
 struct SubGhzProtocolDecoderNiceFlorS {
     SubGhzProtocolDecoderBase base;
 
@@ -64,6 +71,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+
+    .start = &subghz_protocol_nice_flor_s_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
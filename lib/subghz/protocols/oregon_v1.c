@@ -46,6 +46,13 @@ static const SubGhzBlockConst ws_protocol_oregon_v1_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_oregon_v1_start = {
+    .timing = &ws_protocol_oregon_v1_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderOregon_V1 {
     SubGhzProtocolDecoderBase base;
 
@@ -80,6 +87,8 @@ const SubGhzProtocolDecoder ws_protocol_oregon_v1_decoder = {
     .serialize = ws_protocol_decoder_oregon_v1_serialize,
     .deserialize = ws_protocol_decoder_oregon_v1_deserialize,
     .get_string = ws_protocol_decoder_oregon_v1_get_string,
+
+    .start = &ws_protocol_oregon_v1_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_oregon_v1_encoder = {
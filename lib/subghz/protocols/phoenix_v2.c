@@ -17,6 +17,13 @@ static const SubGhzBlockConst subghz_protocol_phoenix_v2_const = {
     .min_count_bit_for_found = 52,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_phoenix_v2_start = {
+    .timing = &subghz_protocol_phoenix_v2_const,
+    .level = false,
+    .te_mult = 60,
+    .delta_mult = 30,
+};
+
 struct SubGhzProtocolDecoderPhoenix_V2 {
     SubGhzProtocolDecoderBase base;
 
@@ -49,6 +56,8 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
+
+    .start = &subghz_protocol_phoenix_v2_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
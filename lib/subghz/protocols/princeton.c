@@ -21,6 +21,13 @@ static const SubGhzBlockConst subghz_protocol_princeton_const = {
     .min_count_bit_for_found = 24,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_princeton_start = {
+    .timing = &subghz_protocol_princeton_const,
+    .level = false,
+    .te_mult = 36,
+    .delta_mult = 36,
+};
+
 struct SubGhzProtocolDecoderPrinceton {
     SubGhzProtocolDecoderBase base;
 
@@ -57,6 +64,8 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .serialize = subghz_protocol_decoder_princeton_serialize,
     .deserialize = subghz_protocol_decoder_princeton_deserialize,
     .get_string = subghz_protocol_decoder_princeton_get_string,
+
+    .start = &subghz_protocol_princeton_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_princeton_encoder = {
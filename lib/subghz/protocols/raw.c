@@ -1,6 +1,7 @@
 #include "raw.h"
 #include <lib/flipper_format/flipper_format.h>
 #include "../subghz_file_encoder_worker.h"
+#include "../subghz_raw_varint.h"
 
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
@@ -33,6 +34,7 @@ struct SubGhzProtocolDecoderRAW {
     size_t sample_write;
     bool last_level;
     bool pause;
+    bool compact;
 };
 
 struct SubGhzProtocolEncoderRAW {
@@ -157,6 +159,12 @@ bool subghz_protocol_raw_save_to_file_init(
             FURI_LOG_E(TAG, "Unable to add Protocol");
             break;
         }
+        if(instance->compact &&
+           !flipper_format_write_string_cstr(
+               instance->flipper_file, SUBGHZ_RAW_ENCODING_KEY, SUBGHZ_RAW_ENCODING_VARINT)) {
+            FURI_LOG_E(TAG, "Unable to add RAW_Encoding");
+            break;
+        }
 
         instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
         instance->file_is_open = RAWFileIsOpenWrite;
@@ -176,8 +184,17 @@ static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* ins
 
     bool is_write = false;
     if(instance->file_is_open == RAWFileIsOpenWrite) {
-        if(!flipper_format_write_int32(
-               instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
+        bool ok = false;
+        if(instance->compact) {
+            ok = subghz_raw_varint_write(
+                flipper_format_get_raw_stream(instance->flipper_file),
+                instance->upload_raw,
+                instance->ind_write);
+        } else {
+            ok = flipper_format_write_int32(
+                instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write);
+        }
+        if(!ok) {
             FURI_LOG_E(TAG, "Unable to add RAW_Data");
         } else {
             instance->sample_write += instance->ind_write;
@@ -212,6 +229,15 @@ void subghz_protocol_raw_save_to_file_pause(SubGhzProtocolDecoderRAW* instance,
     }
 }
 
+void subghz_protocol_raw_save_to_file_set_compact(
+    SubGhzProtocolDecoderRAW* instance,
+    bool compact) {
+    furi_assert(instance);
+    furi_assert(instance->file_is_open != RAWFileIsOpenWrite);
+
+    instance->compact = compact;
+}
+
 size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance) {
     return instance->sample_write + instance->ind_write;
 }
@@ -223,6 +249,7 @@ void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     instance->upload_raw = NULL;
     instance->ind_write = 0;
     instance->last_level = false;
+    instance->compact = false;
     instance->file_is_open = RAWFileIsOpenClose;
     instance->file_name = furi_string_alloc();
 
@@ -35,6 +35,16 @@ bool subghz_protocol_raw_save_to_file_init(
  */
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance);
 
+/**
+ * Write next files in compact binary encoding, see SUBGHZ_RAW_ENCODING_VARINT.
+ * Must be set before subghz_protocol_raw_save_to_file_init.
+ * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
+ * @param compact true - zigzag varint durations, false - RAW_Data text lines
+ */
+void subghz_protocol_raw_save_to_file_set_compact(
+    SubGhzProtocolDecoderRAW* instance,
+    bool compact);
+
 /**
  * Get the number of samples received SubGhzProtocolDecoderRAW.
  * @param instance Pointer to a SubGhzProtocolDecoderRAW instance
@@ -20,6 +20,13 @@ static const SubGhzBlockConst subghz_protocol_scher_khan_const = {
     .min_count_bit_for_found = 35,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_scher_khan_start = {
+    .timing = &subghz_protocol_scher_khan_const,
+    .level = true,
+    .te_mult = 2,
+    .delta_mult = 1,
+};
+
 struct SubGhzProtocolDecoderScherKhan {
     SubGhzProtocolDecoderBase base;
 
@@ -55,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
     .deserialize = subghz_protocol_decoder_scher_khan_deserialize,
     .get_string = subghz_protocol_decoder_scher_khan_get_string,
+
+    .start = &subghz_protocol_scher_khan_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder = {
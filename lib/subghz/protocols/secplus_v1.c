@@ -32,6 +32,13 @@ static const SubGhzBlockConst subghz_protocol_secplus_v1_const = {
     .min_count_bit_for_found = 21,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_secplus_v1_start = {
+    .timing = &subghz_protocol_secplus_v1_const,
+    .level = false,
+    .te_mult = 120,
+    .delta_mult = 120,
+};
+
 struct SubGhzProtocolDecoderSecPlus_v1 {
     SubGhzProtocolDecoderBase base;
 
@@ -70,6 +77,8 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
+
+    .start = &subghz_protocol_secplus_v1_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
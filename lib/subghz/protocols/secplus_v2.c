@@ -30,6 +30,14 @@ static const SubGhzBlockConst subghz_protocol_secplus_v2_const = {
     .min_count_bit_for_found = 62,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_secplus_v2_start = {
+    .timing = &subghz_protocol_secplus_v2_const,
+    .level = false,
+    .te_long = true,
+    .te_mult = 130,
+    .delta_mult = 100,
+};
+
 struct SubGhzProtocolDecoderSecPlus_v2 {
     SubGhzProtocolDecoderBase base;
 
@@ -64,6 +72,8 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v2_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v2_get_string,
+
+    .start = &subghz_protocol_secplus_v2_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v2_encoder = {
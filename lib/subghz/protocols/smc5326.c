@@ -36,6 +36,13 @@ static const SubGhzBlockConst subghz_protocol_smc5326_const = {
     .min_count_bit_for_found = 25,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_smc5326_start = {
+    .timing = &subghz_protocol_smc5326_const,
+    .level = false,
+    .te_mult = 24,
+    .delta_mult = 12,
+};
+
 struct SubGhzProtocolDecoderSMC5326 {
     SubGhzProtocolDecoderBase base;
 
@@ -72,6 +79,8 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .serialize = subghz_protocol_decoder_smc5326_serialize,
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
+
+    .start = &subghz_protocol_smc5326_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
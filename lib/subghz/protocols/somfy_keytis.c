@@ -16,6 +16,13 @@ static const SubGhzBlockConst subghz_protocol_somfy_keytis_const = {
     .min_count_bit_for_found = 80,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_somfy_keytis_start = {
+    .timing = &subghz_protocol_somfy_keytis_const,
+    .level = true,
+    .te_mult = 4,
+    .delta_mult = 4,
+};
+
 struct SubGhzProtocolDecoderSomfyKeytis {
     SubGhzProtocolDecoderBase base;
 
@@ -53,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_keytis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_keytis_get_string,
+
+    .start = &subghz_protocol_somfy_keytis_start,
 };
 
 const SubGhzProtocol subghz_protocol_somfy_keytis = {
@@ -18,6 +18,13 @@ static const SubGhzBlockConst subghz_protocol_somfy_telis_const = {
     .min_count_bit_for_found = 56,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_somfy_telis_start = {
+    .timing = &subghz_protocol_somfy_telis_const,
+    .level = true,
+    .te_mult = 4,
+    .delta_mult = 4,
+};
+
 struct SubGhzProtocolDecoderSomfyTelis {
     SubGhzProtocolDecoderBase base;
 
@@ -54,6 +61,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_telis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_telis_get_string,
+
+    .start = &subghz_protocol_somfy_telis_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_telis_encoder = {
@@ -497,6 +497,33 @@ static inline bool subghz_protocol_star_line_check_decrypt(
     return false;
 }
 
+typedef struct {
+    SubGhzBlockGeneric* instance;
+    uint8_t btn;
+    uint16_t end_serial;
+} SubGhzProtocolStarLineSearchContext;
+
+static bool subghz_protocol_star_line_search_check(
+    const SubGhzKey* key,
+    SubGhzKeeloqVariant variant,
+    uint32_t decrypt,
+    void* context) {
+    UNUSED(key);
+    UNUSED(variant);
+    SubGhzProtocolStarLineSearchContext* search = context;
+    return subghz_protocol_star_line_check_decrypt(
+        search->instance, decrypt, search->btn, search->end_serial);
+}
+
+// Derivations tried for each learning type
+static const uint16_t subghz_protocol_star_line_search_variants[KEELOQ_LEARNING_TYPE_COUNT] = {
+    [KEELOQ_LEARNING_UNKNOWN] = SubGhzKeeloqVariantSimple | SubGhzKeeloqVariantSimpleMirrored |
+                                SubGhzKeeloqVariantNormal | SubGhzKeeloqVariantNormalMirrored,
+    [KEELOQ_LEARNING_SIMPLE] = SubGhzKeeloqVariantSimple,
+    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+    [KEELOQ_LEARNING_NORMAL] = SubGhzKeeloqVariantNormal,
+};
+
 /** 
  * Checking the accepted code against the database manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -512,11 +539,11 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     uint32_t hop,
     SubGhzKeystore* keystore,
     const char** manufacture_name) {
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 24);
-    uint32_t decrypt = 0;
-    uint64_t man_normal_learning;
-    bool mf_not_set = false;
+    SubGhzProtocolStarLineSearchContext search = {
+        .instance = instance,
+        .btn = (uint8_t)(fix >> 24),
+        .end_serial = (uint16_t)(fix & 0xFF),
+    };
     // TODO:
     // if(mfname == 0x0) {
     //     mfname = "";
@@ -527,88 +554,29 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
     if(strcmp(mfname, "Unknown") == 0) {
         return 1;
     } else if(strcmp(mfname, "") == 0) {
-        mf_not_set = true;
+        // Not set, search over all keys
+        mfname = NULL;
     }
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            if(mf_not_set || (strcmp(furi_string_get_cstr(manufacture_code->name), mfname) == 0)) {
-                switch(manufacture_code->type) {
-                case KEELOQ_LEARNING_SIMPLE:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_NORMAL:
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        return 1;
-                    }
-                    break;
-                case KEELOQ_LEARNING_UNKNOWN:
-                    // Simple Learning
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    uint64_t man_rev = 0;
-                    uint64_t man_rev_byte = 0;
-                    for(uint8_t i = 0; i < 64; i += 8) {
-                        man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                        man_rev = man_rev | man_rev_byte << (56 - i);
-                    }
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 1;
-                        return 1;
-                    }
-                    //###########################
-                    // Normal Learning
-                    // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-                    // Check for mirrored man
-                    man_normal_learning =
-                        subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                    decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
-                    if(subghz_protocol_star_line_check_decrypt(
-                           instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        keystore->mfname = *manufacture_name;
-                        keystore->kl_type = 2;
-                        return 1;
-                    }
-                    break;
-                }
-            }
+
+    SubGhzKeeloqVariant variant;
+    const SubGhzKey* manufacture_code = subghz_protocol_keeloq_common_search(
+        keystore,
+        mfname,
+        subghz_protocol_star_line_search_variants,
+        fix,
+        instance->seed,
+        hop,
+        subghz_protocol_star_line_search_check,
+        &search,
+        &variant);
+    if(manufacture_code) {
+        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+        keystore->mfname = *manufacture_name;
+        if(manufacture_code->type == KEELOQ_LEARNING_UNKNOWN) {
+            keystore->kl_type = subghz_protocol_keeloq_common_get_learning_type(variant);
         }
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     keystore->mfname = "Unknown";
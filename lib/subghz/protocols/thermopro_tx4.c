@@ -33,6 +33,13 @@ static const SubGhzBlockConst ws_protocol_thermopro_tx4_const = {
     .min_count_bit_for_found = 37,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_thermopro_tx4_start = {
+    .timing = &ws_protocol_thermopro_tx4_const,
+    .level = false,
+    .te_mult = 18,
+    .delta_mult = 10,
+};
+
 struct WSProtocolDecoderThermoPRO_TX4 {
     SubGhzProtocolDecoderBase base;
 
@@ -64,6 +71,8 @@ const SubGhzProtocolDecoder ws_protocol_thermopro_tx4_decoder = {
     .serialize = ws_protocol_decoder_thermopro_tx4_serialize,
     .deserialize = ws_protocol_decoder_thermopro_tx4_deserialize,
     .get_string = ws_protocol_decoder_thermopro_tx4_get_string,
+
+    .start = &ws_protocol_thermopro_tx4_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_thermopro_tx4_encoder = {
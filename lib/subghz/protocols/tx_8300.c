@@ -41,6 +41,13 @@ static const SubGhzBlockConst ws_protocol_tx_8300_const = {
     .min_count_bit_for_found = 72,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_tx_8300_start = {
+    .timing = &ws_protocol_tx_8300_const,
+    .level = true,
+    .te_mult = 2,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderTX_8300 {
     SubGhzProtocolDecoderBase base;
 
@@ -75,6 +82,8 @@ const SubGhzProtocolDecoder ws_protocol_tx_8300_decoder = {
     .serialize = ws_protocol_decoder_tx_8300_serialize,
     .deserialize = ws_protocol_decoder_tx_8300_deserialize,
     .get_string = ws_protocol_decoder_tx_8300_get_string,
+
+    .start = &ws_protocol_tx_8300_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_tx_8300_encoder = {
@@ -35,6 +35,13 @@ static const SubGhzBlockConst ws_protocol_wendox_w6726_const = {
     .min_count_bit_for_found = 29,
 };
 
+static const SubGhzProtocolDecoderStart ws_protocol_wendox_w6726_start = {
+    .timing = &ws_protocol_wendox_w6726_const,
+    .level = true,
+    .te_mult = 1,
+    .delta_mult = 1,
+};
+
 struct WSProtocolDecoderWendoxW6726 {
     SubGhzProtocolDecoderBase base;
 
@@ -69,6 +76,8 @@ const SubGhzProtocolDecoder ws_protocol_wendox_w6726_decoder = {
     .serialize = ws_protocol_decoder_wendox_w6726_serialize,
     .deserialize = ws_protocol_decoder_wendox_w6726_deserialize,
     .get_string = ws_protocol_decoder_wendox_w6726_get_string,
+
+    .start = &ws_protocol_wendox_w6726_start,
 };
 
 const SubGhzProtocolEncoder ws_protocol_wendox_w6726_encoder = {
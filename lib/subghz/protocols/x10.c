@@ -47,6 +47,13 @@ static const SubGhzBlockConst subghz_protocol_x10_const = {
     .min_count_bit_for_found = 32,
 };
 
+static const SubGhzProtocolDecoderStart subghz_protocol_x10_start = {
+    .timing = &subghz_protocol_x10_const,
+    .level = true,
+    .te_mult = 16,
+    .delta_mult = 7,
+};
+
 struct SubGhzProtocolDecoderX10 {
     SubGhzProtocolDecoderBase base;
     SubGhzBlockDecoder decoder;
@@ -75,6 +82,8 @@ const SubGhzProtocolDecoder subghz_protocol_x10_decoder = {
     .serialize = subghz_protocol_decoder_x10_serialize,
     .deserialize = subghz_protocol_decoder_x10_deserialize,
     .get_string = subghz_protocol_decoder_x10_get_string,
+
+    .start = &subghz_protocol_x10_start,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_x10_encoder = {
@@ -2,24 +2,96 @@
 
 #include "registry.h"
 #include "protocols/protocol_items.h"
+#include "blocks/decoder.h"
 
 #include <m-array.h>
+#include <toolbox/trace.h>
+
+/* Duration index: pulses are split into buckets by level and duration,
+ * each bucket holds mask of decoders whose start pulse can fall into it.
+ * Pulses longer than covered range go to the last bucket. */
+#define SUBGHZ_RECEIVER_BUCKET_SHIFT (8U)
+#define SUBGHZ_RECEIVER_BUCKET_COUNT (64U)
+#define SUBGHZ_RECEIVER_MASK_BITS (32U)
 
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+
+    // Start pulse, valid if indexed
+    bool indexed;
+    bool start_level;
+    uint32_t start_min;
+    uint32_t start_max;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
 #define M_OPL_SubGhzReceiverSlotArray_t() ARRAY_OPLIST(SubGhzReceiverSlotArray, M_POD_OPLIST)
 
+/* Head of decoders declaring SubGhzProtocolDecoderStart */
+typedef struct {
+    SubGhzProtocolDecoderBase base;
+    SubGhzBlockDecoder decoder;
+} SubGhzReceiverIndexedDecoder;
+
 struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
 
+    // Slot masks, mask_size words each
+    size_t mask_size;
+    uint32_t* masks;
+    uint32_t* filtered; // passing filter
+    uint32_t* unindexed; // fed with every pulse
+    uint32_t* active; // indexed and not in reset step
+    uint32_t* buckets; // [level][bucket]
+
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static inline uint32_t* subghz_receiver_get_bucket(
+    SubGhzReceiver* instance,
+    bool level,
+    uint32_t bucket) {
+    return &instance->buckets
+                [((level ? SUBGHZ_RECEIVER_BUCKET_COUNT : 0) + bucket) * instance->mask_size];
+}
+
+static inline uint32_t subghz_receiver_get_bucket_index(uint32_t duration) {
+    uint32_t bucket = duration >> SUBGHZ_RECEIVER_BUCKET_SHIFT;
+    return MIN(bucket, SUBGHZ_RECEIVER_BUCKET_COUNT - 1);
+}
+
+static void subghz_receiver_index_slot(SubGhzReceiver* instance, size_t index) {
+    SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, index);
+    const SubGhzProtocolDecoderStart* start = slot->base->protocol->decoder->start;
+    const size_t word = index / SUBGHZ_RECEIVER_MASK_BITS;
+    const uint32_t bit = 1UL << (index % SUBGHZ_RECEIVER_MASK_BITS);
+
+    if(!start) {
+        slot->indexed = false;
+        instance->unindexed[word] |= bit;
+        return;
+    }
+
+    // Same window as DURATION_DIFF(duration, te) < delta in decoder reset step
+    const uint32_t te = (uint32_t)(start->te_long ? start->timing->te_long :
+                                                    start->timing->te_short) *
+                        start->te_mult;
+    const uint32_t delta = (uint32_t)start->timing->te_delta * start->delta_mult;
+
+    slot->indexed = true;
+    slot->start_level = start->level;
+    slot->start_min = (te >= delta) ? (te - delta + 1) : 0;
+    slot->start_max = te + delta - 1;
+
+    const uint32_t bucket_min = subghz_receiver_get_bucket_index(slot->start_min);
+    const uint32_t bucket_max = subghz_receiver_get_bucket_index(slot->start_max);
+    for(uint32_t bucket = bucket_min; bucket <= bucket_max; bucket++) {
+        subghz_receiver_get_bucket(instance, slot->start_level, bucket)[word] |= bit;
+    }
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -36,6 +108,23 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         }
     }
 
+    // Build duration index
+    const size_t slot_count = SubGhzReceiverSlotArray_size(instance->slots);
+    instance->mask_size = (slot_count + SUBGHZ_RECEIVER_MASK_BITS - 1) / SUBGHZ_RECEIVER_MASK_BITS;
+    const size_t masks_size =
+        sizeof(uint32_t) * instance->mask_size * (3 + SUBGHZ_RECEIVER_BUCKET_COUNT * 2);
+    instance->masks = malloc(masks_size);
+    memset(instance->masks, 0, masks_size);
+    instance->filtered = instance->masks;
+    instance->unindexed = instance->filtered + instance->mask_size;
+    instance->active = instance->unindexed + instance->mask_size;
+    instance->buckets = instance->active + instance->mask_size;
+
+    for(size_t i = 0; i < slot_count; ++i) {
+        subghz_receiver_index_slot(instance, i);
+    }
+
+    instance->filter = 0;
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -55,19 +144,52 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
 
+    free(instance->masks);
     free(instance);
 }
 
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
     furi_assert(instance);
     furi_assert(instance->slots);
+    trace_begin(TraceProbeSubGhzDecode);
 
-    for
-        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
+    const uint32_t* bucket = subghz_receiver_get_bucket(
+        instance, level, subghz_receiver_get_bucket_index(duration));
+
+    for(size_t word = 0; word < instance->mask_size; word++) {
+        uint32_t candidates = instance->filtered[word] &
+                              (instance->unindexed[word] | instance->active[word] | bucket[word]);
+
+        while(candidates) {
+            const uint32_t bit = candidates & -candidates;
+            const size_t index = word * SUBGHZ_RECEIVER_MASK_BITS + __builtin_ctz(candidates);
+            candidates &= ~bit;
+
+            SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, index);
+            if(!slot->indexed) {
                 slot->base->protocol->decoder->feed(slot->base, level, duration);
+                continue;
+            }
+
+            // Bucket is coarse, idle decoder only needs its exact start pulse
+            if(!(instance->active[word] & bit) &&
+               (level != slot->start_level || duration < slot->start_min ||
+                duration > slot->start_max)) {
+                continue;
+            }
+
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
+
+            const SubGhzReceiverIndexedDecoder* decoder = (void*)slot->base;
+            if(decoder->decoder.parser_step) {
+                instance->active[word] |= bit;
+            } else {
+                instance->active[word] &= ~bit;
             }
         }
+    }
+
+    trace_end(TraceProbeSubGhzDecode);
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -78,6 +200,7 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+    memset(instance->active, 0, sizeof(uint32_t) * instance->mask_size);
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
@@ -106,6 +229,15 @@ void subghz_receiver_set_rx_callback(
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter) {
     furi_assert(instance);
     instance->filter = filter;
+
+    memset(instance->filtered, 0, sizeof(uint32_t) * instance->mask_size);
+    for(size_t i = 0; i < SubGhzReceiverSlotArray_size(instance->slots); ++i) {
+        const SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_cget(instance->slots, i);
+        if((slot->base->protocol->flag & filter) != 0) {
+            instance->filtered[i / SUBGHZ_RECEIVER_MASK_BITS] |=
+                1UL << (i % SUBGHZ_RECEIVER_MASK_BITS);
+        }
+    }
 }
 
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
@@ -1,4 +1,6 @@
 #include "subghz_file_encoder_worker.h"
+#include "subghz_raw_varint.h"
+#include "types.h"
 
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
@@ -22,6 +24,8 @@ struct SubGhzFileEncoderWorker {
     FuriString* str_data;
     FuriString* file_path;
     const SubGhzDevice* device;
+    // Set for compact RAW files
+    SubGhzRawVarintReader* varint_reader;
 
     SubGhzFileEncoderWorkerCallbackEnd callback_end;
     void* context_end;
@@ -81,6 +85,41 @@ bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, co
     return res;
 }
 
+static bool subghz_file_encoder_worker_data_parse_varint(SubGhzFileEncoderWorker* instance) {
+    int32_t duration = 0;
+    size_t count = 0;
+
+    // Same amount per step as one text line
+    while(count < SUBGHZ_FILE_ENCODER_LOAD &&
+          subghz_raw_varint_reader_read(instance->varint_reader, &duration)) {
+        if((duration < -1000000) || (duration > 1000000)) {
+            duration = (duration > 0) ? 100 : -100;
+        }
+        subghz_file_encoder_worker_add_level_duration(instance, duration);
+        count++;
+    }
+
+    return count > 0;
+}
+
+static bool subghz_file_encoder_worker_read_encoding(SubGhzFileEncoderWorker* instance) {
+    Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
+    size_t data_start = stream_tell(stream);
+
+    // Line right after Protocol tells compact RAW from text
+    if(stream_read_line(stream, instance->str_data)) {
+        furi_string_trim(instance->str_data);
+        if(furi_string_cmp_str(
+               instance->str_data, SUBGHZ_RAW_ENCODING_KEY ": " SUBGHZ_RAW_ENCODING_VARINT) ==
+           0) {
+            instance->varint_reader = subghz_raw_varint_reader_alloc(stream);
+            return true;
+        }
+    }
+
+    return stream_seek(stream, data_start, StreamOffsetFromStart);
+}
+
 void subghz_file_encoder_worker_get_text_progress(
     SubGhzFileEncoderWorker* instance,
     FuriString* output) {
@@ -143,6 +182,10 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
 
         //skip the end of the previous line "\n"
         stream_seek(stream, 1, StreamOffsetFromCurrent);
+        if(!subghz_file_encoder_worker_read_encoding(instance)) {
+            FURI_LOG_E(TAG, "Unable to read data");
+            break;
+        }
         res = true;
         instance->worker_stopping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -151,7 +194,12 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
+            if(instance->varint_reader) {
+                if(!subghz_file_encoder_worker_data_parse_varint(instance)) {
+                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                    break;
+                }
+            } else if(stream_read_line(stream, instance->str_data)) {
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
@@ -184,6 +232,10 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         }
         furi_delay_ms(50);
     }
+    if(instance->varint_reader) {
+        subghz_raw_varint_reader_free(instance->varint_reader);
+        instance->varint_reader = NULL;
+    }
     flipper_format_file_close(instance->flipper_format);
 
     FURI_LOG_I(TAG, "Worker stop");
@@ -202,6 +254,7 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc() {
 
     instance->str_data = furi_string_alloc();
     instance->file_path = furi_string_alloc();
+    instance->varint_reader = NULL;
     instance->worker_stopping = true;
 
     return instance;
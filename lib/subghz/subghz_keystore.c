@@ -31,6 +31,9 @@ SubGhzKeystore* subghz_keystore_alloc() {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    instance->index_by_name = NULL;
+    instance->index_by_type = NULL;
+    instance->index_size = 0;
 
     subghz_keystore_reset_kl(instance);
 
@@ -54,9 +57,131 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
         }
     SubGhzKeyArray_clear(instance->data);
 
+    free(instance->index_by_name);
+    free(instance->index_by_type);
     free(instance);
 }
 
+static uint32_t subghz_keystore_name_hash(const char* name) {
+    // FNV-1a
+    uint32_t hash = 0x811C9DC5;
+    while(*name) {
+        hash ^= (uint8_t)*name++;
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+static int subghz_keystore_index_item_cmp(const void* a, const void* b) {
+    const SubGhzKeystoreIndexItem* item_a = a;
+    const SubGhzKeystoreIndexItem* item_b = b;
+    if(item_a->key != item_b->key) return item_a->key < item_b->key ? -1 : 1;
+    if(item_a->position != item_b->position) return item_a->position < item_b->position ? -1 : 1;
+    return 0;
+}
+
+static void subghz_keystore_index_build(SubGhzKeystore* instance) {
+    size_t size = SubGhzKeyArray_size(instance->data);
+
+    free(instance->index_by_name);
+    free(instance->index_by_type);
+    instance->index_by_name = malloc(sizeof(SubGhzKeystoreIndexItem) * size);
+    instance->index_by_type = malloc(sizeof(SubGhzKeystoreIndexItem) * size);
+    instance->index_size = size;
+
+    for(size_t i = 0; i < size; i++) {
+        const SubGhzKey* manufacture_code = SubGhzKeyArray_cget(instance->data, i);
+        instance->index_by_name[i].key =
+            subghz_keystore_name_hash(furi_string_get_cstr(manufacture_code->name));
+        instance->index_by_name[i].position = i;
+        instance->index_by_type[i].key = manufacture_code->type;
+        instance->index_by_type[i].position = i;
+    }
+
+    // Position is a part of the sort key: keystore order is kept for equal keys
+    qsort(
+        instance->index_by_name,
+        size,
+        sizeof(SubGhzKeystoreIndexItem),
+        subghz_keystore_index_item_cmp);
+    qsort(
+        instance->index_by_type,
+        size,
+        sizeof(SubGhzKeystoreIndexItem),
+        subghz_keystore_index_item_cmp);
+}
+
+static size_t subghz_keystore_index_lower_bound(
+    const SubGhzKeystoreIndexItem* index,
+    size_t size,
+    uint32_t key) {
+    size_t low = 0;
+    size_t high = size;
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        if(index[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+const SubGhzKey*
+    subghz_keystore_get_next_key(SubGhzKeystore* instance, const char* name, size_t* cursor) {
+    furi_assert(instance);
+    furi_assert(cursor);
+
+    if(!name) {
+        // Cursor is a position in data
+        if(*cursor >= SubGhzKeyArray_size(instance->data)) return NULL;
+        return SubGhzKeyArray_cget(instance->data, (*cursor)++);
+    }
+
+    // Cursor is a position in index plus one, 0 means not started
+    uint32_t hash = subghz_keystore_name_hash(name);
+    size_t i = *cursor;
+    if(i == 0) {
+        i = subghz_keystore_index_lower_bound(instance->index_by_name, instance->index_size, hash);
+    } else {
+        i--;
+    }
+
+    for(; i < instance->index_size && instance->index_by_name[i].key == hash; i++) {
+        const SubGhzKey* manufacture_code =
+            SubGhzKeyArray_cget(instance->data, instance->index_by_name[i].position);
+        if(strcmp(furi_string_get_cstr(manufacture_code->name), name) == 0) {
+            *cursor = i + 2;
+            return manufacture_code;
+        }
+    }
+
+    *cursor = instance->index_size + 1;
+    return NULL;
+}
+
+const SubGhzKey*
+    subghz_keystore_get_next_key_by_type(SubGhzKeystore* instance, uint16_t type, size_t* cursor) {
+    furi_assert(instance);
+    furi_assert(cursor);
+
+    size_t i = *cursor;
+    if(i == 0) {
+        i = subghz_keystore_index_lower_bound(instance->index_by_type, instance->index_size, type);
+    } else {
+        i--;
+    }
+
+    if(i < instance->index_size && instance->index_by_type[i].key == type) {
+        *cursor = i + 2;
+        return SubGhzKeyArray_cget(instance->data, instance->index_by_type[i].position);
+    }
+
+    *cursor = instance->index_size + 1;
+    return NULL;
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
@@ -91,6 +216,7 @@ static void subghz_keystore_mess_with_iv(uint8_t* iv) {
     // Sharing them will bring some discomfort to legal owners
     // And potential legal action against you
     // While you reading this code think about your own personal responsibility
+#ifndef FURI_HOST
     asm volatile("nani%=:                  \n"
                  "ldrd  r0, r2, [%0, #0x0] \n"
                  "lsl   r1, r0, #8         \n"
@@ -110,6 +236,10 @@ static void subghz_keystore_mess_with_iv(uint8_t* iv) {
                  :
                  : "r"(iv)
                  : "r0", "r1", "r2", "r3", "memory");
+#else
+    // There is no secure enclave on host, encrypted keystores can't be loaded anyway
+    UNUSED(iv);
+#endif
 }
 
 static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream, uint8_t* iv) {
@@ -246,6 +376,9 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
 
     furi_string_free(filetype);
 
+    // Keys may be appended even on partial failure, keep index in sync anyway
+    subghz_keystore_index_build(instance);
+
     return result;
 }
 
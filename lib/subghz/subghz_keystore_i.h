@@ -1,9 +1,42 @@
 #pragma once
 
+#include "subghz_keystore.h"
+
 #include <m-array.h>
 
+typedef struct {
+    uint32_t key; /**< Name hash or learning type */
+    uint32_t position; /**< Key position in SubGhzKeystore data */
+} SubGhzKeystoreIndexItem;
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
     const char* mfname;
     uint8_t kl_type;
+
+    // Lookup tables over data, rebuilt on every load
+    SubGhzKeystoreIndexItem* index_by_name;
+    SubGhzKeystoreIndexItem* index_by_type;
+    size_t index_size;
 };
+
+/**
+ * Iterate over keys with given manufacture name, in keystore order.
+ * Lookup is a binary search over name hashes, no string compare for foreign keys.
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param name Manufacture name, NULL to iterate over all keys
+ * @param cursor Iteration state, must be set to 0 before the first call
+ * @return const SubGhzKey* next key or NULL if there is no more keys
+ */
+const SubGhzKey*
+    subghz_keystore_get_next_key(SubGhzKeystore* instance, const char* name, size_t* cursor);
+
+/**
+ * Iterate over keys of given learning type, in keystore order.
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param type Learning type, KEELOQ_LEARNING_*
+ * @param cursor Iteration state, must be set to 0 before the first call
+ * @return const SubGhzKey* next key or NULL if there is no more keys
+ */
+const SubGhzKey*
+    subghz_keystore_get_next_key_by_type(SubGhzKeystore* instance, uint16_t type, size_t* cursor);
@@ -0,0 +1,70 @@
+#include "subghz_raw_varint.h"
+
+#include <furi.h>
+#include <toolbox/varint.h>
+
+#define SUBGHZ_RAW_VARINT_MAX_SIZE 5
+#define SUBGHZ_RAW_VARINT_BUFFER_SIZE 64
+
+struct SubGhzRawVarintReader {
+    Stream* stream;
+    uint8_t buffer[SUBGHZ_RAW_VARINT_BUFFER_SIZE];
+    size_t size;
+    size_t position;
+};
+
+bool subghz_raw_varint_write(Stream* stream, const int32_t* data, size_t count) {
+    furi_assert(stream);
+    uint8_t buffer[SUBGHZ_RAW_VARINT_BUFFER_SIZE];
+    size_t size = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        size += varint_int32_pack(data[i], &buffer[size]);
+        if(size > SUBGHZ_RAW_VARINT_BUFFER_SIZE - SUBGHZ_RAW_VARINT_MAX_SIZE || i == count - 1) {
+            if(stream_write(stream, buffer, size) != size) return false;
+            size = 0;
+        }
+    }
+
+    return true;
+}
+
+SubGhzRawVarintReader* subghz_raw_varint_reader_alloc(Stream* stream) {
+    furi_assert(stream);
+    SubGhzRawVarintReader* instance = malloc(sizeof(SubGhzRawVarintReader));
+    instance->stream = stream;
+    instance->size = 0;
+    instance->position = 0;
+    return instance;
+}
+
+void subghz_raw_varint_reader_free(SubGhzRawVarintReader* instance) {
+    furi_assert(instance);
+    free(instance);
+}
+
+bool subghz_raw_varint_reader_read(SubGhzRawVarintReader* instance, int32_t* duration) {
+    furi_assert(instance);
+    furi_assert(duration);
+
+    size_t available = instance->size - instance->position;
+    if(available < SUBGHZ_RAW_VARINT_MAX_SIZE) {
+        // Refill, keeping the tail: varint may cross the buffer boundary
+        memmove(instance->buffer, &instance->buffer[instance->position], available);
+        instance->position = 0;
+        instance->size = available + stream_read(
+                                         instance->stream,
+                                         &instance->buffer[available],
+                                         SUBGHZ_RAW_VARINT_BUFFER_SIZE - available);
+        available = instance->size;
+    }
+
+    if(!available) return false;
+
+    size_t size = varint_int32_unpack(duration, &instance->buffer[instance->position], available);
+    // Truncated at the end of file
+    if(size > available) return false;
+    instance->position += size;
+
+    return *duration != 0;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Compact RAW_Data encoding: durations (negative for low level) stored as
+ * zigzag varints, 2-3 bytes each instead of 5-8 bytes of decimal text.
+ */
+
+typedef struct SubGhzRawVarintReader SubGhzRawVarintReader;
+
+/** 
+ * Write durations to stream.
+ * @param stream Pointer to a Stream instance
+ * @param data Durations, negative for low level
+ * @param count Number of durations
+ * @return true On success
+ */
+bool subghz_raw_varint_write(Stream* stream, const int32_t* data, size_t count);
+
+/** 
+ * Allocate SubGhzRawVarintReader.
+ * @param stream Pointer to a Stream instance, positioned at the first duration
+ * @return SubGhzRawVarintReader* pointer to a SubGhzRawVarintReader instance
+ */
+SubGhzRawVarintReader* subghz_raw_varint_reader_alloc(Stream* stream);
+
+/** 
+ * Free SubGhzRawVarintReader.
+ * @param instance Pointer to a SubGhzRawVarintReader instance
+ */
+void subghz_raw_varint_reader_free(SubGhzRawVarintReader* instance);
+
+/** 
+ * Read next duration.
+ * @param instance Pointer to a SubGhzRawVarintReader instance
+ * @param duration Duration, negative for low level
+ * @return false on end of data or malformed data
+ */
+bool subghz_raw_varint_reader_read(SubGhzRawVarintReader* instance, int32_t* duration);
+
+#ifdef __cplusplus
+}
+#endif
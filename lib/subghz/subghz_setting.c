@@ -203,6 +203,8 @@ void subghz_setting_load(SubGhzSetting* instance, const char* file_path) {
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* fff_data_file = flipper_format_file_alloc(storage);
+    // Every list is read with a separate pass from the start of the file
+    flipper_format_set_key_index(fff_data_file, true);
 
     FuriString* temp_str;
     temp_str = furi_string_alloc();
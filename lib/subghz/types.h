@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -21,6 +22,9 @@
 
 #define SUBGHZ_RAW_FILE_VERSION 1
 #define SUBGHZ_RAW_FILE_TYPE "Flipper SubGhz RAW File"
+// Compact RAW: this line follows Protocol, then zigzag varint durations up to the end of file
+#define SUBGHZ_RAW_ENCODING_KEY "RAW_Encoding"
+#define SUBGHZ_RAW_ENCODING_VARINT "Varint"
 
 #define SUBGHZ_KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define SUBGHZ_KEYSTORE_DIR_USER_NAME EXT_PATH("subghz/assets/keeloq_mfcodes_user")
@@ -85,6 +89,24 @@ typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
 
+/**
+ * Pulse that takes decoder out of its reset step:
+ * level matches and duration is within (te * te_mult) +- (te_delta * delta_mult),
+ * where te is te_long or te_short of timing.
+ *
+ * Used by SubGhzReceiver to skip feeding idle decoders with pulses they ignore.
+ * Declaring it is a promise that:
+ * - decoder instance starts with SubGhzProtocolDecoderBase followed by SubGhzBlockDecoder
+ * - reset step is parser_step 0 and it reacts on this pulse only, nothing else is touched
+ */
+typedef struct {
+    const SubGhzBlockConst* timing;
+    bool level;
+    bool te_long;
+    uint8_t te_mult;
+    uint8_t delta_mult;
+} SubGhzProtocolDecoderStart;
+
 typedef struct {
     SubGhzAlloc alloc;
     SubGhzFree free;
@@ -96,6 +118,8 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    const SubGhzProtocolDecoderStart* start; // Optional
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -5,14 +5,55 @@
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/stream/buffered_file_stream.h>
 #include <toolbox/args.h>
+#include <toolbox/crc32_calc.h>
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_MAGIC (0x5844444BUL) // "KDDX"
+#define KEYS_DICT_INDEX_VERSION (1)
+// Heap left to the rest of the system while keys are sorted
+#define KEYS_DICT_INDEX_HEAP_RESERVE (8 * 1024)
+// Keys added after index was built, looked up in memory until index is rebuilt
+#define KEYS_DICT_INDEX_PENDING_MAX (64)
+
+/*
+ * Index file layout:
+ * - KeysDictIndexHeader
+ * - total_keys keys in text file order, used for iteration
+ * - unique_keys keys sorted by memcmp, used for lookup
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint32_t total_keys;
+    uint32_t unique_keys;
+} KeysDictIndexHeader;
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    Storage* storage;
+    FuriString* path;
+    // NULL if index is not available, text file is used for everything then
+    File* index;
+    // Index matches text file, except for pending keys
+    bool index_valid;
+    // Index was built in this session, text file stamp is taken again after close
+    bool index_built;
+    size_t index_keys;
+    size_t unique_keys;
+    // Appended to text file since index was built
+    uint8_t* pending_keys;
+    size_t pending_count;
+    // Logical position in text file order, in keys
+    size_t position;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -52,6 +93,402 @@ static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool*
     return false;
 }
 
+static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, FuriString* key_str) {
+    furi_assert(instance);
+    furi_assert(key_str);
+    furi_assert(key_int);
+
+    furi_string_reset(key_str);
+
+    for(size_t i = 0; i < instance->key_size; i++)
+        furi_string_cat_printf(key_str, "%02X", key_int[i]);
+}
+
+static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint8_t* key_int) {
+    furi_assert(instance);
+    furi_assert(key_str);
+    furi_assert(key_int);
+
+    char h, l;
+
+    for(size_t i = 0; i < instance->key_size; i++) {
+        h = furi_string_get_char(key_str, i * 2);
+        l = furi_string_get_char(key_str, i * 2 + 1);
+
+        args_char_to_hex(h, l, &key_int[i]);
+    }
+}
+
+static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
+    furi_assert(instance);
+    furi_assert(instance->stream);
+    furi_assert(key);
+
+    bool key_read = false;
+    bool is_endfile = false;
+
+    furi_string_reset(key);
+
+    while(!key_read && !is_endfile) key_read = keys_dict_read_key_line(instance, key, &is_endfile);
+
+    return key_read;
+}
+
+static bool keys_dict_get_next_key_text(KeysDict* instance, uint8_t* key) {
+    FuriString* temp_key = furi_string_alloc();
+
+    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
+
+    if(key_read) {
+        keys_dict_str_to_int(instance, temp_key, key);
+    }
+
+    furi_string_free(temp_key);
+    return key_read;
+}
+
+static void keys_dict_swap(uint8_t* a, uint8_t* b, size_t size) {
+    while(size--) {
+        uint8_t tmp = *a;
+        *a++ = *b;
+        *b++ = tmp;
+    }
+}
+
+static void
+    keys_dict_sift_down(uint8_t* keys, size_t key_size, size_t root, size_t keys_count) {
+    while(root * 2 + 1 < keys_count) {
+        size_t child = root * 2 + 1;
+        if(child + 1 < keys_count &&
+           memcmp(&keys[child * key_size], &keys[(child + 1) * key_size], key_size) < 0) {
+            child++;
+        }
+        if(memcmp(&keys[root * key_size], &keys[child * key_size], key_size) >= 0) break;
+        keys_dict_swap(&keys[root * key_size], &keys[child * key_size], key_size);
+        root = child;
+    }
+}
+
+// Heap sort: in place, no recursion and no qsort context for the key size
+static void keys_dict_sort(uint8_t* keys, size_t key_size, size_t keys_count) {
+    for(size_t i = keys_count / 2; i-- > 0;) {
+        keys_dict_sift_down(keys, key_size, i, keys_count);
+    }
+    for(size_t end = keys_count; end-- > 1;) {
+        keys_dict_swap(keys, &keys[end * key_size], key_size);
+        keys_dict_sift_down(keys, key_size, 0, end);
+    }
+}
+
+static size_t keys_dict_unique(uint8_t* keys, size_t key_size, size_t keys_count) {
+    size_t unique = 0;
+
+    for(size_t i = 0; i < keys_count; i++) {
+        if(unique == 0 ||
+           memcmp(&keys[(unique - 1) * key_size], &keys[i * key_size], key_size) != 0) {
+            if(unique != i) memcpy(&keys[unique * key_size], &keys[i * key_size], key_size);
+            unique++;
+        }
+    }
+
+    return unique;
+}
+
+static size_t keys_dict_lower_bound(
+    const uint8_t* keys,
+    size_t key_size,
+    size_t keys_count,
+    const uint8_t* key) {
+    size_t low = 0;
+    size_t high = keys_count;
+
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        if(memcmp(&keys[mid * key_size], key, key_size) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static size_t keys_dict_index_offset(KeysDict* instance, bool sorted, size_t position) {
+    size_t offset = sizeof(KeysDictIndexHeader);
+    if(sorted) offset += instance->index_keys * instance->key_size;
+    return offset + position * instance->key_size;
+}
+
+static void keys_dict_index_source_stamp(KeysDict* instance, KeysDictIndexHeader* header) {
+    header->key_size = instance->key_size;
+    header->version = KEYS_DICT_INDEX_VERSION;
+    header->source_size = stream_size(instance->stream);
+    if(storage_common_timestamp(
+           instance->storage, furi_string_get_cstr(instance->path), &header->source_timestamp) !=
+       FSE_OK) {
+        header->source_timestamp = 0;
+    }
+}
+
+// Text file gets its final size and modification time on close, stamp is updated after it
+static void keys_dict_index_restamp(KeysDict* instance) {
+    const char* path = furi_string_get_cstr(instance->path);
+    KeysDictIndexHeader header = {0};
+    FileInfo info = {0};
+    uint32_t timestamp = 0;
+
+    if(storage_common_stat(instance->storage, path, &info) != FSE_OK) return;
+    if(storage_common_timestamp(instance->storage, path, &timestamp) != FSE_OK) return;
+
+    if(!storage_file_seek(instance->index, 0, true)) return;
+    if(storage_file_read(instance->index, &header, sizeof(header)) != sizeof(header)) return;
+    if(header.magic != KEYS_DICT_INDEX_MAGIC) return;
+
+    header.source_size = info.size;
+    header.source_timestamp = timestamp;
+    if(storage_file_seek(instance->index, 0, true)) {
+        storage_file_write(instance->index, &header, sizeof(header));
+    }
+}
+
+static bool keys_dict_index_build(KeysDict* instance) {
+    FuriString* line = furi_string_alloc();
+    uint8_t* keys = NULL;
+    bool is_endfile = false;
+    bool index_built = false;
+
+    do {
+        size_t total_keys = 0;
+
+        stream_rewind(instance->stream);
+        while(!is_endfile) {
+            if(keys_dict_read_key_line(instance, line, &is_endfile)) total_keys++;
+        }
+
+        size_t keys_size = total_keys * instance->key_size;
+        if(keys_size + KEYS_DICT_INDEX_HEAP_RESERVE > memmgr_heap_get_max_free_block()) {
+            FURI_LOG_W(TAG, "Not enough memory to index %zu keys", total_keys);
+            break;
+        }
+
+        if(total_keys) keys = malloc(keys_size);
+
+        stream_rewind(instance->stream);
+        size_t keys_read = 0;
+        while(keys_read < total_keys &&
+              keys_dict_get_next_key_text(instance, &keys[keys_read * instance->key_size])) {
+            keys_read++;
+        }
+        if(keys_read != total_keys) {
+            FURI_LOG_E(TAG, "Read %zu of %zu keys", keys_read, total_keys);
+            break;
+        }
+
+        // Magic is written last, interrupted build leaves an invalid index
+        KeysDictIndexHeader header = {0};
+        keys_dict_index_source_stamp(instance, &header);
+        header.total_keys = total_keys;
+
+        if(!storage_file_seek(instance->index, 0, true)) break;
+        if(!storage_file_truncate(instance->index)) break;
+        if(storage_file_write(instance->index, &header, sizeof(header)) != sizeof(header)) break;
+        if(keys_size && storage_file_write(instance->index, keys, keys_size) != keys_size) break;
+
+        keys_dict_sort(keys, instance->key_size, total_keys);
+        header.unique_keys = keys_dict_unique(keys, instance->key_size, total_keys);
+        keys_size = header.unique_keys * instance->key_size;
+        if(keys_size && storage_file_write(instance->index, keys, keys_size) != keys_size) break;
+
+        header.magic = KEYS_DICT_INDEX_MAGIC;
+        if(!storage_file_seek(instance->index, 0, true)) break;
+        if(storage_file_write(instance->index, &header, sizeof(header)) != sizeof(header)) break;
+
+        instance->total_keys = header.total_keys;
+        instance->index_keys = header.total_keys;
+        instance->unique_keys = header.unique_keys;
+        instance->pending_count = 0;
+        instance->position = MIN(instance->position, instance->total_keys);
+        instance->index_built = true;
+        index_built = true;
+        FURI_LOG_I(TAG, "Indexed %zu keys, %zu unique", total_keys, instance->unique_keys);
+    } while(false);
+
+    if(keys) free(keys);
+    furi_string_free(line);
+    stream_rewind(instance->stream);
+
+    return index_built;
+}
+
+void keys_dict_get_index_path(const char* path, FuriString* index_path) {
+    furi_assert(path);
+    furi_assert(index_path);
+
+    const uint32_t path_crc = crc32_calc_buffer(0, path, strlen(path));
+    furi_string_printf(
+        index_path, "%s/%08lX%s", KEYS_DICT_INDEX_FOLDER, path_crc, KEYS_DICT_INDEX_EXTENSION);
+}
+
+static FuriString* keys_dict_index_path(KeysDict* instance) {
+    FuriString* index_path = furi_string_alloc();
+    keys_dict_get_index_path(furi_string_get_cstr(instance->path), index_path);
+    return index_path;
+}
+
+static void keys_dict_index_close(KeysDict* instance) {
+    if(instance->index) {
+        storage_file_free(instance->index);
+        instance->index = NULL;
+    }
+    if(instance->pending_keys) {
+        free(instance->pending_keys);
+        instance->pending_keys = NULL;
+    }
+    instance->pending_count = 0;
+    instance->index_valid = false;
+}
+
+// Index is opened read only, write access is taken only to rebuild it
+static bool keys_dict_index_rebuild(KeysDict* instance) {
+    if(!instance->index) return false;
+
+    FuriString* index_path = keys_dict_index_path(instance);
+    if(storage_file_is_open(instance->index)) storage_file_close(instance->index);
+    storage_simply_mkdir(instance->storage, KEYS_DICT_INDEX_FOLDER);
+    bool index_built = storage_file_open(
+                           instance->index,
+                           furi_string_get_cstr(index_path),
+                           FSAM_READ_WRITE,
+                           FSOM_OPEN_ALWAYS) &&
+                       keys_dict_index_build(instance);
+    furi_string_free(index_path);
+
+    return index_built;
+}
+
+// Index can't be used anymore: continue in text file from the same key
+static void keys_dict_index_disable(KeysDict* instance) {
+    FURI_LOG_W(TAG, "Index unavailable, using %s as is", furi_string_get_cstr(instance->path));
+    keys_dict_index_close(instance);
+
+    uint8_t* key = malloc(instance->key_size);
+    stream_rewind(instance->stream);
+    for(size_t i = 0; i < instance->position; i++) {
+        if(!keys_dict_get_next_key_text(instance, key)) break;
+    }
+    free(key);
+}
+
+static void keys_dict_index_open(KeysDict* instance) {
+    FuriString* index_path = keys_dict_index_path(instance);
+
+    instance->index = storage_file_alloc(instance->storage);
+
+    if(storage_file_open(
+           instance->index, furi_string_get_cstr(index_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        KeysDictIndexHeader header = {0};
+        KeysDictIndexHeader source = {0};
+        keys_dict_index_source_stamp(instance, &source);
+
+        // Reuse index only if it was built for this exact text file
+        if(storage_file_read(instance->index, &header, sizeof(header)) == sizeof(header) &&
+           header.magic == KEYS_DICT_INDEX_MAGIC && header.version == source.version &&
+           header.key_size == source.key_size && header.source_size == source.source_size &&
+           header.source_timestamp == source.source_timestamp) {
+            instance->total_keys = header.total_keys;
+            instance->index_keys = header.total_keys;
+            instance->unique_keys = header.unique_keys;
+            instance->index_valid = true;
+        }
+    }
+
+    if(!instance->index_valid) {
+        instance->index_valid = keys_dict_index_rebuild(instance);
+    }
+
+    if(!instance->index_valid) {
+        FURI_LOG_W(TAG, "Index unavailable, using %s as is", furi_string_get_cstr(instance->path));
+        keys_dict_index_close(instance);
+    }
+
+    furi_string_free(index_path);
+}
+
+static bool keys_dict_index_ensure(KeysDict* instance) {
+    if(!instance->index) return false;
+
+    // Keys were deleted in this session
+    if(!instance->index_valid) {
+        instance->index_valid = keys_dict_index_rebuild(instance);
+        if(!instance->index_valid) keys_dict_index_disable(instance);
+    }
+
+    return instance->index_valid;
+}
+
+// Keys appended to text file are kept in memory, index is rebuilt when there are too many
+static void keys_dict_index_append(KeysDict* instance, const uint8_t* keys, size_t keys_count) {
+    if(!instance->index || !instance->index_valid) return;
+
+    if(instance->pending_count + keys_count > KEYS_DICT_INDEX_PENDING_MAX) {
+        instance->index_valid = keys_dict_index_rebuild(instance);
+        if(!instance->index_valid) keys_dict_index_disable(instance);
+        return;
+    }
+
+    if(!instance->pending_keys) {
+        instance->pending_keys = malloc(KEYS_DICT_INDEX_PENDING_MAX * instance->key_size);
+    }
+    memcpy(
+        &instance->pending_keys[instance->pending_count * instance->key_size],
+        keys,
+        keys_count * instance->key_size);
+    instance->pending_count += keys_count;
+}
+
+static bool keys_dict_pending_find(KeysDict* instance, const uint8_t* key) {
+    for(size_t i = 0; i < instance->pending_count; i++) {
+        if(memcmp(&instance->pending_keys[i * instance->key_size], key, instance->key_size) ==
+           0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool keys_dict_index_find(KeysDict* instance, const uint8_t* key) {
+    uint8_t* probe = malloc(instance->key_size);
+
+    bool key_found = false;
+    size_t low = 0;
+    size_t high = instance->unique_keys;
+
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        if(!storage_file_seek(
+               instance->index, keys_dict_index_offset(instance, true, mid), true) ||
+           storage_file_read(instance->index, probe, instance->key_size) != instance->key_size) {
+            break;
+        }
+
+        int cmp = memcmp(probe, key, instance->key_size);
+        if(cmp == 0) {
+            key_found = true;
+            break;
+        } else if(cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    free(probe);
+
+    return key_found;
+}
+
 bool keys_dict_check_presence(const char* path) {
     furi_assert(path);
 
@@ -73,6 +510,17 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     Storage* storage = furi_record_open(RECORD_STORAGE);
     furi_assert(storage);
 
+    instance->storage = storage;
+    instance->path = furi_string_alloc_set_str(path);
+    instance->index = NULL;
+    instance->index_valid = false;
+    instance->index_built = false;
+    instance->index_keys = 0;
+    instance->unique_keys = 0;
+    instance->pending_keys = NULL;
+    instance->pending_count = 0;
+    instance->position = 0;
+
     instance->stream = buffered_file_stream_alloc(storage);
     furi_assert(instance->stream);
 
@@ -93,6 +541,8 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     } else {
         // Eventually add new line character in the last line to avoid skipping keys
         keys_dict_add_ending_new_line(instance);
+        // Counts the keys as well
+        keys_dict_index_open(instance);
     }
 
     FuriString* line = furi_string_alloc();
@@ -101,7 +551,7 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     // In this loop we only count the entries in the file
     // We prefer not to load the whole file in memory for space reasons
-    while(file_exists && !is_endfile) {
+    while(file_exists && !instance->index && !is_endfile) {
         bool read_key = keys_dict_read_key_line(instance, line, &is_endfile);
         if(read_key) {
             instance->total_keys++;
@@ -119,43 +569,22 @@ void keys_dict_free(KeysDict* instance) {
     furi_assert(instance);
     furi_assert(instance->stream);
 
+    // Keys added or deleted in this session
+    if(instance->index && (instance->pending_count || !instance->index_valid)) {
+        instance->index_valid = keys_dict_index_rebuild(instance);
+    }
     buffered_file_stream_close(instance->stream);
+    if(instance->index && instance->index_valid && instance->index_built) {
+        keys_dict_index_restamp(instance);
+    }
+    keys_dict_index_close(instance);
     stream_free(instance->stream);
+    furi_string_free(instance->path);
     free(instance);
 
     furi_record_close(RECORD_STORAGE);
 }
 
-static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, FuriString* key_str) {
-    furi_assert(instance);
-    furi_assert(key_str);
-    furi_assert(key_int);
-
-    furi_string_reset(key_str);
-
-    for(size_t i = 0; i < instance->key_size; i++)
-        furi_string_cat_printf(key_str, "%02X", key_int[i]);
-}
-
-static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
-    furi_assert(instance);
-    furi_assert(key_str);
-    furi_assert(key_int);
-
-    uint8_t key_byte_tmp;
-    char h, l;
-
-    *key_int = 0ULL;
-
-    for(size_t i = 0; i < instance->key_size_symbols - 1; i += 2) {
-        h = furi_string_get_char(key_str, i);
-        l = furi_string_get_char(key_str, i + 1);
-
-        args_char_to_hex(h, l, &key_byte_tmp);
-        *key_int |= (uint64_t)key_byte_tmp << (8 * (instance->key_size - 1 - i / 2));
-    }
-}
-
 size_t keys_dict_get_total_keys(KeysDict* instance) {
     furi_assert(instance);
 
@@ -166,48 +595,60 @@ bool keys_dict_rewind(KeysDict* instance) {
     furi_assert(instance);
     furi_assert(instance->stream);
 
+    instance->position = 0;
+
     return stream_rewind(instance->stream);
 }
 
-static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
-    furi_assert(instance);
-    furi_assert(instance->stream);
-    furi_assert(key);
-
-    bool key_read = false;
-    bool is_endfile = false;
-
-    furi_string_reset(key);
-
-    while(!key_read && !is_endfile) key_read = keys_dict_read_key_line(instance, key, &is_endfile);
-
-    return key_read;
+bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
+    return keys_dict_get_next_keys(instance, key, 1, key_size) == 1;
 }
 
-bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
+size_t keys_dict_get_next_keys(
+    KeysDict* instance,
+    uint8_t* keys,
+    size_t keys_count,
+    size_t key_size) {
     furi_assert(instance);
     furi_assert(instance->stream);
     furi_assert(instance->key_size == key_size);
-    furi_assert(key);
-
-    FuriString* temp_key = furi_string_alloc();
-
-    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
-
-    if(key_read) {
-        size_t tmp_len = key_size;
-        uint64_t key_int = 0;
-
-        keys_dict_str_to_int(instance, temp_key, &key_int);
-
-        while(tmp_len--) {
-            key[tmp_len] = (uint8_t)key_int;
-            key_int >>= 8;
+    furi_assert(keys);
+
+    size_t keys_read = 0;
+
+    if(keys_dict_index_ensure(instance)) {
+        // Indexed keys, then keys added since index was built
+        if(instance->position < instance->index_keys) {
+            size_t count = MIN(keys_count, instance->index_keys - instance->position);
+            if(storage_file_seek(
+                   instance->index,
+                   keys_dict_index_offset(instance, false, instance->position),
+                   true)) {
+                keys_read = storage_file_read(instance->index, keys, count * key_size) / key_size;
+            }
+            instance->position += keys_read;
+        }
+        if(instance->position >= instance->index_keys) {
+            size_t pending_position = instance->position - instance->index_keys;
+            size_t count = MIN(keys_count - keys_read, instance->pending_count - pending_position);
+            if(count) {
+                memcpy(
+                    &keys[keys_read * key_size],
+                    &instance->pending_keys[pending_position * key_size],
+                    count * key_size);
+                keys_read += count;
+                instance->position += count;
+            }
         }
+    } else {
+        while(keys_read < keys_count &&
+              keys_dict_get_next_key_text(instance, &keys[keys_read * key_size])) {
+            keys_read++;
+        }
+        instance->position += keys_read;
     }
 
-    furi_string_free(temp_key);
-    return key_read;
+    return keys_read;
 }
 
 static bool keys_dict_is_key_present_str(KeysDict* instance, FuriString* key) {
@@ -242,6 +683,10 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_assert(instance->key_size == key_size);
     furi_assert(key);
 
+    if(keys_dict_index_ensure(instance)) {
+        return keys_dict_pending_find(instance, key) || keys_dict_index_find(instance, key);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -251,25 +696,29 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     return key_found;
 }
 
-static bool keys_dict_add_key_str(KeysDict* instance, FuriString* key) {
+static bool keys_dict_add_key_str(
+    KeysDict* instance,
+    FuriString* key,
+    const uint8_t* keys,
+    size_t keys_count) {
     furi_assert(instance);
     furi_assert(instance->stream);
     furi_assert(key);
 
-    furi_string_cat_str(key, "\n");
-
     bool key_added = false;
 
     uint32_t actual_pos = stream_tell(instance->stream);
 
     if(stream_seek(instance->stream, 0, StreamOffsetFromEnd) &&
        stream_insert_string(instance->stream, key)) {
-        instance->total_keys++;
+        instance->total_keys += keys_count;
         key_added = true;
     }
 
     stream_seek(instance->stream, actual_pos, StreamOffsetFromStart);
 
+    if(key_added) keys_dict_index_append(instance, keys, keys_count);
+
     return key_added;
 }
 
@@ -283,7 +732,8 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     furi_assert(temp_key);
 
     keys_dict_int_to_str(instance, key, temp_key);
-    bool key_added = keys_dict_add_key_str(instance, temp_key);
+    furi_string_cat_str(temp_key, "\n");
+    bool key_added = keys_dict_add_key_str(instance, temp_key, key, 1);
 
     FURI_LOG_I(TAG, "Added key %s", furi_string_get_cstr(temp_key));
 
@@ -292,6 +742,60 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     return key_added;
 }
 
+size_t keys_dict_add_keys(
+    KeysDict* instance,
+    const uint8_t* keys,
+    size_t keys_count,
+    size_t key_size) {
+    furi_assert(instance);
+    furi_assert(instance->stream);
+    furi_assert(instance->key_size == key_size);
+    furi_assert(keys);
+
+    if(!keys_count) return 0;
+
+    // Sorted copy of the batch, marks which of equal keys was already taken
+    uint8_t* sorted = malloc(keys_count * key_size);
+    bool* taken = malloc(keys_count * sizeof(bool));
+    memcpy(sorted, keys, keys_count * key_size);
+    memset(taken, 0, keys_count * sizeof(bool));
+    keys_dict_sort(sorted, key_size, keys_count);
+
+    uint8_t* added = malloc(keys_count * key_size);
+    FuriString* lines = furi_string_alloc();
+    FuriString* temp_key = furi_string_alloc();
+    size_t keys_added = 0;
+
+    for(size_t i = 0; i < keys_count; i++) {
+        const uint8_t* key = &keys[i * key_size];
+
+        size_t position = keys_dict_lower_bound(sorted, key_size, keys_count, key);
+        if(taken[position]) continue;
+        taken[position] = true;
+
+        if(keys_dict_is_key_present(instance, key, key_size)) continue;
+
+        keys_dict_int_to_str(instance, key, temp_key);
+        furi_string_cat_printf(lines, "%s\n", furi_string_get_cstr(temp_key));
+        memcpy(&added[keys_added * key_size], key, key_size);
+        keys_added++;
+    }
+
+    if(keys_added && !keys_dict_add_key_str(instance, lines, added, keys_added)) {
+        keys_added = 0;
+    }
+
+    FURI_LOG_I(TAG, "Added %zu of %zu keys", keys_added, keys_count);
+
+    furi_string_free(temp_key);
+    furi_string_free(lines);
+    free(added);
+    free(taken);
+    free(sorted);
+
+    return keys_added;
+}
+
 bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_size) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -305,7 +809,7 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
     stream_rewind(instance->stream);
 
     while(!key_removed) {
-        if(!keys_dict_get_next_key(instance, temp_key, key_size)) {
+        if(!keys_dict_get_next_key_text(instance, temp_key)) {
             break;
         }
 
@@ -315,6 +819,11 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
                 break;
             }
             instance->total_keys--;
+            // Rebuilt on next use
+            if(instance->index) {
+                instance->index_valid = false;
+                instance->pending_count = 0;
+            }
             key_removed = true;
         }
     }
@@ -327,7 +836,7 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     furi_string_free(tmp);
 
-    stream_rewind(instance->stream);
+    keys_dict_rewind(instance);
     free(temp_key);
 
     return key_removed;
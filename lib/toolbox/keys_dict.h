@@ -1,13 +1,17 @@
 #pragma once
 
-#include <stdbool.h>
-#include <stdint.h>
-#include <stddef.h>
+#include <furi.h>
+#include <storage/storage.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Folder of compiled indexes, one per list path */
+#define KEYS_DICT_INDEX_FOLDER CFG_PATH(".keys_dict")
+/** Suffix of the compiled index */
+#define KEYS_DICT_INDEX_EXTENSION ".kdx"
+
 typedef enum {
     KeysDictModeOpenExisting,
     KeysDictModeOpenAlways,
@@ -23,8 +27,19 @@ typedef struct KeysDict KeysDict;
 */
 bool keys_dict_check_presence(const char* path);
 
+/** Get path of the compiled index of the list
+ *
+ * @param path       - list path
+ * @param index_path - index path in KEYS_DICT_INDEX_FOLDER
+*/
+void keys_dict_get_index_path(const char* path, FuriString* index_path);
+
 /** Open or create list
  * Depending on mode, list will be opened or created.
+ * Sorted binary index of the list is kept in KEYS_DICT_INDEX_FOLDER, so read
+ * only lists are indexed too. Index is rebuilt if size or modification time
+ * of the list changed since, and updated on close if keys were added or
+ * deleted. Without index or memory for it list is used as plain text.
  *
  * @param path      - Path of the file that contain the list
  * @param mode      - ListKeysMode value
@@ -78,6 +93,22 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
 */
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 
+/** Get next keys from the list
+ * Same as keys_dict_get_next_key(), but returns up to keys_count keys at once.
+ *
+ * @param instance  - KeysDict list instance
+ * @param keys      - Array where to store keys, keys_count * key_size bytes
+ * @param keys_count - Maximum number of keys to get
+ * @param key_size  - Size of each key in bytes
+ *
+ * @return Returns number of keys retrieved, 0 if there are no more keys
+*/
+size_t keys_dict_get_next_keys(
+    KeysDict* instance,
+    uint8_t* keys,
+    size_t keys_count,
+    size_t key_size);
+
 /** Add key to list
  *
  * @param instance  - KeysDict list instance
@@ -88,6 +119,22 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 */
 bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size);
 
+/** Add keys that are not in the list yet
+ * Duplicates within keys are added once, list is written in one go.
+ *
+ * @param instance  - KeysDict list instance
+ * @param keys      - Keys to add, keys_count * key_size bytes
+ * @param keys_count - Number of keys
+ * @param key_size  - Size of each key in bytes
+ *
+ * @return Returns number of keys added
+*/
+size_t keys_dict_add_keys(
+    KeysDict* instance,
+    const uint8_t* keys,
+    size_t keys_count,
+    size_t key_size);
+
 /** Delete key from list
  *
  * @param instance  - KeysDict list instance
@@ -0,0 +1,330 @@
+#include "sector_cache.h"
+
+#include <string.h>
+#include <furi.h>
+
+#define SECTOR_CACHE_ALIGN(x) (((x) + 3) & ~(size_t)3)
+
+#define SECTOR_CACHE_LINE_VALID (1 << 0)
+#define SECTOR_CACHE_LINE_DIRTY (1 << 1)
+#define SECTOR_CACHE_LINE_PRIORITY (1 << 2)
+
+typedef struct {
+    uint32_t sector;
+    uint32_t stamp;
+    uint8_t flags;
+} SectorCacheLine;
+
+struct SectorCache {
+    SectorCacheConfig config;
+    SectorCacheReadCallback read_callback;
+    SectorCacheWriteCallback write_callback;
+    void* context;
+
+    SectorCacheLine* lines;
+    uint8_t* data;
+    uint8_t* prefetch_data;
+
+    uint32_t stamp;
+    uint32_t last_sector;
+    bool last_sector_valid;
+    uint32_t sectors_count;
+    uint32_t priority_start;
+    uint32_t priority_end;
+
+    SectorCacheStats stats;
+};
+
+static inline size_t sector_cache_lines_count(const SectorCacheConfig* config) {
+    return (size_t)config->sets * config->ways;
+}
+
+size_t sector_cache_get_memory_size(const SectorCacheConfig* config) {
+    furi_check(config);
+    size_t lines_count = sector_cache_lines_count(config);
+    size_t prefetch_count = config->prefetch ? config->prefetch + 1 : 0;
+
+    return SECTOR_CACHE_ALIGN(sizeof(SectorCache)) +
+           SECTOR_CACHE_ALIGN(lines_count * sizeof(SectorCacheLine)) +
+           (lines_count + prefetch_count) * SECTOR_CACHE_SECTOR_SIZE;
+}
+
+SectorCache* sector_cache_init(
+    void* memory,
+    const SectorCacheConfig* config,
+    SectorCacheReadCallback read_callback,
+    SectorCacheWriteCallback write_callback,
+    void* context) {
+    furi_check(memory);
+    furi_check(config);
+    furi_check(config->sets && config->ways);
+    furi_check((config->sets & (config->sets - 1)) == 0);
+    furi_check(read_callback);
+    furi_check(write_callback);
+
+    size_t lines_count = sector_cache_lines_count(config);
+    uint8_t* ptr = memory;
+
+    SectorCache* cache = (SectorCache*)ptr;
+    memset(cache, 0, sizeof(SectorCache));
+    ptr += SECTOR_CACHE_ALIGN(sizeof(SectorCache));
+
+    cache->config = *config;
+    cache->read_callback = read_callback;
+    cache->write_callback = write_callback;
+    cache->context = context;
+
+    cache->lines = (SectorCacheLine*)ptr;
+    ptr += SECTOR_CACHE_ALIGN(lines_count * sizeof(SectorCacheLine));
+    cache->data = ptr;
+    cache->prefetch_data = config->prefetch ? ptr + lines_count * SECTOR_CACHE_SECTOR_SIZE :
+                                              NULL;
+
+    sector_cache_invalidate(cache);
+
+    return cache;
+}
+
+static inline uint8_t* sector_cache_line_data(SectorCache* cache, SectorCacheLine* line) {
+    return cache->data + (size_t)(line - cache->lines) * SECTOR_CACHE_SECTOR_SIZE;
+}
+
+static inline bool sector_cache_is_priority(SectorCache* cache, uint32_t sector) {
+    return sector >= cache->priority_start && sector < cache->priority_end;
+}
+
+static SectorCacheLine* sector_cache_find(SectorCache* cache, uint32_t sector) {
+    size_t set = sector & (cache->config.sets - 1);
+    SectorCacheLine* line = &cache->lines[set * cache->config.ways];
+
+    for(size_t way = 0; way < cache->config.ways; way++, line++) {
+        if((line->flags & SECTOR_CACHE_LINE_VALID) && line->sector == sector) {
+            return line;
+        }
+    }
+
+    return NULL;
+}
+
+static bool sector_cache_line_write_back(SectorCache* cache, SectorCacheLine* line) {
+    if(!(line->flags & SECTOR_CACHE_LINE_DIRTY)) return true;
+
+    if(!cache->write_callback(
+           cache->context, sector_cache_line_data(cache, line), line->sector, 1)) {
+        return false;
+    }
+
+    line->flags &= ~SECTOR_CACHE_LINE_DIRTY;
+    cache->stats.write_backs++;
+    return true;
+}
+
+// Free line in sector's set: invalid one, LRU outside of priority range or LRU overall
+static SectorCacheLine* sector_cache_evict(SectorCache* cache, uint32_t sector) {
+    size_t set = sector & (cache->config.sets - 1);
+    SectorCacheLine* lines = &cache->lines[set * cache->config.ways];
+    SectorCacheLine* victim = NULL;
+
+    for(size_t way = 0; way < cache->config.ways; way++) {
+        if(!(lines[way].flags & SECTOR_CACHE_LINE_VALID)) return &lines[way];
+    }
+
+    for(size_t pass = 0; pass < 2 && !victim; pass++) {
+        for(size_t way = 0; way < cache->config.ways; way++) {
+            SectorCacheLine* line = &lines[way];
+            if(pass == 0 && (line->flags & SECTOR_CACHE_LINE_PRIORITY)) continue;
+            if(!victim || (int32_t)(line->stamp - victim->stamp) < 0) victim = line;
+        }
+    }
+
+    if(!sector_cache_line_write_back(cache, victim)) return NULL;
+
+    victim->flags = 0;
+    cache->stats.evictions++;
+    return victim;
+}
+
+static bool sector_cache_insert(
+    SectorCache* cache,
+    const uint8_t* data,
+    uint32_t sector,
+    bool dirty) {
+    SectorCacheLine* line = sector_cache_find(cache, sector);
+
+    if(!line) {
+        line = sector_cache_evict(cache, sector);
+        if(!line) return false;
+
+        line->sector = sector;
+        line->flags = SECTOR_CACHE_LINE_VALID;
+        if(sector_cache_is_priority(cache, sector)) line->flags |= SECTOR_CACHE_LINE_PRIORITY;
+    }
+
+    memcpy(sector_cache_line_data(cache, line), data, SECTOR_CACHE_SECTOR_SIZE);
+    line->stamp = ++cache->stamp;
+    if(dirty) line->flags |= SECTOR_CACHE_LINE_DIRTY;
+
+    return true;
+}
+
+// Sequential single sector miss: fetch following sectors with the same device request
+static bool sector_cache_read_ahead(SectorCache* cache, uint8_t* data, uint32_t sector) {
+    if(!cache->prefetch_data || !cache->last_sector_valid) return false;
+    if(sector != cache->last_sector + 1 || sector >= cache->sectors_count) return false;
+
+    uint32_t count = MIN((uint32_t)cache->config.prefetch + 1, cache->sectors_count - sector);
+    if(count < 2) return false;
+    if(!cache->read_callback(cache->context, cache->prefetch_data, sector, count)) return false;
+
+    memcpy(data, cache->prefetch_data, SECTOR_CACHE_SECTOR_SIZE);
+    sector_cache_insert(cache, data, sector, false);
+
+    // Never overwrite cached sectors: they may be dirty
+    for(uint32_t i = 1; i < count; i++) {
+        if(sector_cache_find(cache, sector + i)) continue;
+        if(!sector_cache_insert(
+               cache,
+               cache->prefetch_data + i * SECTOR_CACHE_SECTOR_SIZE,
+               sector + i,
+               false)) {
+            break;
+        }
+        cache->stats.prefetched++;
+    }
+
+    return true;
+}
+
+bool sector_cache_read(SectorCache* cache, uint8_t* data, uint32_t sector, uint32_t count) {
+    furi_check(cache);
+    furi_check(data);
+
+    uint32_t i = 0;
+    while(i < count) {
+        SectorCacheLine* line = sector_cache_find(cache, sector + i);
+        if(line) {
+            memcpy(
+                data + i * SECTOR_CACHE_SECTOR_SIZE,
+                sector_cache_line_data(cache, line),
+                SECTOR_CACHE_SECTOR_SIZE);
+            line->stamp = ++cache->stamp;
+            cache->stats.hits++;
+            i++;
+            continue;
+        }
+
+        // Uncached run goes to the device in one request
+        uint32_t run = 1;
+        while(i + run < count && !sector_cache_find(cache, sector + i + run)) {
+            run++;
+        }
+        cache->stats.misses += run;
+
+        if(count == 1) {
+            if(!sector_cache_read_ahead(cache, data, sector)) {
+                if(!cache->read_callback(cache->context, data, sector, 1)) return false;
+                // Eviction write back failure is not a read failure
+                sector_cache_insert(cache, data, sector, false);
+            }
+        } else {
+            // Bulk data is not cached, it would only push metadata out
+            if(!cache->read_callback(
+                   cache->context, data + i * SECTOR_CACHE_SECTOR_SIZE, sector + i, run)) {
+                return false;
+            }
+        }
+
+        i += run;
+    }
+
+    if(count == 1) {
+        cache->last_sector = sector;
+        cache->last_sector_valid = true;
+    }
+
+    return true;
+}
+
+bool sector_cache_write(SectorCache* cache, const uint8_t* data, uint32_t sector, uint32_t count) {
+    furi_check(cache);
+    furi_check(data);
+
+    if(cache->config.write_back && count == 1) {
+        if(sector_cache_insert(cache, data, sector, true)) return true;
+        // Eviction failed, keep old contents and write through
+    }
+
+    bool success = cache->write_callback(cache->context, data, sector, count);
+
+    for(uint32_t i = 0; i < count; i++) {
+        SectorCacheLine* line = sector_cache_find(cache, sector + i);
+        if(!line) continue;
+
+        if(success) {
+            memcpy(
+                sector_cache_line_data(cache, line),
+                data + i * SECTOR_CACHE_SECTOR_SIZE,
+                SECTOR_CACHE_SECTOR_SIZE);
+            line->flags &= ~SECTOR_CACHE_LINE_DIRTY;
+        } else {
+            // Device contents are unknown now
+            line->flags = 0;
+        }
+    }
+
+    return success;
+}
+
+bool sector_cache_flush(SectorCache* cache) {
+    furi_check(cache);
+
+    bool success = true;
+    size_t lines_count = sector_cache_lines_count(&cache->config);
+    for(size_t i = 0; i < lines_count; i++) {
+        SectorCacheLine* line = &cache->lines[i];
+        if(!(line->flags & SECTOR_CACHE_LINE_VALID)) continue;
+        if(!sector_cache_line_write_back(cache, line)) success = false;
+    }
+
+    return success;
+}
+
+void sector_cache_invalidate(SectorCache* cache) {
+    furi_check(cache);
+
+    memset(cache->lines, 0, sector_cache_lines_count(&cache->config) * sizeof(SectorCacheLine));
+    cache->last_sector_valid = false;
+}
+
+void sector_cache_set_sectors_count(SectorCache* cache, uint32_t sectors_count) {
+    furi_check(cache);
+    cache->sectors_count = sectors_count;
+}
+
+void sector_cache_set_priority_range(
+    SectorCache* cache,
+    uint32_t start_sector,
+    uint32_t end_sector) {
+    furi_check(cache);
+    furi_check(start_sector <= end_sector);
+
+    cache->priority_start = start_sector;
+    cache->priority_end = end_sector;
+
+    size_t lines_count = sector_cache_lines_count(&cache->config);
+    for(size_t i = 0; i < lines_count; i++) {
+        SectorCacheLine* line = &cache->lines[i];
+        if(!(line->flags & SECTOR_CACHE_LINE_VALID)) continue;
+        if(sector_cache_is_priority(cache, line->sector)) {
+            line->flags |= SECTOR_CACHE_LINE_PRIORITY;
+        } else {
+            line->flags &= ~SECTOR_CACHE_LINE_PRIORITY;
+        }
+    }
+}
+
+void sector_cache_get_stats(SectorCache* cache, SectorCacheStats* stats) {
+    furi_check(cache);
+    furi_check(stats);
+    *stats = cache->stats;
+}
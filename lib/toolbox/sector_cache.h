@@ -0,0 +1,161 @@
+/**
+ * @file sector_cache.h
+ * Set-associative block device sector cache
+ *
+ * Sits between a filesystem and a block device. Keeps recently used sectors
+ * in LRU order inside each set, reads ahead on sequential access and
+ * optionally delays single sector writes until flush or eviction.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SECTOR_CACHE_SECTOR_SIZE (512)
+
+typedef struct SectorCache SectorCache;
+
+/** Device read callback
+ *
+ * @param context   - callback context
+ * @param data      - buffer for count sectors
+ * @param sector    - first sector number
+ * @param count     - sectors count
+ *
+ * @return true on success
+ */
+typedef bool (*SectorCacheReadCallback)(
+    void* context,
+    uint8_t* data,
+    uint32_t sector,
+    uint32_t count);
+
+/** Device write callback
+ *
+ * @param context   - callback context
+ * @param data      - count sectors of data
+ * @param sector    - first sector number
+ * @param count     - sectors count
+ *
+ * @return true on success
+ */
+typedef bool (*SectorCacheWriteCallback)(
+    void* context,
+    const uint8_t* data,
+    uint32_t sector,
+    uint32_t count);
+
+typedef struct {
+    uint8_t sets; /**< Number of sets, power of two */
+    uint8_t ways; /**< Sectors in each set */
+    uint8_t prefetch; /**< Sectors read ahead on sequential miss, 0 to disable */
+    bool write_back; /**< Keep single sector writes until flush or eviction */
+} SectorCacheConfig;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t prefetched;
+    uint32_t write_backs;
+} SectorCacheStats;
+
+/** Get memory size needed by cache with given configuration
+ *
+ * @param config    - cache configuration
+ *
+ * @return size in bytes
+ */
+size_t sector_cache_get_memory_size(const SectorCacheConfig* config);
+
+/** Init cache in caller provided memory
+ * Memory is owned by the caller and must be sector_cache_get_memory_size()
+ * bytes long, 4 bytes aligned. Cache has no free function: release the memory
+ * once sector_cache_flush() succeeded.
+ *
+ * @param memory            - cache memory
+ * @param config            - cache configuration, copied
+ * @param read_callback     - device read callback
+ * @param write_callback    - device write callback
+ * @param context           - callbacks context
+ *
+ * @return SectorCache instance, located at memory
+ */
+SectorCache* sector_cache_init(
+    void* memory,
+    const SectorCacheConfig* config,
+    SectorCacheReadCallback read_callback,
+    SectorCacheWriteCallback write_callback,
+    void* context);
+
+/** Read sectors through the cache
+ *
+ * @param cache     - SectorCache instance
+ * @param data      - buffer for count sectors
+ * @param sector    - first sector number
+ * @param count     - sectors count
+ *
+ * @return true on success
+ */
+bool sector_cache_read(SectorCache* cache, uint8_t* data, uint32_t sector, uint32_t count);
+
+/** Write sectors through the cache
+ * With write back enabled single sector writes only reach the device on flush
+ * or eviction, multi sector writes always go to the device.
+ *
+ * @param cache     - SectorCache instance
+ * @param data      - count sectors of data
+ * @param sector    - first sector number
+ * @param count     - sectors count
+ *
+ * @return true on success
+ */
+bool sector_cache_write(SectorCache* cache, const uint8_t* data, uint32_t sector, uint32_t count);
+
+/** Write all dirty sectors to the device
+ *
+ * @param cache     - SectorCache instance
+ *
+ * @return true on success
+ */
+bool sector_cache_flush(SectorCache* cache);
+
+/** Drop all cached sectors, dirty ones included
+ *
+ * @param cache     - SectorCache instance
+ */
+void sector_cache_invalidate(SectorCache* cache);
+
+/** Set device size, read ahead never crosses it
+ *
+ * @param cache         - SectorCache instance
+ * @param sectors_count - device size in sectors, 0 if unknown (no read ahead)
+ */
+void sector_cache_set_sectors_count(SectorCache* cache, uint32_t sectors_count);
+
+/** Set sectors range evicted last, e.g. filesystem allocation table
+ *
+ * @param cache         - SectorCache instance
+ * @param start_sector  - first sector of the range
+ * @param end_sector    - sector after the range, equal to start to clear
+ */
+void sector_cache_set_priority_range(
+    SectorCache* cache,
+    uint32_t start_sector,
+    uint32_t end_sector);
+
+/** Get cache statistics, counted since init
+ *
+ * @param cache     - SectorCache instance
+ * @param stats     - statistics output
+ */
+void sector_cache_get_stats(SectorCache* cache, SectorCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -200,7 +200,11 @@ static size_t buffered_file_stream_read(BufferedFileStream* stream, uint8_t* dat
             if(stream->sync_pending) {
                 if(!buffered_file_stream_flush(stream)) break;
             }
-            if(!stream_cache_fill(stream->cache, stream->file_stream)) break;
+            // Rest of the request and cache refill in one storage call
+            const size_t size_read = stream_cache_fill_after(
+                stream->cache, stream->file_stream, data + (size - need_to_read), need_to_read);
+            if(!size_read) break;
+            need_to_read -= size_read;
         }
     }
     return size - need_to_read;
@@ -42,6 +42,15 @@ bool file_stream_close(Stream* stream);
  */
 FS_Error file_stream_get_error(Stream* stream);
 
+/**
+ * Reads data into several buffers with a single storage request
+ * @param stream pointer to stream object.
+ * @param vectors array of buffers to fill in order.
+ * @param count number of buffers.
+ * @return size_t total size read
+ */
+size_t file_stream_readv(Stream* stream, const StorageIoVector* vectors, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
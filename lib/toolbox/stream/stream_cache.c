@@ -1,4 +1,5 @@
 #include "stream_cache.h"
+#include "file_stream.h"
 
 #define STREAM_CACHE_MAX_SIZE 1024U
 
@@ -46,6 +47,17 @@ size_t stream_cache_fill(StreamCache* cache, Stream* stream) {
     return size_read;
 }
 
+size_t stream_cache_fill_after(StreamCache* cache, Stream* stream, uint8_t* data, size_t size) {
+    const StorageIoVector vectors[] = {
+        {.buff = data, .size = size},
+        {.buff = cache->data, .size = STREAM_CACHE_MAX_SIZE},
+    };
+    const size_t size_read = file_stream_readv(stream, vectors, COUNT_OF(vectors));
+    cache->data_size = size_read > size ? size_read - size : 0;
+    cache->position = 0;
+    return MIN(size_read, size);
+}
+
 bool stream_cache_flush(StreamCache* cache, Stream* stream) {
     const size_t size_written = stream_write(stream, cache->data, cache->data_size);
     const bool success = (size_written == cache->data_size);
@@ -55,6 +55,17 @@ size_t stream_cache_pos(StreamCache* cache);
  */
 size_t stream_cache_fill(StreamCache* cache, Stream* stream);
 
+/**
+ * Read data from a file stream bypassing the cache, then load the cache
+ * with data that follows. Both are done with a single storage request.
+ * @param cache Pointer to a StreamCache instance
+ * @param stream Pointer to a file Stream instance
+ * @param data Pointer to a data buffer.
+ * @param size Size in bytes to read into the data buffer.
+ * @return Size read into the data buffer.
+ */
+size_t stream_cache_fill_after(StreamCache* cache, Stream* stream, uint8_t* data, size_t size);
+
 /**
  * Write as much cached data as possible to a stream.
  * @param cache Pointer to a StreamCache instance
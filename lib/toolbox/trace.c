@@ -0,0 +1,247 @@
+#include "trace.h"
+
+#include <furi.h>
+#include <furi_hal_cortex.h>
+
+#define TRACE_THREAD_NAME_SIZE (16)
+
+/** Buffer after thread ones, shared by interrupts and code running before scheduler */
+#define TRACE_BUFFER_ISR TRACE_THREADS_MAX
+#define TRACE_BUFFER_COUNT (TRACE_THREADS_MAX + 1)
+
+typedef enum {
+    TraceEventTypeBegin,
+    TraceEventTypeEnd,
+    TraceEventTypeCounter,
+} TraceEventType;
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t value;
+    uint8_t probe;
+    uint8_t type;
+} TraceEvent;
+
+typedef struct {
+    FuriThreadId thread_id;
+    char name[TRACE_THREAD_NAME_SIZE];
+    size_t count;
+    TraceEvent* events;
+} TraceBuffer;
+
+typedef struct {
+    volatile bool is_running;
+    uint32_t start_cycles;
+    uint32_t dropped;
+    size_t events_per_thread;
+    TraceBuffer* buffers;
+    TraceEvent* events;
+} Trace;
+
+typedef struct {
+    const char* category;
+    const char* name;
+} TraceProbeInfo;
+
+#define TRACE_PROBE_INFO(id, probe_category, probe_name) \
+    [id] = {.category = probe_category, .name = probe_name},
+
+static const TraceProbeInfo trace_probes[TraceProbeNum] = {TRACE_PROBES(TRACE_PROBE_INFO)};
+
+#undef TRACE_PROBE_INFO
+
+/* Chrome trace event phase of every event type */
+static const char trace_event_phases[] = {
+    [TraceEventTypeBegin] = 'B',
+    [TraceEventTypeEnd] = 'E',
+    [TraceEventTypeCounter] = 'C',
+};
+
+static Trace trace = {0};
+
+/* Names go to JSON as is, keep only characters that need no escaping */
+static void trace_buffer_set_name(TraceBuffer* buffer, const char* name) {
+    size_t i = 0;
+    for(; name && name[i] && i < TRACE_THREAD_NAME_SIZE - 1; i++) {
+        const char c = name[i];
+        buffer->name[i] = (c < ' ' || c == '"' || c == '\\') ? '_' : c;
+    }
+    buffer->name[i] = '\0';
+}
+
+/* Called in critical section: buffers are taken in order and never given back */
+static TraceBuffer* trace_get_buffer() {
+    FuriThreadId thread_id = FURI_IS_IRQ_MODE() ? NULL : furi_thread_get_current_id();
+    if(!thread_id) return &trace.buffers[TRACE_BUFFER_ISR];
+
+    for(size_t i = 0; i < TRACE_THREADS_MAX; i++) {
+        TraceBuffer* buffer = &trace.buffers[i];
+        if(buffer->thread_id == thread_id) return buffer;
+        if(buffer->thread_id == NULL) {
+            buffer->thread_id = thread_id;
+            trace_buffer_set_name(buffer, furi_thread_get_name(thread_id));
+            return buffer;
+        }
+    }
+
+    return NULL;
+}
+
+static void trace_record(TraceProbe probe, TraceEventType type, uint32_t value) {
+    if(!trace.is_running) return;
+    furi_assert(probe < TraceProbeNum);
+
+    // Taken before critical section, its cost stays out of measured durations
+    const uint32_t cycles = furi_hal_cortex_get_cycle_count();
+
+    FURI_CRITICAL_ENTER();
+    // Recheck: trace may have been stopped while we were entering
+    if(trace.is_running) {
+        TraceBuffer* buffer = trace_get_buffer();
+        if(buffer && buffer->count < trace.events_per_thread) {
+            TraceEvent* event = &buffer->events[buffer->count++];
+            event->cycles = cycles;
+            event->value = value;
+            event->probe = probe;
+            event->type = type;
+        } else {
+            trace.dropped++;
+        }
+    }
+    FURI_CRITICAL_EXIT();
+}
+
+bool trace_start(size_t events_per_thread) {
+    furi_check(events_per_thread);
+    if(trace.is_running) return false;
+
+    trace_clear();
+
+    TraceBuffer* buffers = malloc(sizeof(TraceBuffer) * TRACE_BUFFER_COUNT);
+    TraceEvent* events = malloc(sizeof(TraceEvent) * events_per_thread * TRACE_BUFFER_COUNT);
+    for(size_t i = 0; i < TRACE_BUFFER_COUNT; i++) {
+        buffers[i].thread_id = NULL;
+        buffers[i].name[0] = '\0';
+        buffers[i].count = 0;
+        buffers[i].events = &events[i * events_per_thread];
+    }
+    trace_buffer_set_name(&buffers[TRACE_BUFFER_ISR], "ISR");
+
+    FURI_CRITICAL_ENTER();
+    trace.buffers = buffers;
+    trace.events = events;
+    trace.events_per_thread = events_per_thread;
+    trace.dropped = 0;
+    trace.start_cycles = furi_hal_cortex_get_cycle_count();
+    trace.is_running = true;
+    FURI_CRITICAL_EXIT();
+
+    return true;
+}
+
+void trace_stop() {
+    FURI_CRITICAL_ENTER();
+    trace.is_running = false;
+    FURI_CRITICAL_EXIT();
+}
+
+void trace_clear() {
+    trace_stop();
+
+    free(trace.buffers);
+    free(trace.events);
+    trace.buffers = NULL;
+    trace.events = NULL;
+    trace.dropped = 0;
+}
+
+bool trace_is_running() {
+    return trace.is_running;
+}
+
+uint32_t trace_get_dropped_count() {
+    return trace.dropped;
+}
+
+void trace_begin(TraceProbe probe) {
+    trace_record(probe, TraceEventTypeBegin, 0);
+}
+
+void trace_end(TraceProbe probe) {
+    trace_record(probe, TraceEventTypeEnd, 0);
+}
+
+void trace_counter(TraceProbe probe, uint32_t value) {
+    trace_record(probe, TraceEventTypeCounter, value);
+}
+
+static bool trace_export_event(
+    Stream* stream,
+    const TraceEvent* event,
+    size_t tid,
+    uint32_t cycles_per_us) {
+    const TraceProbeInfo* probe = &trace_probes[event->probe];
+    const uint32_t cycles = event->cycles - trace.start_cycles;
+    const uint32_t us = cycles / cycles_per_us;
+    const uint32_t ns = (cycles % cycles_per_us) * 1000 / cycles_per_us;
+
+    size_t written = stream_write_format(
+        stream,
+        ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%lu.%03lu,\"pid\":1,\"tid\":%zu",
+        probe->name,
+        probe->category,
+        trace_event_phases[event->type],
+        us,
+        ns,
+        tid);
+    if(!written) return false;
+
+    if(event->type == TraceEventTypeCounter) {
+        written = stream_write_format(stream, ",\"args\":{\"value\":%lu}}", event->value);
+    } else {
+        written = stream_write_cstring(stream, "}");
+    }
+
+    return written > 0;
+}
+
+bool trace_export(Stream* stream) {
+    furi_assert(stream);
+    if(trace.is_running || !trace.buffers) return false;
+
+    const uint32_t cycles_per_us = furi_hal_cortex_instructions_per_microsecond();
+
+    // Process name opens the list, so every other entry starts with a comma
+    bool is_written = stream_write_cstring(
+                          stream,
+                          "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+                          "\"args\":{\"name\":\"Flipper\"}}") > 0;
+
+    for(size_t i = 0; i < TRACE_BUFFER_COUNT && is_written; i++) {
+        const TraceBuffer* buffer = &trace.buffers[i];
+        if(!buffer->count) continue;
+
+        // Thread ids of viewer, 0 is reserved
+        const size_t tid = i + 1;
+        is_written = stream_write_format(
+                         stream,
+                         ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+                         "\"args\":{\"name\":\"%s\"}}",
+                         tid,
+                         buffer->name) > 0;
+
+        for(size_t j = 0; j < buffer->count && is_written; j++) {
+            is_written = trace_export_event(stream, &buffer->events[j], tid, cycles_per_us);
+        }
+    }
+
+    if(is_written) {
+        is_written = stream_write_format(
+                         stream,
+                         "\n],\"otherData\":{\"dropped_events\":\"%lu\"}}\n",
+                         trace.dropped) > 0;
+    }
+
+    return is_written;
+}
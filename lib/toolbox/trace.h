@@ -0,0 +1,110 @@
+/**
+ * @file trace.h
+ * Cycle accurate event tracing
+ *
+ * Probes record begin, end and counter events timestamped by the core cycle
+ * counter. Each thread writes to its own fixed size buffer, interrupts share
+ * one more, so recording never allocates and is safe anywhere, including
+ * interrupt handlers and decoders. Captured trace is exported as Chrome trace
+ * JSON, open it in ui.perfetto.dev or chrome://tracing.
+ *
+ * Probe ids are static: add new probes to TRACE_PROBES. While trace is not
+ * running probes cost a function call and a flag check.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "stream/stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Events per thread buffer when nothing else is requested */
+#define TRACE_EVENTS_DEFAULT (256)
+
+/** Threads that can record at once, events of other threads are dropped */
+#define TRACE_THREADS_MAX (8)
+
+/** Known probes: id, category and name shown in trace viewer */
+#define TRACE_PROBES(PROBE)                                                  \
+    PROBE(TraceProbeStorageMessage, "storage", "storage_process_message")   \
+    PROBE(TraceProbeStorageQueue, "storage", "storage_queue")               \
+    PROBE(TraceProbeGuiRedraw, "gui", "gui_redraw")                         \
+    PROBE(TraceProbeSubGhzDecode, "subghz", "subghz_receiver_decode")       \
+    PROBE(TraceProbeNfcPollerState, "nfc", "nfc_worker_poller_state")       \
+    PROBE(TraceProbeNfcListenerEvent, "nfc", "nfc_worker_listener_event")   \
+    PROBE(TraceProbeElfLoadSections, "elf", "elf_file_load_sections")
+
+#define TRACE_PROBE_ID(id, category, name) id,
+
+typedef enum {
+    TRACE_PROBES(TRACE_PROBE_ID) TraceProbeNum,
+} TraceProbe;
+
+#undef TRACE_PROBE_ID
+
+/** Start recording, previously captured trace is dropped
+ *
+ * Control functions (start, stop, clear, export) are not thread safe, call
+ * them from one thread.
+ *
+ * @param      events_per_thread  buffer size of every thread, in events
+ *
+ * @return     true if started, false if already running
+ */
+bool trace_start(size_t events_per_thread);
+
+/** Stop recording, captured trace is kept until cleared or started again */
+void trace_stop();
+
+/** Free captured trace */
+void trace_clear();
+
+/** Check if trace is recording
+ *
+ * @return     true if recording
+ */
+bool trace_is_running();
+
+/** Get count of events dropped because buffers were full
+ *
+ * @return     dropped events count of current trace
+ */
+uint32_t trace_get_dropped_count();
+
+/** Record start of probe duration
+ *
+ * @param      probe  TraceProbe
+ */
+void trace_begin(TraceProbe probe);
+
+/** Record end of probe duration
+ *
+ * @param      probe  TraceProbe
+ */
+void trace_end(TraceProbe probe);
+
+/** Record probe counter value
+ *
+ * @param      probe  TraceProbe
+ * @param      value  counter value
+ */
+void trace_counter(TraceProbe probe, uint32_t value);
+
+/** Write captured trace in Chrome trace JSON format
+ *
+ * Timestamps are relative to trace start and wrap with the cycle counter,
+ * keep traces shorter than a minute.
+ *
+ * @param      stream  Stream to write to
+ *
+ * @return     true if written, false if trace is running, empty or on write error
+ */
+bool trace_export(Stream* stream);
+
+#ifdef __cplusplus
+}
+#endif
@@ -38,39 +38,28 @@ size_t varint_uint32_length(uint32_t value) {
     return size;
 }
 
-size_t varint_int32_pack(int32_t value, uint8_t* output) {
-    uint32_t v;
+/* Zigzag in uint32_t: shifts and negation of int32_t overflow at the extremes */
+static uint32_t varint_zigzag_encode(int32_t value) {
+    return ((uint32_t)value << 1) ^ (value < 0 ? UINT32_MAX : 0);
+}
 
-    if(value >= 0) {
-        v = value * 2;
-    } else {
-        v = (value * -2) - 1;
-    }
+static int32_t varint_zigzag_decode(uint32_t value) {
+    return (int32_t)((value >> 1) ^ (0U - (value & 1)));
+}
 
-    return varint_uint32_pack(v, output);
+size_t varint_int32_pack(int32_t value, uint8_t* output) {
+    return varint_uint32_pack(varint_zigzag_encode(value), output);
 }
 
 size_t varint_int32_unpack(int32_t* value, const uint8_t* input, size_t input_size) {
     uint32_t v;
     size_t size = varint_uint32_unpack(&v, input, input_size);
 
-    if(v & 1) {
-        *value = (int32_t)(v + 1) / (-2);
-    } else {
-        *value = v / 2;
-    }
+    *value = varint_zigzag_decode(v);
 
     return size;
 }
 
 size_t varint_int32_length(int32_t value) {
-    uint32_t v;
-
-    if(value >= 0) {
-        v = value * 2;
-    } else {
-        v = (value * -2) - 1;
-    }
-
-    return varint_uint32_length(v);
+    return varint_uint32_length(varint_zigzag_encode(value));
 }
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+# Decoder for binary log dumps, see FuriLogModeBinary in furi/core/log.h
+#
+# Capture the output of `log debug binary` CLI command to a file and run:
+#   ./scripts/log_decode.py build/latest/firmware.elf dump.bin
+#
+
+import re
+import struct
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from flipper.app import App
+
+MAGIC = b"\xF1\x06"
+# size, tick, tag, format, level, flags, args_size
+HEADER = struct.Struct("<IIIIBBH")
+RECORD_SIZE_MAX = 192
+RECORD_FLAG_TRUNCATED = 1 << 0
+
+LEVELS = {2: "E", 3: "W", 4: "I", 5: "D", 6: "T"}
+
+# Same conversions as furi_log_conversion_next()
+CONVERSION = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d*)(?:\.(?P<precision>\*|\d*))?"
+    r"(?P<length>hh|ll|[hljztL])?(?P<conversion>.?)",
+    re.DOTALL,
+)
+
+
+class StringTable:
+    def __init__(self, elf_path):
+        self.sections = []
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if not section["sh_flags"] & SH_FLAGS.SHF_ALLOC:
+                    continue
+                if section["sh_type"] == "SHT_NOBITS":
+                    continue
+                self.sections.append((section["sh_addr"], section.data()))
+
+    def get(self, address):
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                end = data.find(b"\0", address - start)
+                return data[address - start : end].decode("utf-8", "replace")
+        return None
+
+
+class ArgsReader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def integer(self, is_signed):
+        if self.offset + 8 > len(self.data):
+            raise EOFError
+        value = struct.unpack_from("<q" if is_signed else "<Q", self.data, self.offset)[0]
+        self.offset += 8
+        return value
+
+    def double(self):
+        if self.offset + 8 > len(self.data):
+            raise EOFError
+        value = struct.unpack_from("<d", self.data, self.offset)[0]
+        self.offset += 8
+        return value
+
+    def string(self):
+        end = self.data.find(b"\0", self.offset)
+        if end < 0:
+            raise EOFError
+        value = self.data[self.offset : end].decode("utf-8", "replace")
+        self.offset = (end + 1 + 3) & ~3
+        return value
+
+
+def format_record(format_string, args, is_truncated):
+    output = []
+    position = 0
+    try:
+        for match in CONVERSION.finditer(format_string):
+            output.append(format_string[position : match.start()])
+            position = match.end()
+            flags, width, precision, conversion = match.group(
+                "flags", "width", "precision", "conversion"
+            )
+            if width == "*":
+                width = str(args.integer(True))
+            if precision == "*":
+                precision = str(args.integer(True))
+            spec = "%" + flags + width + ("." + precision if precision is not None else "")
+
+            if conversion == "%":
+                output.append("%")
+            elif conversion in "di":
+                output.append((spec + "d") % args.integer(True))
+            elif conversion in "ouxXc":
+                output.append((spec + conversion) % args.integer(False))
+            elif conversion == "p":
+                output.append((spec + "s") % hex(args.integer(False)))
+            elif conversion in "fFeEgGaA":
+                conversion = "f" if conversion in "aA" else conversion
+                output.append((spec + conversion) % args.double())
+            elif conversion == "s":
+                output.append((spec + "s") % args.string())
+            elif conversion == "n":
+                pass
+            else:
+                raise EOFError
+    except EOFError:
+        is_truncated = True
+
+    if is_truncated:
+        output.append("...")
+    else:
+        output.append(format_string[position:])
+    return "".join(output)
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("elf", help="Firmware ELF file the dump was made with")
+        self.parser.add_argument("dump", help="Binary log dump")
+        self.parser.set_defaults(func=self.decode)
+
+    def decode(self):
+        strings = StringTable(self.args.elf)
+        with open(self.args.dump, "rb") as f:
+            dump = f.read()
+
+        records = 0
+        position = dump.find(MAGIC)
+        while position >= 0:
+            record = dump[position + len(MAGIC) :]
+            if len(record) < HEADER.size:
+                break
+            size, tick, tag, format_address, level, flags, args_size = HEADER.unpack_from(
+                record
+            )
+            if not HEADER.size <= size <= RECORD_SIZE_MAX or args_size != size - HEADER.size:
+                # Not a record, magic bytes in other output
+                position = dump.find(MAGIC, position + 1)
+                continue
+
+            args = ArgsReader(record[HEADER.size : size])
+            format_string = strings.get(format_address)
+            if format_string is None:
+                message = f"<format at 0x{format_address:08x}>"
+            else:
+                message = format_record(
+                    format_string, args, flags & RECORD_FLAG_TRUNCATED
+                )
+
+            if tag:
+                tag_string = strings.get(tag) or f"0x{tag:08x}"
+                sys.stdout.write(
+                    f"{tick} [{LEVELS.get(level, ' ')}][{tag_string}] {message}\n"
+                )
+            else:
+                sys.stdout.write(message)
+
+            records += 1
+            position = dump.find(MAGIC, position + len(MAGIC) + size)
+
+        self.logger.info(f"Decoded {records} records")
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
@@ -2,7 +2,6 @@
 #include <stm32wbxx_ll_gpio.h>
 #include <furi.h>
 #include <furi_hal.h>
-#include "../fatfs/sector_cache.h"
 #define TAG "SdSpi"
 
 #ifdef FURI_HAL_SD_SPI_DEBUG
@@ -18,9 +17,22 @@
 #define SD_TIMEOUT_MS (1000)
 #define SD_BLOCK_SIZE (512)
 
+// Sector cache: FAT and directory sectors with read ahead, 10KiB from memory pool
+#define SD_CACHE_SETS (4)
+#define SD_CACHE_WAYS (4)
+#define SD_CACHE_PREFETCH (3)
+// Same footprint as before when pool is short
+#define SD_CACHE_SMALL_SETS (2)
+#define SD_CACHE_SMALL_WAYS (4)
+// Keeping written sectors in RAM until sync, off until every unmount path is known to flush
+#ifndef SD_CACHE_WRITE_BACK
+#define SD_CACHE_WRITE_BACK (0)
+#endif
+
 #define FLAG_SET(x, y) (((x) & (y)) == (y))
 
 static bool sd_high_capacity = false;
+static SectorCache* sd_cache = NULL;
 
 typedef enum {
     SdSpiDataResponceOK = 0x05,
@@ -816,27 +828,6 @@ static FuriStatus sd_spi_get_card_state(void) {
     return FuriStatusError;
 }
 
-static inline bool sd_cache_get(uint32_t address, uint32_t* data) {
-    uint8_t* cached_data = sector_cache_get(address);
-    if(cached_data) {
-        memcpy(data, cached_data, SD_BLOCK_SIZE);
-        return true;
-    }
-    return false;
-}
-
-static inline void sd_cache_put(uint32_t address, uint32_t* data) {
-    sector_cache_put(address, (uint8_t*)data);
-}
-
-static inline void sd_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
-    sector_cache_invalidate_range(start_sector, end_sector);
-}
-
-static inline void sd_cache_invalidate_all() {
-    sector_cache_init();
-}
-
 static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count) {
     FuriStatus status = FuriStatusError;
 
@@ -877,8 +868,6 @@ static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_
             status = sd_spi_get_card_state();
 
             if(furi_hal_cortex_timer_is_expired(timer)) {
-                sd_cache_invalidate_all();
-
                 status = FuriStatusErrorTimeout;
                 break;
             }
@@ -911,7 +900,7 @@ uint8_t furi_hal_sd_max_mount_retry_count() {
     return 10;
 }
 
-FuriStatus furi_hal_sd_init(bool power_reset) {
+static FuriStatus sd_init(bool power_reset) {
     // Slow speed init
     furi_hal_spi_acquire(&furi_hal_spi_bus_handle_sd_slow);
     furi_hal_sd_spi_handle = &furi_hal_spi_bus_handle_sd_slow;
@@ -953,9 +942,6 @@ FuriStatus furi_hal_sd_init(bool power_reset) {
     furi_hal_sd_spi_handle = NULL;
     furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_slow);
 
-    // Init sector cache
-    sector_cache_init();
-
     return status;
 }
 
@@ -971,17 +957,8 @@ FuriStatus furi_hal_sd_get_card_state(void) {
     return status;
 }
 
-FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
-    FuriStatus status;
-    bool single_sector = count == 1;
-
-    if(single_sector) {
-        if(sd_cache_get(sector, buff)) {
-            return FuriStatusOk;
-        }
-    }
-
-    status = sd_device_read(buff, sector, count);
+static FuriStatus sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = sd_device_read(buff, sector, count);
 
     if(status != FuriStatusOk) {
         uint8_t counter = furi_hal_sd_max_mount_retry_count();
@@ -989,9 +966,9 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         while(status != FuriStatusOk && counter > 0 && furi_hal_sd_is_present()) {
             if((counter % 2) == 0) {
                 // power reset sd card
-                status = furi_hal_sd_init(true);
+                status = sd_init(true);
             } else {
-                status = furi_hal_sd_init(false);
+                status = sd_init(false);
             }
 
             if(status == FuriStatusOk) {
@@ -1001,19 +978,11 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         }
     }
 
-    if(single_sector && status == FuriStatusOk) {
-        sd_cache_put(sector, buff);
-    }
-
     return status;
 }
 
-FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint32_t count) {
-    FuriStatus status;
-
-    sd_cache_invalidate_range(sector, sector + count);
-
-    status = sd_device_write(buff, sector, count);
+static FuriStatus sd_write_blocks(const uint32_t* buff, uint32_t sector, uint32_t count) {
+    FuriStatus status = sd_device_write(buff, sector, count);
 
     if(status != FuriStatusOk) {
         uint8_t counter = furi_hal_sd_max_mount_retry_count();
@@ -1021,9 +990,9 @@ FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint3
         while(status != FuriStatusOk && counter > 0 && furi_hal_sd_is_present()) {
             if((counter % 2) == 0) {
                 // power reset sd card
-                status = furi_hal_sd_init(true);
+                status = sd_init(true);
             } else {
-                status = furi_hal_sd_init(false);
+                status = sd_init(false);
             }
 
             if(status == FuriStatusOk) {
@@ -1036,6 +1005,94 @@ FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint3
     return status;
 }
 
+static bool sd_cache_read_callback(void* context, uint8_t* data, uint32_t sector, uint32_t count) {
+    UNUSED(context);
+    return sd_read_blocks((uint32_t*)data, sector, count) == FuriStatusOk;
+}
+
+static bool
+    sd_cache_write_callback(void* context, const uint8_t* data, uint32_t sector, uint32_t count) {
+    UNUSED(context);
+    return sd_write_blocks((const uint32_t*)data, sector, count) == FuriStatusOk;
+}
+
+static void sd_cache_reset(void) {
+    if(sd_cache == NULL) {
+        SectorCacheConfig config = {
+            .sets = SD_CACHE_SETS,
+            .ways = SD_CACHE_WAYS,
+            .prefetch = SD_CACHE_PREFETCH,
+            .write_back = SD_CACHE_WRITE_BACK,
+        };
+        if(memmgr_pool_get_max_block() < sector_cache_get_memory_size(&config)) {
+            config.sets = SD_CACHE_SMALL_SETS;
+            config.ways = SD_CACHE_SMALL_WAYS;
+            config.prefetch = 0;
+        }
+
+        // Pool memory can't be freed, cache lives until reboot
+        void* memory = memmgr_alloc_from_pool(sector_cache_get_memory_size(&config));
+        sd_cache = sector_cache_init(
+            memory, &config, sd_cache_read_callback, sd_cache_write_callback, NULL);
+    } else {
+        // Dirty sectors are flushed by furi_hal_sd_init, what is left belongs to a removed card
+        sector_cache_invalidate(sd_cache);
+    }
+
+    sector_cache_set_priority_range(sd_cache, 0, 0);
+    sector_cache_set_sectors_count(sd_cache, 0);
+}
+
+FuriStatus furi_hal_sd_init(bool power_reset) {
+    // Write back while the card still runs with the old init, re-init drops the cache
+    if(sd_cache && furi_hal_sd_is_present() && !sector_cache_flush(sd_cache)) {
+        FURI_LOG_E(TAG, "Cache flush failed, dirty sectors dropped");
+    }
+
+    FuriStatus status = sd_init(power_reset);
+
+    sd_cache_reset();
+
+    // Read ahead must not run past the card end
+    FuriHalSdInfo info;
+    if(status == FuriStatusOk && furi_hal_sd_info(&info) == FuriStatusOk) {
+        sector_cache_set_sectors_count(sd_cache, info.logical_block_count);
+    }
+
+    return status;
+}
+
+FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t count) {
+    furi_check(sd_cache);
+    return sector_cache_read(sd_cache, (uint8_t*)buff, sector, count) ? FuriStatusOk :
+                                                                         FuriStatusError;
+}
+
+FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint32_t count) {
+    furi_check(sd_cache);
+    return sector_cache_write(sd_cache, (const uint8_t*)buff, sector, count) ? FuriStatusOk :
+                                                                                FuriStatusError;
+}
+
+FuriStatus furi_hal_sd_sync(void) {
+    if(sd_cache == NULL) return FuriStatusOk;
+    return sector_cache_flush(sd_cache) ? FuriStatusOk : FuriStatusError;
+}
+
+void furi_hal_sd_cache_set_priority_range(uint32_t start_sector, uint32_t end_sector) {
+    furi_check(sd_cache);
+    sector_cache_set_priority_range(sd_cache, start_sector, end_sector);
+}
+
+void furi_hal_sd_cache_get_stats(SectorCacheStats* stats) {
+    furi_check(stats);
+    if(sd_cache) {
+        sector_cache_get_stats(sd_cache, stats);
+    } else {
+        memset(stats, 0, sizeof(SectorCacheStats));
+    }
+}
+
 FuriStatus furi_hal_sd_info(FuriHalSdInfo* info) {
     FuriStatus status;
     SD_CSD csd;
@@ -34,6 +34,15 @@ void furi_hal_cortex_delay_us(uint32_t microseconds);
  */
 uint32_t furi_hal_cortex_instructions_per_microsecond();
 
+/** Get cycle counter
+ *
+ * Free running counter clocked by the core, wraps around every 67 seconds at
+ * 64MHz. Cheap to read and safe to use from interrupts.
+ *
+ * @return     current cycle count
+ */
+uint32_t furi_hal_cortex_get_cycle_count();
+
 /** Get Timer
  *
  * @param[in]  timeout_us  The expire timeout in us
@@ -5,6 +5,7 @@
  */
 
 #include <furi.h>
+#include <toolbox/sector_cache.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +46,7 @@ uint8_t furi_hal_sd_max_mount_retry_count();
 
 /**
  * @brief Init SD card
+ * Sectors still dirty in the write-back cache are written first if card is present
  * @param power_reset reset card power
  * @return FuriStatus 
  */
@@ -81,6 +83,27 @@ FuriStatus furi_hal_sd_info(FuriHalSdInfo* info);
  */
 FuriStatus furi_hal_sd_get_card_state();
 
+/**
+ * @brief Write sectors held by the cache to SD card
+ * Cache is write-through unless built with SD_CACHE_WRITE_BACK, then up to 16 written
+ * sectors stay in RAM until sync or eviction and are lost on power loss or card removal
+ * @return FuriStatus 
+ */
+FuriStatus furi_hal_sd_sync(void);
+
+/**
+ * @brief Set sectors range kept in cache over other data, e.g. FAT
+ * @param start_sector first sector of the range
+ * @param end_sector sector after the range
+ */
+void furi_hal_sd_cache_set_priority_range(uint32_t start_sector, uint32_t end_sector);
+
+/**
+ * @brief Get sector cache statistics
+ * @param stats statistics output
+ */
+void furi_hal_sd_cache_get_stats(SectorCacheStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
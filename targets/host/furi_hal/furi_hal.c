@@ -0,0 +1,53 @@
+#include <furi_hal.h>
+
+#define TAG "FuriHal"
+
+bool normal_boot = false;
+
+void furi_hal_set_is_normal_boot(bool value) {
+    normal_boot = value;
+}
+
+bool furi_hal_is_normal_boot() {
+    return normal_boot;
+}
+
+void furi_hal_init_early() {
+    furi_hal_cortex_init_early();
+    furi_hal_resources_init_early();
+    furi_hal_os_init();
+    furi_hal_light_init();
+    furi_hal_rtc_init_early();
+}
+
+void furi_hal_deinit_early() {
+    furi_hal_rtc_deinit_early();
+    furi_hal_resources_deinit_early();
+}
+
+void furi_hal_init() {
+    furi_hal_memory_init();
+    furi_hal_rtc_init();
+    furi_hal_crypto_init();
+    furi_hal_version_init();
+    furi_hal_random_init();
+    furi_hal_resources_init();
+    furi_hal_power_init();
+
+    FURI_LOG_I(TAG, "Init OK");
+}
+
+void furi_hal_resources_init_early() {
+}
+
+void furi_hal_resources_deinit_early() {
+}
+
+void furi_hal_resources_init() {
+}
+
+void furi_hal_os_init() {
+}
+
+void furi_hal_os_tick() {
+}
@@ -0,0 +1,48 @@
+/**
+ * @file furi_hal.h
+ * Furi HAL API, host subset
+ *
+ * Host target implements only the parts of Furi HAL that target independent
+ * code relies on: time keeping, RTC registers, power/reset and a few
+ * informational getters and the SubGhz settings used by protocol code.
+ * Radio, display, USB and other peripherals are not available and their
+ * headers are deliberately not included here.
+ */
+
+#pragma once
+
+#include <furi_hal_cortex.h>
+#include <furi_hal_crypto.h>
+#include <furi_hal_debug.h>
+#include <furi_hal_os.h>
+#include <furi_hal_rtc.h>
+#include <furi_hal_light.h>
+#include <furi_hal_memory.h>
+#include <furi_hal_power.h>
+#include <furi_hal_random.h>
+#include <furi_hal_subghz.h>
+#include <furi_hal_version.h>
+#include <furi_hal_resources.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Set whether booting normally with all subsystems */
+void furi_hal_set_is_normal_boot(bool value);
+
+/** True if booting normally with all subsystems */
+bool furi_hal_is_normal_boot();
+
+/** Early FuriHal init, only essential subsystems */
+void furi_hal_init_early();
+
+/** Early FuriHal deinit */
+void furi_hal_deinit_early();
+
+/** Init FuriHal */
+void furi_hal_init();
+
+#ifdef __cplusplus
+}
+#endif
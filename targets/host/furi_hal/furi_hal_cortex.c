@@ -0,0 +1,69 @@
+#include <furi_hal_cortex.h>
+#include <furi.h>
+
+#include <stm32wbxx.h>
+#include <time.h>
+
+/* Host has no DWT, cycle counter is emulated from monotonic clock running at
+   the same nominal frequency as the target core. This keeps cycle based
+   measurements comparable between host and device. */
+#define FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND (SystemCoreClock / 1000000)
+
+uint32_t furi_hal_cortex_get_cycle_count() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t nanoseconds = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+    return (uint32_t)(nanoseconds * FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND / 1000);
+}
+
+void furi_hal_cortex_init_early() {
+}
+
+void furi_hal_cortex_delay_us(uint32_t microseconds) {
+    furi_check(microseconds < (UINT32_MAX / FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND));
+
+    uint32_t start = furi_hal_cortex_get_cycle_count();
+    uint32_t time_ticks = FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND * microseconds;
+
+    while((furi_hal_cortex_get_cycle_count() - start) < time_ticks) {
+    };
+}
+
+uint32_t furi_hal_cortex_instructions_per_microsecond() {
+    return FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND;
+}
+
+FuriHalCortexTimer furi_hal_cortex_timer_get(uint32_t timeout_us) {
+    furi_check(timeout_us < (UINT32_MAX / FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND));
+
+    FuriHalCortexTimer cortex_timer = {0};
+    cortex_timer.start = furi_hal_cortex_get_cycle_count();
+    cortex_timer.value = FURI_HAL_CORTEX_INSTRUCTIONS_PER_MICROSECOND * timeout_us;
+    return cortex_timer;
+}
+
+bool furi_hal_cortex_timer_is_expired(FuriHalCortexTimer cortex_timer) {
+    return !((furi_hal_cortex_get_cycle_count() - cortex_timer.start) < cortex_timer.value);
+}
+
+void furi_hal_cortex_timer_wait(FuriHalCortexTimer cortex_timer) {
+    while(!furi_hal_cortex_timer_is_expired(cortex_timer))
+        ;
+}
+
+void furi_hal_cortex_comp_enable(
+    FuriHalCortexComp comp,
+    FuriHalCortexCompFunction function,
+    uint32_t value,
+    uint32_t mask,
+    FuriHalCortexCompSize size) {
+    UNUSED(comp);
+    UNUSED(function);
+    UNUSED(value);
+    UNUSED(mask);
+    UNUSED(size);
+}
+
+void furi_hal_cortex_comp_reset(FuriHalCortexComp comp) {
+    UNUSED(comp);
+}
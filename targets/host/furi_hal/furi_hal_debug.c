@@ -0,0 +1,13 @@
+#include <furi_hal_debug.h>
+
+static volatile bool furi_hal_debug_gdb_session_active = false;
+
+void furi_hal_debug_enable() {
+}
+
+void furi_hal_debug_disable() {
+}
+
+bool furi_hal_debug_is_gdb_session_active() {
+    return furi_hal_debug_gdb_session_active;
+}
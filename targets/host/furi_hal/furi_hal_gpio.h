@@ -0,0 +1,26 @@
+/**
+ * @file furi_hal_gpio.h
+ * GPIO HAL API, host subset
+ *
+ * Only the pin descriptor type is provided so that portable headers
+ * referencing it compile. There are no pins on host.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Gpio structure */
+typedef struct {
+    void* port;
+    uint16_t pin;
+} GpioPin;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,28 @@
+#include <furi_hal_light.h>
+#include <furi.h>
+
+void furi_hal_light_init() {
+}
+
+void furi_hal_light_set(Light light, uint8_t value) {
+    UNUSED(light);
+    UNUSED(value);
+}
+
+void furi_hal_light_blink_start(Light light, uint8_t brightness, uint16_t on_time, uint16_t period) {
+    UNUSED(light);
+    UNUSED(brightness);
+    UNUSED(on_time);
+    UNUSED(period);
+}
+
+void furi_hal_light_blink_stop() {
+}
+
+void furi_hal_light_blink_set_color(Light light) {
+    UNUSED(light);
+}
+
+void furi_hal_light_sequence(const char* sequence) {
+    UNUSED(sequence);
+}
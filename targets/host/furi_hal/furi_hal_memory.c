@@ -0,0 +1,20 @@
+#include <furi_hal_memory.h>
+#include <furi.h>
+
+/* There is no SRAM2 pool on host, pool allocations fall back to heap in memmgr */
+
+void furi_hal_memory_init() {
+}
+
+void* furi_hal_memory_alloc(size_t size) {
+    UNUSED(size);
+    return NULL;
+}
+
+size_t furi_hal_memory_get_free() {
+    return 0;
+}
+
+size_t furi_hal_memory_max_pool_block() {
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <furi_hal_power.h>
+#include <furi.h>
+
+#include <stdlib.h>
+
+#define TAG "FuriHalPower"
+
+/* Host process is always "on external power": no gauge, no charger, no sleep */
+
+void furi_hal_power_init() {
+    FURI_LOG_I(TAG, "Init OK");
+}
+
+bool furi_hal_power_gauge_is_ok() {
+    return true;
+}
+
+bool furi_hal_power_is_shutdown_requested() {
+    return false;
+}
+
+uint16_t furi_hal_power_insomnia_level() {
+    return 0;
+}
+
+void furi_hal_power_insomnia_enter() {
+}
+
+void furi_hal_power_insomnia_exit() {
+}
+
+bool furi_hal_power_sleep_available() {
+    return false;
+}
+
+void furi_hal_power_sleep() {
+}
+
+uint8_t furi_hal_power_get_pct() {
+    return 100;
+}
+
+uint8_t furi_hal_power_get_bat_health_pct() {
+    return 100;
+}
+
+bool furi_hal_power_is_charging() {
+    return false;
+}
+
+bool furi_hal_power_is_charging_done() {
+    return true;
+}
+
+void furi_hal_power_shutdown() {
+    exit(EXIT_SUCCESS);
+}
+
+void furi_hal_power_off() {
+    exit(EXIT_SUCCESS);
+}
+
+void furi_hal_power_reset() {
+    exit(EXIT_FAILURE);
+}
@@ -0,0 +1,22 @@
+#include <furi_hal_random.h>
+#include <furi.h>
+
+#include <sys/random.h>
+
+void furi_hal_random_init() {
+}
+
+uint32_t furi_hal_random_get() {
+    uint32_t value = 0;
+    furi_hal_random_fill_buf((uint8_t*)&value, sizeof(value));
+    return value;
+}
+
+void furi_hal_random_fill_buf(uint8_t* buf, uint32_t len) {
+    while(len > 0) {
+        ssize_t filled = getrandom(buf, len, 0);
+        furi_check(filled > 0);
+        buf += filled;
+        len -= filled;
+    }
+}
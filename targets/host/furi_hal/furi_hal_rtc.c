@@ -0,0 +1,280 @@
+#include <furi_hal_rtc.h>
+#include <furi_hal_debug.h>
+
+#include <furi.h>
+#include <time.h>
+
+#define TAG "FuriHalRtc"
+
+/* Backup domain does not survive process restart on host, registers live in RAM */
+typedef struct {
+    uint32_t registers[FuriHalRtcRegisterMAX];
+    uint8_t log_level;
+    uint8_t flags;
+    FuriHalRtcBootMode boot_mode;
+    FuriHalRtcHeapTrackMode heap_track_mode;
+    FuriHalRtcLocaleUnits locale_units;
+    FuriHalRtcLocaleTimeFormat locale_timeformat;
+    FuriHalRtcLocaleDateFormat locale_dateformat;
+    FuriHalRtcLogDevice log_device;
+    FuriHalRtcLogBaudRate log_baud_rate;
+    int64_t datetime_offset;
+} FuriHalRtc;
+
+#define FURI_HAL_RTC_SECONDS_PER_MINUTE 60
+#define FURI_HAL_RTC_SECONDS_PER_HOUR (FURI_HAL_RTC_SECONDS_PER_MINUTE * 60)
+#define FURI_HAL_RTC_SECONDS_PER_DAY (FURI_HAL_RTC_SECONDS_PER_HOUR * 24)
+#define FURI_HAL_RTC_MONTHS_COUNT 12
+#define FURI_HAL_RTC_EPOCH_START_YEAR 1970
+
+static const uint8_t furi_hal_rtc_days_per_month[2][FURI_HAL_RTC_MONTHS_COUNT] = {
+    {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+    {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}};
+
+static const uint16_t furi_hal_rtc_days_per_year[] = {365, 366};
+
+static FuriHalRtc furi_hal_rtc = {
+    .log_level = FuriLogLevelDefault,
+    .log_device = FuriHalRtcLogDeviceNone,
+};
+
+void furi_hal_rtc_init_early() {
+}
+
+void furi_hal_rtc_deinit_early() {
+}
+
+void furi_hal_rtc_init() {
+    furi_log_set_level(furi_hal_rtc.log_level);
+    FURI_LOG_I(TAG, "Init OK");
+}
+
+void furi_hal_rtc_sync_shadow() {
+}
+
+void furi_hal_rtc_reset_registers() {
+    memset(furi_hal_rtc.registers, 0, sizeof(furi_hal_rtc.registers));
+}
+
+uint32_t furi_hal_rtc_get_register(FuriHalRtcRegister reg) {
+    furi_check(reg < FuriHalRtcRegisterMAX);
+    return furi_hal_rtc.registers[reg];
+}
+
+void furi_hal_rtc_set_register(FuriHalRtcRegister reg, uint32_t value) {
+    furi_check(reg < FuriHalRtcRegisterMAX);
+    furi_hal_rtc.registers[reg] = value;
+}
+
+void furi_hal_rtc_set_log_level(uint8_t level) {
+    furi_hal_rtc.log_level = level;
+    furi_log_set_level(level);
+}
+
+uint8_t furi_hal_rtc_get_log_level() {
+    return furi_hal_rtc.log_level;
+}
+
+void furi_hal_rtc_set_log_device(FuriHalRtcLogDevice device) {
+    furi_hal_rtc.log_device = device;
+}
+
+FuriHalRtcLogDevice furi_hal_rtc_get_log_device() {
+    return furi_hal_rtc.log_device;
+}
+
+void furi_hal_rtc_set_log_baud_rate(FuriHalRtcLogBaudRate baud_rate) {
+    furi_hal_rtc.log_baud_rate = baud_rate;
+}
+
+FuriHalRtcLogBaudRate furi_hal_rtc_get_log_baud_rate() {
+    return furi_hal_rtc.log_baud_rate;
+}
+
+void furi_hal_rtc_set_flag(FuriHalRtcFlag flag) {
+    furi_hal_rtc.flags |= flag;
+
+    if(flag & FuriHalRtcFlagDebug) {
+        furi_hal_debug_enable();
+    }
+}
+
+void furi_hal_rtc_reset_flag(FuriHalRtcFlag flag) {
+    furi_hal_rtc.flags &= ~flag;
+
+    if(flag & FuriHalRtcFlagDebug) {
+        furi_hal_debug_disable();
+    }
+}
+
+bool furi_hal_rtc_is_flag_set(FuriHalRtcFlag flag) {
+    return furi_hal_rtc.flags & flag;
+}
+
+void furi_hal_rtc_set_boot_mode(FuriHalRtcBootMode mode) {
+    furi_hal_rtc.boot_mode = mode;
+}
+
+FuriHalRtcBootMode furi_hal_rtc_get_boot_mode() {
+    return furi_hal_rtc.boot_mode;
+}
+
+void furi_hal_rtc_set_heap_track_mode(FuriHalRtcHeapTrackMode mode) {
+    furi_hal_rtc.heap_track_mode = mode;
+}
+
+FuriHalRtcHeapTrackMode furi_hal_rtc_get_heap_track_mode() {
+    return furi_hal_rtc.heap_track_mode;
+}
+
+void furi_hal_rtc_set_locale_units(FuriHalRtcLocaleUnits value) {
+    furi_hal_rtc.locale_units = value;
+}
+
+FuriHalRtcLocaleUnits furi_hal_rtc_get_locale_units() {
+    return furi_hal_rtc.locale_units;
+}
+
+void furi_hal_rtc_set_locale_timeformat(FuriHalRtcLocaleTimeFormat value) {
+    furi_hal_rtc.locale_timeformat = value;
+}
+
+FuriHalRtcLocaleTimeFormat furi_hal_rtc_get_locale_timeformat() {
+    return furi_hal_rtc.locale_timeformat;
+}
+
+void furi_hal_rtc_set_locale_dateformat(FuriHalRtcLocaleDateFormat value) {
+    furi_hal_rtc.locale_dateformat = value;
+}
+
+FuriHalRtcLocaleDateFormat furi_hal_rtc_get_locale_dateformat() {
+    return furi_hal_rtc.locale_dateformat;
+}
+
+void furi_hal_rtc_set_datetime(FuriHalRtcDateTime* datetime) {
+    furi_assert(datetime);
+    // Host clock is not ours to change, remember the offset from it instead
+    int64_t timestamp = furi_hal_rtc_datetime_to_timestamp(datetime);
+    furi_hal_rtc.datetime_offset = timestamp - (int64_t)time(NULL);
+}
+
+void furi_hal_rtc_get_datetime(FuriHalRtcDateTime* datetime) {
+    furi_assert(datetime);
+    uint32_t timestamp = (uint32_t)((int64_t)time(NULL) + furi_hal_rtc.datetime_offset);
+    furi_hal_rtc_timestamp_to_datetime(timestamp, datetime);
+    // 1970-01-01 was Thursday, RTC weekday is 1-7 starting from Monday
+    datetime->weekday = ((timestamp / FURI_HAL_RTC_SECONDS_PER_DAY + 3) % 7) + 1;
+}
+
+bool furi_hal_rtc_validate_datetime(FuriHalRtcDateTime* datetime) {
+    bool invalid = false;
+
+    invalid |= (datetime->second > 59);
+    invalid |= (datetime->minute > 59);
+    invalid |= (datetime->hour > 23);
+
+    invalid |= (datetime->year < 2000);
+    invalid |= (datetime->year > 2099);
+
+    invalid |= (datetime->month == 0);
+    invalid |= (datetime->month > 12);
+
+    invalid |= (datetime->day == 0);
+    invalid |= (datetime->day > 31);
+
+    invalid |= (datetime->weekday == 0);
+    invalid |= (datetime->weekday > 7);
+
+    return !invalid;
+}
+
+void furi_hal_rtc_set_fault_data(uint32_t value) {
+    furi_hal_rtc_set_register(FuriHalRtcRegisterFaultData, value);
+}
+
+uint32_t furi_hal_rtc_get_fault_data() {
+    return furi_hal_rtc_get_register(FuriHalRtcRegisterFaultData);
+}
+
+void furi_hal_rtc_set_pin_fails(uint32_t value) {
+    furi_hal_rtc_set_register(FuriHalRtcRegisterPinFails, value);
+}
+
+uint32_t furi_hal_rtc_get_pin_fails() {
+    return furi_hal_rtc_get_register(FuriHalRtcRegisterPinFails);
+}
+
+uint32_t furi_hal_rtc_get_timestamp() {
+    FuriHalRtcDateTime datetime = {0};
+    furi_hal_rtc_get_datetime(&datetime);
+    return furi_hal_rtc_datetime_to_timestamp(&datetime);
+}
+
+uint32_t furi_hal_rtc_datetime_to_timestamp(FuriHalRtcDateTime* datetime) {
+    uint32_t timestamp = 0;
+    uint8_t years = 0;
+    uint8_t leap_years = 0;
+
+    for(uint16_t y = FURI_HAL_RTC_EPOCH_START_YEAR; y < datetime->year; y++) {
+        if(furi_hal_rtc_is_leap_year(y)) {
+            leap_years++;
+        } else {
+            years++;
+        }
+    }
+
+    timestamp +=
+        ((years * furi_hal_rtc_days_per_year[0]) + (leap_years * furi_hal_rtc_days_per_year[1])) *
+        FURI_HAL_RTC_SECONDS_PER_DAY;
+
+    bool leap_year = furi_hal_rtc_is_leap_year(datetime->year);
+
+    for(uint8_t m = 1; m < datetime->month; m++) {
+        timestamp += furi_hal_rtc_get_days_per_month(leap_year, m) * FURI_HAL_RTC_SECONDS_PER_DAY;
+    }
+
+    timestamp += (datetime->day - 1) * FURI_HAL_RTC_SECONDS_PER_DAY;
+    timestamp += datetime->hour * FURI_HAL_RTC_SECONDS_PER_HOUR;
+    timestamp += datetime->minute * FURI_HAL_RTC_SECONDS_PER_MINUTE;
+    timestamp += datetime->second;
+
+    return timestamp;
+}
+
+void furi_hal_rtc_timestamp_to_datetime(uint32_t timestamp, FuriHalRtcDateTime* datetime) {
+    uint32_t days = timestamp / FURI_HAL_RTC_SECONDS_PER_DAY;
+    uint32_t seconds_in_day = timestamp % FURI_HAL_RTC_SECONDS_PER_DAY;
+
+    datetime->year = FURI_HAL_RTC_EPOCH_START_YEAR;
+
+    while(days >= furi_hal_rtc_get_days_per_year(datetime->year)) {
+        days -= furi_hal_rtc_get_days_per_year(datetime->year);
+        (datetime->year)++;
+    }
+
+    datetime->month = 1;
+    while(days >= furi_hal_rtc_get_days_per_month(
+                      furi_hal_rtc_is_leap_year(datetime->year), datetime->month)) {
+        days -= furi_hal_rtc_get_days_per_month(
+            furi_hal_rtc_is_leap_year(datetime->year), datetime->month);
+        (datetime->month)++;
+    }
+
+    datetime->day = days + 1;
+    datetime->hour = seconds_in_day / FURI_HAL_RTC_SECONDS_PER_HOUR;
+    datetime->minute =
+        (seconds_in_day % FURI_HAL_RTC_SECONDS_PER_HOUR) / FURI_HAL_RTC_SECONDS_PER_MINUTE;
+    datetime->second = seconds_in_day % FURI_HAL_RTC_SECONDS_PER_MINUTE;
+}
+
+uint16_t furi_hal_rtc_get_days_per_year(uint16_t year) {
+    return furi_hal_rtc_days_per_year[furi_hal_rtc_is_leap_year(year) ? 1 : 0];
+}
+
+bool furi_hal_rtc_is_leap_year(uint16_t year) {
+    return (((year) % 4 == 0) && ((year) % 100 != 0)) || ((year) % 400 == 0);
+}
+
+uint8_t furi_hal_rtc_get_days_per_month(bool leap_year, uint8_t month) {
+    return furi_hal_rtc_days_per_month[leap_year ? 1 : 0][month - 1];
+}
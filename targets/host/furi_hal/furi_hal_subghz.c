@@ -0,0 +1,43 @@
+#include <furi_hal_subghz.h>
+#include <furi.h>
+
+typedef struct {
+    int8_t rolling_counter_mult;
+    bool ext_power_amp : 1;
+} FuriHalSubGhz;
+
+static FuriHalSubGhz furi_hal_subghz = {
+    .rolling_counter_mult = 1,
+    .ext_power_amp = false,
+};
+
+int8_t furi_hal_subghz_get_rolling_counter_mult(void) {
+    return furi_hal_subghz.rolling_counter_mult;
+}
+
+void furi_hal_subghz_set_rolling_counter_mult(int8_t mult) {
+    furi_hal_subghz.rolling_counter_mult = mult;
+}
+
+bool furi_hal_subghz_is_frequency_valid(uint32_t value) {
+    if(!(value >= 281000000 && value <= 361000000) &&
+       !(value >= 378000000 && value <= 481000000) &&
+       !(value >= 749000000 && value <= 962000000)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool furi_hal_subghz_is_tx_allowed(uint32_t value) {
+    UNUSED(value);
+    return false;
+}
+
+void furi_hal_subghz_set_ext_power_amp(bool enabled) {
+    furi_hal_subghz.ext_power_amp = enabled;
+}
+
+bool furi_hal_subghz_get_ext_power_amp() {
+    return furi_hal_subghz.ext_power_amp;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file furi_hal_subghz.h
+ * SubGhz HAL API, host subset
+ *
+ * There is no radio on host: only the settings that protocol code and
+ * subghz_setting consult are implemented.
+ */
+
+#pragma once
+
+#include <lib/subghz/devices/preset.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <toolbox/level_duration.h>
+#include <furi_hal_gpio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Check if frequency is in valid range
+ *
+ * @param      value  frequency in Hz
+ *
+ * @return     true if frequency is valid, otherwise false
+ */
+bool furi_hal_subghz_is_frequency_valid(uint32_t value);
+
+/** Get the current rolling protocols counter ++/-- value
+ * @return    int8_t current value
+ */
+int8_t furi_hal_subghz_get_rolling_counter_mult(void);
+
+/** Set the current rolling protocols counter ++/-- value
+ * @param      mult int8_t = -1, -10, -100, 0, 1, 10, 100 
+ */
+void furi_hal_subghz_set_rolling_counter_mult(int8_t mult);
+
+/** Check if transmission is allowed on this frequency, always false on host
+ *
+ * @param      value  frequency in Hz
+ *
+ * @return     true if allowed
+ */
+bool furi_hal_subghz_is_tx_allowed(uint32_t value);
+
+// External CC1101 Ebytes power amplifier control
+void furi_hal_subghz_set_ext_power_amp(bool enabled);
+
+bool furi_hal_subghz_get_ext_power_amp();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,91 @@
+#include <furi_hal_version.h>
+#include <furi.h>
+
+#define TAG "FuriHalVersion"
+
+static const uint8_t furi_hal_version_host_uid[8] = {'F', 'U', 'R', 'I', 'H', 'O', 'S', 'T'};
+static const uint8_t furi_hal_version_host_ble_mac[6] = {0};
+
+void furi_hal_version_init() {
+    FURI_LOG_I(TAG, "Init OK");
+}
+
+bool furi_hal_version_do_i_belong_here() {
+    return true;
+}
+
+const char* furi_hal_version_get_model_name() {
+    return "Flipper Zero Host";
+}
+
+const char* furi_hal_version_get_model_code() {
+    return "FZ.1";
+}
+
+FuriHalVersionOtpVersion furi_hal_version_get_otp_version() {
+    return FuriHalVersionOtpVersionEmpty;
+}
+
+uint8_t furi_hal_version_get_hw_version() {
+    return 0;
+}
+
+uint8_t furi_hal_version_get_hw_target() {
+    return 0;
+}
+
+uint8_t furi_hal_version_get_hw_body() {
+    return 0;
+}
+
+FuriHalVersionColor furi_hal_version_get_hw_color() {
+    return FuriHalVersionColorUnknown;
+}
+
+uint8_t furi_hal_version_get_hw_connect() {
+    return 0;
+}
+
+FuriHalVersionRegion furi_hal_version_get_hw_region() {
+    return FuriHalVersionRegionUnknown;
+}
+
+const char* furi_hal_version_get_hw_region_name() {
+    return "R00";
+}
+
+FuriHalVersionDisplay furi_hal_version_get_hw_display() {
+    return FuriHalVersionDisplayUnknown;
+}
+
+uint32_t furi_hal_version_get_hw_timestamp() {
+    return 0;
+}
+
+const char* furi_hal_version_get_name_ptr() {
+    return "Host";
+}
+
+const char* furi_hal_version_get_device_name_ptr() {
+    return "Flipper Host";
+}
+
+const uint8_t* furi_hal_version_get_ble_mac() {
+    return furi_hal_version_host_ble_mac;
+}
+
+const struct Version* furi_hal_version_get_firmware_version() {
+    return version_get();
+}
+
+size_t furi_hal_version_uid_size() {
+    return sizeof(furi_hal_version_host_uid);
+}
+
+const uint8_t* furi_hal_version_uid() {
+    return furi_hal_version_host_uid;
+}
+
+const uint8_t* furi_hal_version_uid_default() {
+    return furi_hal_version_host_uid;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifndef CMSIS_device_header
+#define CMSIS_device_header "stm32wbxx.h"
+#endif /* CMSIS_device_header */
+
+#include CMSIS_device_header
+
+/* Host build runs on FreeRTOS POSIX port: every task is a pthread and the
+   tick is driven by a signal based interval timer. */
+
+#define configUSE_PREEMPTION 1
+#define configSUPPORT_STATIC_ALLOCATION 1
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#define configUSE_IDLE_HOOK 0
+#define configUSE_TICK_HOOK 0
+#define configCPU_CLOCK_HZ (SystemCoreClock)
+#define configTICK_RATE_HZ_RAW 1000
+#define configTICK_RATE_HZ ((TickType_t)configTICK_RATE_HZ_RAW)
+#define configMAX_PRIORITIES (32)
+#define configMINIMAL_STACK_SIZE ((uint16_t)PTHREAD_STACK_MIN)
+#define configTOTAL_HEAP_SIZE ((size_t)(16 * 1024 * 1024))
+#define configMAX_TASK_NAME_LEN (32)
+#define configGENERATE_RUN_TIME_STATS 1
+#define configRUN_TIME_COUNTER_TYPE uint64_t
+#define configUSE_TRACE_FACILITY 1
+#define configUSE_16_BIT_TICKS 0
+#define configUSE_MUTEXES 1
+#define configQUEUE_REGISTRY_SIZE 0
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_RECURSIVE_MUTEXES 1
+#define configUSE_COUNTING_SEMAPHORES 1
+#define configENABLE_BACKWARD_COMPATIBILITY 0
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_TICKLESS_IDLE 0
+#define configRECORD_STACK_HIGH_ADDRESS 1
+#define configUSE_NEWLIB_REENTRANT 0
+
+#define configMESSAGE_BUFFER_LENGTH_TYPE size_t
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 2
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 0
+
+/* Software timer definitions. */
+#define configUSE_TIMERS 1
+#define configTIMER_TASK_PRIORITY (2)
+#define configTIMER_QUEUE_LENGTH 32
+#define configTIMER_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+#define configTIMER_SERVICE_TASK_NAME "TimersSrv"
+
+#define configIDLE_TASK_NAME "(-_-)"
+
+#define INCLUDE_xTaskGetHandle 1
+#define INCLUDE_eTaskGetState 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+#define INCLUDE_uxTaskPriorityGet 1
+#define INCLUDE_vTaskCleanUpResources 0
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_vTaskDelayUntil 1
+#define INCLUDE_vTaskDelete 1
+#define INCLUDE_vTaskPrioritySet 1
+#define INCLUDE_vTaskSuspend 1
+#define INCLUDE_xQueueGetMutexHolder 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTimerPendFunctionCall 1
+
+/* Furi-specific */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES 2
+
+/* Run time stats are counted in core cycles */
+extern uint64_t furi_thread_runtime_counter();
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE() furi_thread_runtime_counter()
+
+#include <limits.h>
+
+#ifdef DEBUG
+#include <core/check.h>
+#define configASSERT(x)                \
+    if((x) == 0) {                     \
+        furi_crash("FreeRTOS Assert"); \
+    }
+#endif
+
+/* POSIX port owns portCLEAN_UP_TCB to reap the backing pthread,
+   so Furi thread cleanup hooks into task deletion instead. */
+#define traceTASK_DELETE(pxTCB)                                   \
+    extern void furi_thread_cleanup_tcb_event(TaskHandle_t task); \
+    furi_thread_cleanup_tcb_event(pxTCB)
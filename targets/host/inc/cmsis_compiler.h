@@ -0,0 +1,81 @@
+/**
+ * @file cmsis_compiler.h
+ * Host replacement for CMSIS compiler intrinsics
+ *
+ * Furi core only needs to know whether it runs in interrupt context or with
+ * interrupts masked. On host there are no interrupts: FreeRTOS POSIX port
+ * emulates them with signals, so every check reports thread context.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef __ASM
+#define __ASM __asm
+#endif
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN __attribute__((__noreturn__))
+#endif
+#ifndef __USED
+#define __USED __attribute__((used))
+#endif
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+#ifndef __PACKED
+#define __PACKED __attribute__((packed, aligned(1)))
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#endif
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void) {
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void) {
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t primask) {
+    (void)primask;
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void) {
+}
+
+__STATIC_FORCEINLINE void __enable_irq(void) {
+}
+
+__STATIC_FORCEINLINE void __NOP(void) {
+    __asm volatile("nop");
+}
+
+__STATIC_FORCEINLINE void __DSB(void) {
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __DMB(void) {
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __ISB(void) {
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __WFI(void) {
+}
+
+__STATIC_FORCEINLINE void __BKPT(uint32_t value) {
+    (void)value;
+    __builtin_trap();
+}
@@ -0,0 +1,23 @@
+/**
+ * @file stm32wbxx.h
+ * Host stand-in for the STM32WB device header
+ *
+ * Provides only what target independent code (furi core, FreeRTOS config)
+ * pulls from the device header. Peripheral register blocks are intentionally
+ * absent: code touching them does not belong to the host build.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <cmsis_compiler.h>
+
+#define SystemCoreClock (64000000UL)
+
+typedef enum {
+    SVCall_IRQn = -5,
+} IRQn_Type;
+
+__STATIC_INLINE void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+    (void)irq;
+    (void)priority;
+}
@@ -0,0 +1,36 @@
+#include <core/check.h>
+#include <core/common_defines.h>
+#include <core/log.h>
+#include <core/thread.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Host variant of furi/core/check.c: no registers to dump and no MCU to halt,
+   so print what is known and let the debugger or CI catch SIGABRT. */
+
+const char* __furi_check_message = NULL;
+
+static void furi_host_print_crash(const char* kind, const char* fallback) {
+    const char* name = furi_thread_get_name(furi_thread_get_current_id());
+    if(__furi_check_message == NULL) {
+        __furi_check_message = fallback;
+    }
+    fprintf(
+        stderr,
+        "\r\n\033[0;31m[%s][%s] %s\033[0m\r\n",
+        kind,
+        name ? name : "Unknown",
+        __furi_check_message);
+    fflush(stderr);
+}
+
+FURI_NORETURN void __furi_crash_implementation() {
+    furi_host_print_crash("CRASH", "Fatal Error");
+    abort();
+}
+
+FURI_NORETURN void __furi_halt_implementation() {
+    furi_host_print_crash("HALT", "System halt requested.");
+    exit(EXIT_FAILURE);
+}
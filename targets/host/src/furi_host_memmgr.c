@@ -0,0 +1,86 @@
+#include <core/memmgr.h>
+#include <core/memmgr_heap.h>
+#include <core/common_defines.h>
+
+#include <malloc.h>
+#include <stdio.h>
+
+/* Host variant of furi/core/memmgr.c and memmgr_heap.c: allocations go to libc.
+   Heap numbers are derived from allocator statistics against a nominal heap
+   size, which is enough for leak checks done by unit tests. */
+
+#define FURI_HOST_HEAP_SIZE (16 * 1024 * 1024)
+
+static size_t furi_host_memmgr_minimum_free = FURI_HOST_HEAP_SIZE;
+
+static size_t furi_host_memmgr_used() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks;
+}
+
+size_t memmgr_get_free_heap(void) {
+    size_t used = furi_host_memmgr_used();
+    size_t free = used < FURI_HOST_HEAP_SIZE ? FURI_HOST_HEAP_SIZE - used : 0;
+    if(free < furi_host_memmgr_minimum_free) {
+        furi_host_memmgr_minimum_free = free;
+    }
+    return free;
+}
+
+size_t memmgr_get_total_heap(void) {
+    return FURI_HOST_HEAP_SIZE;
+}
+
+size_t memmgr_get_minimum_free_heap(void) {
+    memmgr_get_free_heap();
+    return furi_host_memmgr_minimum_free;
+}
+
+void* memmgr_alloc_from_pool(size_t size) {
+    return malloc(size);
+}
+
+size_t memmgr_pool_get_free(void) {
+    return 0;
+}
+
+size_t memmgr_pool_get_max_block(void) {
+    return 0;
+}
+
+void* aligned_malloc(size_t size, size_t alignment) {
+    void* p = NULL;
+    if(posix_memalign(&p, MAX(alignment, sizeof(void*)), size) != 0) {
+        return NULL;
+    }
+    return p;
+}
+
+void aligned_free(void* p) {
+    free(p);
+}
+
+void memmgr_heap_enable_thread_trace(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+}
+
+void memmgr_heap_disable_thread_trace(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+}
+
+size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
+    UNUSED(thread_id);
+    return MEMMGR_HEAP_UNKNOWN;
+}
+
+size_t memmgr_heap_get_max_free_block() {
+    return memmgr_get_free_heap();
+}
+
+size_t memmgr_heap_get_slab_free() {
+    return 0;
+}
+
+void memmgr_heap_printf_free_blocks() {
+    malloc_stats();
+}
@@ -0,0 +1,146 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include "../storage/storage_host.h"
+#include "minunit_vars.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TAG "Main"
+
+/* Suites that do not touch hardware and therefore run on host as is.
+   Keep in sync with test_index.c when adding portable suites. */
+int run_minunit_test_furi();
+int run_minunit_test_furi_string();
+int run_minunit_test_storage();
+int run_minunit_test_stream();
+int run_minunit_test_dirwalk();
+int run_minunit_test_flipper_format();
+int run_minunit_test_flipper_format_string();
+int run_minunit_test_subghz();
+int run_minunit_test_infrared();
+int run_minunit_test_protocol_dict();
+int run_minunit_test_lfrfid_protocols();
+int run_minunit_test_bit_lib();
+int run_minunit_test_float_tools();
+int run_minunit_test_sector_cache();
+int run_minunit_test_varint();
+int run_minunit_test_canvas_blit();
+int run_minunit_test_trace();
+
+typedef int (*UnitTestEntry)();
+
+typedef struct {
+    const char* name;
+    const UnitTestEntry entry;
+} UnitTest;
+
+static const UnitTest unit_tests[] = {
+    {.name = "furi", .entry = run_minunit_test_furi},
+    {.name = "furi_string", .entry = run_minunit_test_furi_string},
+    {.name = "storage", .entry = run_minunit_test_storage},
+    {.name = "stream", .entry = run_minunit_test_stream},
+    {.name = "dirwalk", .entry = run_minunit_test_dirwalk},
+    {.name = "flipper_format", .entry = run_minunit_test_flipper_format},
+    {.name = "flipper_format_string", .entry = run_minunit_test_flipper_format_string},
+    {.name = "subghz", .entry = run_minunit_test_subghz},
+    {.name = "infrared", .entry = run_minunit_test_infrared},
+    {.name = "protocol_dict", .entry = run_minunit_test_protocol_dict},
+    {.name = "lfrfid", .entry = run_minunit_test_lfrfid_protocols},
+    {.name = "bit_lib", .entry = run_minunit_test_bit_lib},
+    {.name = "float_tools", .entry = run_minunit_test_float_tools},
+    {.name = "sector_cache", .entry = run_minunit_test_sector_cache},
+    {.name = "varint", .entry = run_minunit_test_varint},
+    {.name = "canvas_blit", .entry = run_minunit_test_canvas_blit},
+    {.name = "trace", .entry = run_minunit_test_trace},
+};
+
+typedef struct {
+    int argc;
+    char** argv;
+} HostArgs;
+
+void minunit_print_progress() {
+}
+
+void minunit_print_fail(const char* str) {
+    printf(_FURI_LOG_CLR_E "%s\r\n" _FURI_LOG_CLR_RESET, str);
+}
+
+void minunit_printf_warning(const char* format, ...) {
+    FuriString* str = furi_string_alloc();
+    va_list args;
+    va_start(args, format);
+    furi_string_vprintf(str, format, args);
+    va_end(args);
+    printf(_FURI_LOG_CLR_W "%s\r\n" _FURI_LOG_CLR_RESET, furi_string_get_cstr(str));
+    furi_string_free(str);
+}
+
+static void host_log_callback(const uint8_t* data, size_t size, void* context) {
+    UNUSED(context);
+    fwrite(data, 1, size, stdout);
+}
+
+static bool host_unit_test_selected(const HostArgs* args, const char* name) {
+    if(args->argc < 2) return true;
+
+    for(int i = 1; i < args->argc; i++) {
+        if(strcmp(args->argv[i], name) == 0) return true;
+    }
+
+    return false;
+}
+
+static int32_t host_unit_tests_thread(void* context) {
+    HostArgs* args = context;
+
+    // Wait for storage service before suites start poking files
+    furi_record_open(RECORD_STORAGE);
+    furi_record_close(RECORD_STORAGE);
+
+    uint32_t heap_before = memmgr_get_free_heap();
+    uint32_t cycle_counter = furi_get_tick();
+
+    for(size_t i = 0; i < COUNT_OF(unit_tests); i++) {
+        if(host_unit_test_selected(args, unit_tests[i].name)) {
+            unit_tests[i].entry();
+        } else {
+            printf("Skipping %s\r\n", unit_tests[i].name);
+        }
+    }
+
+    printf("\r\nFailed tests: %u\r\n", minunit_fail);
+    printf("Consumed: %lu ms\r\n", furi_get_tick() - cycle_counter);
+    furi_delay_ms(200);
+    printf("Leaked: %ld\r\n", (long)heap_before - (long)memmgr_get_free_heap());
+    printf("Status: %s\r\n", minunit_fail == 0 ? "PASSED" : "FAILED");
+    fflush(stdout);
+
+    exit(minunit_fail == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+int main(int argc, char** argv) {
+    static HostArgs args;
+    args.argc = argc;
+    args.argv = argv;
+
+    furi_hal_init_early();
+    furi_init();
+    furi_log_add_handler((FuriLogHandler){.callback = host_log_callback, .context = NULL});
+    furi_hal_init();
+
+    FuriThread* storage_thread =
+        furi_thread_alloc_ex(RECORD_STORAGE, 4 * 1024, storage_host_srv, NULL);
+    furi_thread_start(storage_thread);
+
+    FuriThread* tests_thread =
+        furi_thread_alloc_ex("UnitTests", 8 * 1024, host_unit_tests_thread, &args);
+    furi_thread_start(tests_thread);
+
+    furi_run();
+
+    return EXIT_FAILURE;
+}
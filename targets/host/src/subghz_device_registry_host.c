@@ -0,0 +1,28 @@
+#include <lib/subghz/devices/registry.h>
+
+/* No radio devices on host: registry is always empty, so
+   subghz_devices_get_by_name() returns NULL and callers skip the radio. */
+
+void subghz_device_registry_init(void) {
+}
+
+void subghz_device_registry_deinit(void) {
+}
+
+bool subghz_device_registry_is_valid(void) {
+    return true;
+}
+
+const SubGhzDevice* subghz_device_registry_get_by_name(const char* name) {
+    UNUSED(name);
+    return NULL;
+}
+
+const SubGhzDevice* subghz_device_registry_get_by_index(size_t index) {
+    UNUSED(index);
+    return NULL;
+}
+
+size_t subghz_device_registry_count(void) {
+    return 0;
+}
@@ -0,0 +1,488 @@
+#include "storage_host.h"
+
+#include <storage/storage.h>
+#include <storage/storage_i.h>
+#include <storage/storage_message.h>
+#include <storage/storage_processing.h>
+#include <storage/storages/storage_ext.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#define TAG "StorageHost"
+
+#define STORAGE_HOST_TICK 1000
+
+typedef struct {
+    FuriString* root;
+} StorageHostData;
+
+typedef struct {
+    int fd;
+} StorageHostFile;
+
+typedef struct {
+    DIR* dir;
+} StorageHostDir;
+
+/******************* Helpers *******************/
+
+static FS_Error storage_host_parse_error(int error) {
+    FS_Error result;
+    switch(error) {
+    case 0:
+        result = FSE_OK;
+        break;
+    case ENOENT:
+    case ENOTDIR:
+        result = FSE_NOT_EXIST;
+        break;
+    case EEXIST:
+    case ENOTEMPTY:
+        result = FSE_EXIST;
+        break;
+    case ENAMETOOLONG:
+        result = FSE_INVALID_NAME;
+        break;
+    case EINVAL:
+    case EBADF:
+        result = FSE_INVALID_PARAMETER;
+        break;
+    case EACCES:
+    case EPERM:
+    case EROFS:
+    case EISDIR:
+        result = FSE_DENIED;
+        break;
+    default:
+        result = FSE_INTERNAL;
+        break;
+    }
+
+    return result;
+}
+
+static void storage_host_set_error(File* file, int error) {
+    file->internal_error_id = error;
+    file->error_id = storage_host_parse_error(error);
+}
+
+static FuriString* storage_host_real_path(StorageData* storage, const char* path) {
+    StorageHostData* host_data = storage->data;
+    FuriString* real_path = furi_string_alloc_set(host_data->root);
+    furi_string_cat_str(real_path, path);
+    return real_path;
+}
+
+/******************* File Functions *******************/
+
+static bool storage_host_file_open(
+    void* ctx,
+    File* file,
+    const char* path,
+    FS_AccessMode access_mode,
+    FS_OpenMode open_mode) {
+    StorageData* storage = ctx;
+    int flags = 0;
+
+    if((access_mode & FSAM_READ_WRITE) == FSAM_READ_WRITE) {
+        flags |= O_RDWR;
+    } else if(access_mode & FSAM_WRITE) {
+        flags |= O_WRONLY;
+    } else {
+        flags |= O_RDONLY;
+    }
+
+    if(open_mode & FSOM_OPEN_ALWAYS) flags |= O_CREAT;
+    if(open_mode & FSOM_OPEN_APPEND) flags |= O_CREAT | O_APPEND;
+    if(open_mode & FSOM_CREATE_NEW) flags |= O_CREAT | O_EXCL;
+    if(open_mode & FSOM_CREATE_ALWAYS) flags |= O_CREAT | O_TRUNC;
+
+    StorageHostFile* file_data = malloc(sizeof(StorageHostFile));
+    storage_set_storage_file_data(file, file_data, storage);
+
+    FuriString* real_path = storage_host_real_path(storage, path);
+    file_data->fd = open(furi_string_get_cstr(real_path), flags, 0644);
+    furi_string_free(real_path);
+
+    storage_host_set_error(file, file_data->fd < 0 ? errno : 0);
+    return (file->error_id == FSE_OK);
+}
+
+static bool storage_host_file_close(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    int result = file_data->fd < 0 ? 0 : close(file_data->fd);
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    free(file_data);
+    storage_set_storage_file_data(file, NULL, storage);
+    return (file->error_id == FSE_OK);
+}
+
+static uint16_t
+    storage_host_file_read(void* ctx, File* file, void* buff, uint16_t const bytes_to_read) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    ssize_t bytes_read = read(file_data->fd, buff, bytes_to_read);
+    storage_host_set_error(file, bytes_read < 0 ? errno : 0);
+    return bytes_read < 0 ? 0 : bytes_read;
+}
+
+static uint16_t
+    storage_host_file_write(void* ctx, File* file, const void* buff, uint16_t const bytes_to_write) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    ssize_t bytes_written = write(file_data->fd, buff, bytes_to_write);
+    storage_host_set_error(file, bytes_written < 0 ? errno : 0);
+    return bytes_written < 0 ? 0 : bytes_written;
+}
+
+static bool
+    storage_host_file_seek(void* ctx, File* file, const uint32_t offset, const bool from_start) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+
+    // FatFs clamps read-only seeks to file size, mimic that
+    off_t size = lseek(file_data->fd, 0, SEEK_END);
+    off_t position = from_start ? 0 : lseek(file_data->fd, 0, SEEK_CUR);
+    position += offset;
+    int flags = fcntl(file_data->fd, F_GETFL);
+    if((flags & O_ACCMODE) == O_RDONLY && position > size) {
+        position = size;
+    }
+
+    off_t result = lseek(file_data->fd, position, SEEK_SET);
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    return (file->error_id == FSE_OK);
+}
+
+static uint64_t storage_host_file_tell(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    off_t position = lseek(file_data->fd, 0, SEEK_CUR);
+    storage_host_set_error(file, position < 0 ? errno : 0);
+    return position < 0 ? 0 : position;
+}
+
+static bool storage_host_file_expand(void* ctx, File* file, const uint64_t size) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    int result = posix_fallocate(file_data->fd, 0, size);
+    storage_host_set_error(file, result);
+    return (file->error_id == FSE_OK);
+}
+
+static bool storage_host_file_truncate(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    off_t position = lseek(file_data->fd, 0, SEEK_CUR);
+    int result = ftruncate(file_data->fd, position);
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    return (file->error_id == FSE_OK);
+}
+
+static bool storage_host_file_sync(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    int result = fsync(file_data->fd);
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    return (file->error_id == FSE_OK);
+}
+
+static uint64_t storage_host_file_size(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    struct stat file_stat;
+    int result = fstat(file_data->fd, &file_stat);
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    return result < 0 ? 0 : file_stat.st_size;
+}
+
+static bool storage_host_file_eof(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostFile* file_data = storage_get_storage_file_data(file, storage);
+    off_t position = lseek(file_data->fd, 0, SEEK_CUR);
+    struct stat file_stat;
+    fstat(file_data->fd, &file_stat);
+    file->error_id = FSE_OK;
+    return position >= file_stat.st_size;
+}
+
+/******************* Dir Functions *******************/
+
+static bool storage_host_dir_open(void* ctx, File* file, const char* path) {
+    StorageData* storage = ctx;
+
+    StorageHostDir* file_data = malloc(sizeof(StorageHostDir));
+    storage_set_storage_file_data(file, file_data, storage);
+
+    FuriString* real_path = storage_host_real_path(storage, path);
+    file_data->dir = opendir(furi_string_get_cstr(real_path));
+    furi_string_free(real_path);
+
+    storage_host_set_error(file, file_data->dir ? 0 : errno);
+    return (file->error_id == FSE_OK);
+}
+
+static bool storage_host_dir_close(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostDir* file_data = storage_get_storage_file_data(file, storage);
+    int result = file_data->dir ? closedir(file_data->dir) : 0;
+    storage_host_set_error(file, result < 0 ? errno : 0);
+    free(file_data);
+    return (file->error_id == FSE_OK);
+}
+
+static bool storage_host_dir_read(
+    void* ctx,
+    File* file,
+    FileInfo* fileinfo,
+    char* name,
+    const uint16_t name_length) {
+    StorageData* storage = ctx;
+    StorageHostDir* file_data = storage_get_storage_file_data(file, storage);
+
+    struct dirent* entry;
+    do {
+        errno = 0;
+        entry = readdir(file_data->dir);
+        // FatFs never reports dot entries
+    } while(entry && (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0));
+
+    if(entry == NULL) {
+        storage_host_set_error(file, errno);
+        if(file->error_id == FSE_OK) file->error_id = FSE_NOT_EXIST;
+        return false;
+    }
+
+    if(fileinfo != NULL) {
+        struct stat entry_stat;
+        fstatat(dirfd(file_data->dir), entry->d_name, &entry_stat, 0);
+        fileinfo->size = entry_stat.st_size;
+        fileinfo->flags = S_ISDIR(entry_stat.st_mode) ? FSF_DIRECTORY : 0;
+    }
+
+    if(name != NULL) {
+        snprintf(name, name_length, "%s", entry->d_name);
+    }
+
+    storage_host_set_error(file, 0);
+    return true;
+}
+
+static bool storage_host_dir_rewind(void* ctx, File* file) {
+    StorageData* storage = ctx;
+    StorageHostDir* file_data = storage_get_storage_file_data(file, storage);
+    rewinddir(file_data->dir);
+    storage_host_set_error(file, 0);
+    return true;
+}
+
+/******************* Common FS Functions *******************/
+
+static FS_Error storage_host_common_stat(void* ctx, const char* path, FileInfo* fileinfo) {
+    StorageData* storage = ctx;
+    FuriString* real_path = storage_host_real_path(storage, path);
+    struct stat path_stat;
+    int result = stat(furi_string_get_cstr(real_path), &path_stat);
+    furi_string_free(real_path);
+
+    if(result < 0) {
+        return storage_host_parse_error(errno);
+    }
+
+    if(fileinfo != NULL) {
+        fileinfo->size = path_stat.st_size;
+        fileinfo->flags = S_ISDIR(path_stat.st_mode) ? FSF_DIRECTORY : 0;
+    }
+
+    return FSE_OK;
+}
+
+static FS_Error storage_host_common_remove(void* ctx, const char* path) {
+    StorageData* storage = ctx;
+    FuriString* real_path = storage_host_real_path(storage, path);
+    int result = remove(furi_string_get_cstr(real_path));
+    furi_string_free(real_path);
+    return storage_host_parse_error(result < 0 ? errno : 0);
+}
+
+static FS_Error storage_host_common_rename(void* ctx, const char* old, const char* new) {
+    StorageData* storage = ctx;
+    FuriString* real_old = storage_host_real_path(storage, old);
+    FuriString* real_new = storage_host_real_path(storage, new);
+
+    // FatFs refuses to overwrite, POSIX rename silently does
+    int result = -1;
+    if(access(furi_string_get_cstr(real_new), F_OK) == 0) {
+        errno = EEXIST;
+    } else {
+        result = rename(furi_string_get_cstr(real_old), furi_string_get_cstr(real_new));
+    }
+
+    furi_string_free(real_old);
+    furi_string_free(real_new);
+    return storage_host_parse_error(result < 0 ? errno : 0);
+}
+
+static FS_Error storage_host_common_mkdir(void* ctx, const char* path) {
+    StorageData* storage = ctx;
+    FuriString* real_path = storage_host_real_path(storage, path);
+    int result = mkdir(furi_string_get_cstr(real_path), 0755);
+    furi_string_free(real_path);
+    return storage_host_parse_error(result < 0 ? errno : 0);
+}
+
+static FS_Error storage_host_common_fs_info(
+    void* ctx,
+    const char* fs_path,
+    uint64_t* total_space,
+    uint64_t* free_space) {
+    UNUSED(fs_path);
+    StorageData* storage = ctx;
+    StorageHostData* host_data = storage->data;
+
+    struct statvfs fs_stat;
+    if(statvfs(furi_string_get_cstr(host_data->root), &fs_stat) < 0) {
+        return storage_host_parse_error(errno);
+    }
+
+    if(total_space != NULL) {
+        *total_space = (uint64_t)fs_stat.f_blocks * fs_stat.f_frsize;
+    }
+
+    if(free_space != NULL) {
+        *free_space = (uint64_t)fs_stat.f_bavail * fs_stat.f_frsize;
+    }
+
+    return FSE_OK;
+}
+
+static bool storage_host_common_equivalent_path(const char* path1, const char* path2) {
+    return strcasecmp(path1, path2) == 0;
+}
+
+static const FS_Api fs_api = {
+    .file =
+        {
+            .open = storage_host_file_open,
+            .close = storage_host_file_close,
+            .read = storage_host_file_read,
+            .write = storage_host_file_write,
+            .seek = storage_host_file_seek,
+            .tell = storage_host_file_tell,
+            .expand = storage_host_file_expand,
+            .truncate = storage_host_file_truncate,
+            .size = storage_host_file_size,
+            .sync = storage_host_file_sync,
+            .eof = storage_host_file_eof,
+        },
+    .dir =
+        {
+            .open = storage_host_dir_open,
+            .close = storage_host_dir_close,
+            .read = storage_host_dir_read,
+            .rewind = storage_host_dir_rewind,
+        },
+    .common =
+        {
+            .stat = storage_host_common_stat,
+            .mkdir = storage_host_common_mkdir,
+            .remove = storage_host_common_remove,
+            .rename = storage_host_common_rename,
+            .fs_info = storage_host_common_fs_info,
+            .equivalent_path = storage_host_common_equivalent_path,
+        },
+};
+
+static void storage_host_init(StorageData* storage, const char* env_name, const char* fallback) {
+    const char* root = getenv(env_name);
+    if(root == NULL) root = fallback;
+
+    StorageHostData* host_data = malloc(sizeof(StorageHostData));
+    host_data->root = furi_string_alloc_set(root);
+    // Storage paths always start with slash, drop it from the root
+    while(furi_string_size(host_data->root) > 1 && furi_string_end_with(host_data->root, "/")) {
+        furi_string_left(host_data->root, furi_string_size(host_data->root) - 1);
+    }
+
+    mkdir(furi_string_get_cstr(host_data->root), 0755);
+
+    storage->data = host_data;
+    storage->fs_api = &fs_api;
+    storage->status = StorageStatusOK;
+
+    FURI_LOG_I(TAG, "%s mounted from %s", fallback, furi_string_get_cstr(host_data->root));
+}
+
+/******************* SD API used by storage processing *******************/
+
+FS_Error sd_mount_card(StorageData* storage, bool notify) {
+    UNUSED(notify);
+    storage->status = StorageStatusOK;
+    return FSE_OK;
+}
+
+FS_Error sd_unmount_card(StorageData* storage) {
+    storage->status = StorageStatusNotReady;
+    return FSE_OK;
+}
+
+FS_Error sd_format_card(StorageData* storage) {
+    UNUSED(storage);
+    return FSE_NOT_READY;
+}
+
+FS_Error sd_card_info(StorageData* storage, SDInfo* sd_info) {
+    memset(sd_info, 0, sizeof(SDInfo));
+
+    uint64_t total_space = 0;
+    uint64_t free_space = 0;
+    FS_Error error = storage_host_common_fs_info(storage, "/", &total_space, &free_space);
+
+    sd_info->fs_type = FST_EXFAT;
+    sd_info->kb_total = total_space / 1024;
+    sd_info->kb_free = free_space / 1024;
+    sd_info->cluster_size = 4096;
+    sd_info->sector_size = 512;
+    snprintf(sd_info->label, sizeof(sd_info->label), "HOST");
+
+    return error;
+}
+
+/******************* Service *******************/
+
+int32_t storage_host_srv(void* p) {
+    UNUSED(p);
+    Storage* app = malloc(sizeof(Storage));
+    app->message_queue = furi_message_queue_alloc(8, sizeof(StorageMessage));
+    app->pubsub = furi_pubsub_alloc();
+    app->sd_gui.view_port = NULL;
+    app->sd_gui.enabled = false;
+
+    for(uint8_t i = 0; i < STORAGE_COUNT; i++) {
+        storage_data_init(&app->storage[i]);
+        storage_data_timestamp(&app->storage[i]);
+    }
+
+    storage_host_init(&app->storage[ST_EXT], STORAGE_HOST_EXT_ROOT_ENV, "ext");
+    storage_host_init(&app->storage[ST_INT], STORAGE_HOST_INT_ROOT_ENV, "int");
+
+    furi_record_create(RECORD_STORAGE, app);
+
+    StorageMessage message;
+    while(1) {
+        if(furi_message_queue_get(app->message_queue, &message, STORAGE_HOST_TICK) ==
+           FuriStatusOk) {
+            storage_process_message(app, &message);
+        }
+    }
+
+    return 0;
+}
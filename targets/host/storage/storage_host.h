@@ -0,0 +1,33 @@
+/**
+ * @file storage_host.h
+ * POSIX backed storage for host target
+ *
+ * Replaces FatFs/LittleFS backends with plain host directories while keeping
+ * the storage service message loop, so code under test talks to the same
+ * Storage API and pays the same per-call round trip as on device.
+ */
+#pragma once
+
+#include <furi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Environment variable with host directory mounted as /ext */
+#define STORAGE_HOST_EXT_ROOT_ENV "FURI_HOST_EXT_ROOT"
+
+/** Environment variable with host directory mounted as /int */
+#define STORAGE_HOST_INT_ROOT_ENV "FURI_HOST_INT_ROOT"
+
+/** Storage service entry point for host target
+ *
+ * @param      p     unused
+ *
+ * @return     never returns
+ */
+int32_t storage_host_srv(void* p);
+
+#ifdef __cplusplus
+}
+#endif